@@ -0,0 +1,169 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <sstream>
+#endif
+
+#include <Base/Interpreter.h>
+#include <CXX/Objects.hxx>
+
+#include "CompiledExpression.h"
+#include "ExpressionParser.h"
+
+
+using namespace App;
+
+CompiledExpression::CompiledExpression(const Expression* expr)
+    : expression(expr)
+{
+    compile(expr);
+}
+
+CompiledExpression::~CompiledExpression() = default;
+
+void CompiledExpression::emit(OpCode opcode, const Expression* expr, int arg)
+{
+    code.push_back({opcode, expr, arg});
+    switch (opcode) {
+        case OpCode::Evaluate:
+        case OpCode::Variable:
+            maxDepth = std::max(maxDepth, ++depth);
+            break;
+        case OpCode::Binary:
+        case OpCode::JumpIfFalse:
+            --depth;
+            break;
+        default:
+            break;
+    }
+}
+
+void CompiledExpression::compile(const Expression* expr)
+{
+    // Nodes with components, e.g. indexing or attribute access, are left to
+    // the tree, as are derived types that may evaluate differently.
+    if (!expr->hasComponent()) {
+        Base::Type type = expr->getTypeId();
+        if (type == OperatorExpression::getClassTypeId()) {
+            auto op = static_cast<const OperatorExpression*>(expr);
+            compile(op->getLeft());
+            if (OperatorExpression::isUnary(op->getOperator())) {
+                emit(OpCode::Unary, expr, op->getOperator());
+            }
+            else {
+                compile(op->getRight());
+                emit(OpCode::Binary, expr, op->getOperator());
+            }
+            return;
+        }
+        if (type == ConditionalExpression::getClassTypeId()) {
+            auto cond = static_cast<const ConditionalExpression*>(expr);
+            compile(cond->getCondition());
+            std::size_t jumpFalse = code.size();
+            emit(OpCode::JumpIfFalse, expr);
+            compile(cond->getTrueExpression());
+            std::size_t jumpEnd = code.size();
+            emit(OpCode::Jump, expr);
+            // only one of the branches leaves its value on the stack
+            --depth;
+            code[jumpFalse].arg = static_cast<int>(code.size());
+            compile(cond->getFalseExpression());
+            code[jumpEnd].arg = static_cast<int>(code.size());
+            return;
+        }
+        if (type == VariableExpression::getClassTypeId()) {
+            auto var = static_cast<const VariableExpression*>(expr);
+            bindings.push_back(std::make_unique<ObjectIdentifier::Binding>(var->getPath()));
+            emit(OpCode::Variable, expr, static_cast<int>(bindings.size() - 1));
+            return;
+        }
+    }
+    emit(OpCode::Evaluate, expr);
+}
+
+Py::Object CompiledExpression::getPyValue() const
+{
+    std::vector<Py::Object> stack;
+    stack.reserve(maxDepth);
+
+    std::size_t pc = 0;
+    try {
+        while (pc < code.size()) {
+            const Instruction& instr = code[pc++];
+            switch (instr.code) {
+                case OpCode::Evaluate:
+                    stack.push_back(instr.expr->getPyValue());
+                    break;
+                case OpCode::Variable:
+                    stack.push_back(bindings[instr.arg]->getPyValue());
+                    break;
+                case OpCode::Unary:
+                    stack.back() = OperatorExpression::calc(
+                        instr.expr,
+                        static_cast<OperatorExpression::Operator>(instr.arg),
+                        stack.back(),
+                        Py::Object());
+                    break;
+                case OpCode::Binary: {
+                    Py::Object right = stack.back();
+                    stack.pop_back();
+                    stack.back() = OperatorExpression::calc(
+                        instr.expr,
+                        static_cast<OperatorExpression::Operator>(instr.arg),
+                        stack.back(),
+                        right);
+                    break;
+                }
+                case OpCode::JumpIfFalse: {
+                    bool cond = stack.back().isTrue();
+                    stack.pop_back();
+                    if (!cond) {
+                        pc = instr.arg;
+                    }
+                    break;
+                }
+                case OpCode::Jump:
+                    pc = instr.arg;
+                    break;
+            }
+        }
+    }
+    catch (Py::Exception&) {
+        Base::PyException e;
+        std::ostringstream ss;
+        ss << e.what() << "\nin expression: " << code[pc - 1].expr->toString();
+        e.setMessage(ss.str());
+        e.raiseException();
+    }
+    return stack.back();
+}
+
+App::any CompiledExpression::getValueAsAny() const
+{
+    Base::PyGILStateLocker lock;
+    return pyObjectToAny(getPyValue());
+}
@@ -0,0 +1,116 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef APP_COMPILEDEXPRESSION_H
+#define APP_COMPILEDEXPRESSION_H
+
+#include <memory>
+#include <vector>
+#include <FCGlobal.h>
+
+#include "ObjectIdentifier.h"
+
+namespace App
+{
+
+class Expression;
+
+/** Flat evaluation program of an expression tree
+ *
+ * The operators, conditionals and variables of the tree are compiled into a
+ * postfix instruction list, which is run on a value stack. Variables access
+ * their property through an ObjectIdentifier::Binding, so that repeated
+ * evaluation neither walks the tree nor looks up names. Any other node, e.g. a
+ * function call or a node with components, is evaluated by the tree itself.
+ * The result is the same as Expression::getPyValue().
+ *
+ * The program refers to the nodes of the expression, it must be discarded
+ * once the expression is modified or destroyed.
+ */
+class AppExport CompiledExpression
+{
+public:
+    explicit CompiledExpression(const Expression* expr);
+    ~CompiledExpression();
+
+    CompiledExpression(const CompiledExpression&) = delete;
+    CompiledExpression(CompiledExpression&&) = delete;
+    CompiledExpression& operator=(const CompiledExpression&) = delete;
+    CompiledExpression& operator=(CompiledExpression&&) = delete;
+
+    /// the compiled expression
+    const Expression* getExpression() const
+    {
+        return expression;
+    }
+
+    /// number of instructions of the program
+    std::size_t size() const
+    {
+        return code.size();
+    }
+
+    /// evaluate the program, must hold the Python global interpreter lock
+    Py::Object getPyValue() const;
+
+    /// evaluate the program and convert the result
+    App::any getValueAsAny() const;
+
+private:
+    enum class OpCode
+    {
+        /// push the value of the tree node
+        Evaluate,
+        /// push the value of a binding
+        Variable,
+        /// replace the top of the stack with the result of an unary operator
+        Unary,
+        /// replace the two top values with the result of a binary operator
+        Binary,
+        /// pop the top value and jump if it is false
+        JumpIfFalse,
+        Jump,
+    };
+
+    struct Instruction
+    {
+        OpCode code;
+        /// the tree node, used for evaluation and error messages
+        const Expression* expr;
+        /// operator, index of the binding or jump target
+        int arg;
+    };
+
+    void compile(const Expression* expr);
+    void emit(OpCode code, const Expression* expr, int arg = 0);
+
+    const Expression* expression;
+    std::vector<Instruction> code;
+    std::vector<std::unique_ptr<ObjectIdentifier::Binding>> bindings;
+    std::size_t depth = 0;
+    std::size_t maxDepth = 0;
+};
+
+}  // namespace App
+
+#endif  // APP_COMPILEDEXPRESSION_H
@@ -75,7 +75,9 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 #endif //USE_OLD_DAG
 
 #include <boost/regex.hpp>
+#include <atomic>
 #include <random>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -105,6 +107,8 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 #include "License.h"
 #include "Link.h"
 #include "MergeDocuments.h"
+#include "PropertyGeo.h"
+#include "RecomputeProfile.h"
 #include "StringHasher.h"
 #include "Transactions.h"
 
@@ -137,6 +141,8 @@ namespace App {
 
 static bool globalIsRestoring;
 static bool globalIsRelabeling;
+// set for worker threads of a parallel recompute, see Document::_recomputeConcurrently()
+static thread_local ConcurrentRecompute *_ConcurrentRecompute;
 
 DocumentP::DocumentP()
 {
@@ -476,6 +482,24 @@ void Document::commitTransaction() {
         GetApplication().closeActiveTransaction(false,d->activeUndoTransaction->getID());
 }
 
+// Geometry still used by the document isn't freed when removing
+// transactions. So, mark it as counted, see Transaction::getMemSize().
+static void markDocumentData(const std::vector<DocumentObject*>& objs,
+                             std::unordered_set<const void*>& counted)
+{
+    for (auto obj : objs) {
+        std::vector<Property*> props;
+        obj->getPropertyList(props);
+        for (auto prop : props) {
+            auto geo = dynamic_cast<PropertyComplexGeoData*>(prop);
+            if (!geo)
+                continue;
+            if (auto key = geo->getSharingKey())
+                counted.insert(key);
+        }
+    }
+}
+
 void Document::_commitTransaction(bool notify)
 {
     if (isPerformingTransaction()) {
@@ -500,6 +524,29 @@ void Document::_commitTransaction(bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        // drop the oldest transactions until the stacks fit into the memory
+        // limit, but always keep the one just committed
+        if (d->UndoMemSize > 0 && mUndoTransactions.size() > 1) {
+            // count as in getUndoStats(), so that shared data is charged to
+            // the newest transaction and freed with the oldest one holding it
+            std::unordered_set<const void*> counted;
+            markDocumentData(d->objectArray, counted);
+            std::vector<std::size_t> sizes(mUndoTransactions.size());
+            std::size_t total = 0;
+            auto size = sizes.rbegin();
+            for (auto it = mUndoTransactions.rbegin(); it != mUndoTransactions.rend(); ++it)
+                total += *size++ = (*it)->getMemSize(counted);
+            for (auto it = mRedoTransactions.rbegin(); it != mRedoTransactions.rend(); ++it)
+                total += (*it)->getMemSize(counted);
+
+            for (std::size_t i = 0; total > d->UndoMemSize && mUndoTransactions.size() > 1; ++i) {
+                total -= sizes[i];
+                mUndoMap.erase(mUndoTransactions.front()->getID());
+                delete mUndoTransactions.front();
+                mUndoTransactions.pop_front();
+                ++d->UndoEvicted;
+            }
+        }
         signalCommitTransaction(*this);
 
         // closeActiveTransaction() may call again _commitTransaction()
@@ -592,6 +639,7 @@ void Document::clearDocument()
     if (!d->objectArray.empty()) {
         GetApplication().signalDeleteDocument(*this);
         d->clearDocument();
+        ObjectIdentifier::invalidateBindings();
         GetApplication().signalNewDocument(*this,false);
     }
 
@@ -689,12 +737,37 @@ int Document::getUndoMode() const
     return d->iUndoMode;
 }
 
-unsigned int Document::getUndoMemSize () const
+std::size_t Document::getUndoMemSize () const
+{
+    UndoStats stats = getUndoStats();
+    return stats.undoMemSize + stats.redoMemSize;
+}
+
+Document::UndoStats Document::getUndoStats() const
+{
+    UndoStats stats;
+    stats.undoCount = getAvailableUndos();
+    stats.redoCount = getAvailableRedos();
+    stats.evicted = d->UndoEvicted;
+
+    std::unordered_set<const void*> counted;
+    markDocumentData(d->objectArray, counted);
+
+    if (d->activeUndoTransaction)
+        stats.undoMemSize += d->activeUndoTransaction->getMemSize(counted);
+    for (auto it = mUndoTransactions.rbegin(); it != mUndoTransactions.rend(); ++it)
+        stats.undoMemSize += (*it)->getMemSize(counted);
+    for (auto it = mRedoTransactions.rbegin(); it != mRedoTransactions.rend(); ++it)
+        stats.redoMemSize += (*it)->getMemSize(counted);
+    return stats;
+}
+
+std::size_t Document::getUndoLimit() const
 {
     return d->UndoMemSize;
 }
 
-void Document::setUndoLimit(unsigned int UndoMemSize)
+void Document::setUndoLimit(std::size_t UndoMemSize)
 {
     d->UndoMemSize = UndoMemSize;
 }
@@ -722,6 +795,7 @@ void Document::onChanged(const Property* prop)
 
     // the Name property is a label for display purposes
     if (prop == &Label) {
+        ObjectIdentifier::invalidateBindings();
         Base::FlagToggler<> flag(globalIsRelabeling);
         App::GetApplication().signalRelabelDocument(*this);
     } else if(prop == &ShowHidden) {
@@ -768,15 +842,29 @@ void Document::onChanged(const Property* prop)
 
 void Document::onBeforeChangeProperty(const TransactionalObject *Who, const Property *What)
 {
-    if(Who->isDerivedFrom(App::DocumentObject::getClassTypeId()))
+    // The signal of an object recomputed on a worker thread is queued by
+    // DocumentObject::onBeforeChange(), but the transaction must record the
+    // property before it gets changed.
+    if(!_ConcurrentRecompute && Who->isDerivedFrom(App::DocumentObject::getClassTypeId()))
         signalBeforeChangeObject(*static_cast<const App::DocumentObject*>(Who), *What);
     if(!d->rollback && !globalIsRelabeling) {
+        std::unique_lock<std::mutex> lock(d->recomputeMutex, std::defer_lock);
+        if (_ConcurrentRecompute)
+            lock.lock();
         _checkTransaction(nullptr, What, __LINE__);
         if (d->activeUndoTransaction)
             d->activeUndoTransaction->addObjectChange(Who, What);
     }
 }
 
+bool Document::_deferPropertyChange(const Property *What, bool before)
+{
+    if (!_ConcurrentRecompute)
+        return false;
+    _ConcurrentRecompute->changes.emplace_back(What, before);
+    return true;
+}
+
 void Document::onChangedProperty(const DocumentObject *Who, const Property *What)
 {
     signalChangedObject(*Who, *What);
@@ -800,6 +888,7 @@ Document::Document(const char* documentName)
     // Remark: We force the document Python object to own the DocumentPy instance, thus we don't
     // have to care about ref counting any more.
     d = new DocumentP;
+    ObjectIdentifier::invalidateBindings();
     Base::PyGILStateLocker lock;
     d->DocumentPythonObject = Py::Object(new DocumentPy(this), true);
 
@@ -872,6 +961,11 @@ Document::Document(const char* documentName)
                       "Whether to show hidden object items in the tree view");
     ADD_PROPERTY_TYPE(UseHasher,(true), 0,PropertyType(Prop_Hidden),
                         "Whether to use hasher on topological naming");
+    ADD_PROPERTY_TYPE(BinaryStorage,
+                      (paramGrp->GetBool("SaveBinaryBrep", false)),
+                      0,
+                      PropertyType(Prop_None),
+                      "Whether to store shapes, meshes and points in binary format");
 
     // this creates and sets 'TransientDir' in onChanged()
     ADD_PROPERTY_TYPE(TransientDir,
@@ -906,6 +1000,7 @@ Document::~Document()
 #endif
 
     d->clearDocument();
+    ObjectIdentifier::invalidateBindings();
 
     // Remark: The API of Py::Object has been changed to set whether the wrapper owns the passed
     // Python object or not. In the constructor we forced the wrapper to own the object so we need
@@ -1555,7 +1650,7 @@ unsigned int Document::getMemSize () const
     size += PropertyContainer::getMemSize();
 
     // Undo Redo size
-    size += getUndoMemSize();
+    size += static_cast<unsigned int>(getUndoMemSize());
 
     return size;
 }
@@ -1968,7 +2063,10 @@ bool Document::saveToFile(const char* filename) const
     // fails so that the data of the work up to now isn't lost.
     std::string uuid = Base::Uuid::createUuid();
     std::string fn = nativePath;
-    if (policy) {
+    // Lazily restored data is read from the original file while writing, so
+    // it must not be overwritten before the new file is complete.
+    bool deferred = !policy && d->deferredFiles;
+    if (policy || deferred) {
         fn += ".";
         fn += uuid;
     }
@@ -1985,10 +2083,16 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        // compress on a worker pool only if enabled, 0 for all cores
+        writer.setThreads(hGrp->GetInt("CompressionThreads", 1));
         writer.putNextEntry("Document.xml");
 
-        if (hGrp->GetBool("SaveBinaryBrep", false))
+        if (BinaryStorage.getValue()) {
             writer.setMode("BinaryBrep");
+            // the compact mesh format cannot be read by older versions
+            if (hGrp->GetBool("SaveCompactMesh", false))
+                writer.setMode("BinaryMesh");
+        }
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << endl
                         << "<!--" << endl
@@ -2035,6 +2139,14 @@ bool Document::saveToFile(const char* filename) const
         policy.setNumberOfFiles(count_bak);
         policy.apply(fn, nativePath);
     }
+    else if (deferred) {
+        Base::FileInfo(nativePath).deleteFile();
+        if (!Base::FileInfo(fn).renameFile(nativePath.c_str())) {
+            throw Base::FileException("Cannot rename file", fn.c_str());
+        }
+    }
+    // the deferred files were restored to be saved
+    d->deferredFiles = false;
 
     signalFinishSave(*this, filename);
 
@@ -2058,6 +2170,7 @@ void Document::restore (const char *filename,
         signal = true;
         GetApplication().signalDeleteDocument(*this);
         d->clearDocument();
+        ObjectIdentifier::invalidateBindings();
     }
 
     Base::FlagToggler<> flag(globalIsRestoring, false);
@@ -2088,6 +2201,8 @@ void Document::restore (const char *filename,
 
     zipios::ZipInputStream zipstream(file);
     Base::XMLReader reader(filename, zipstream);
+    reader.setLazyFiles(App::GetApplication().GetParameterGroupByPath
+            ("User parameter:BaseApp/Preferences/Document")->GetBool("LazyRestore", false));
 
     if (!reader.isValid())
         throw Base::FileException("Error reading compression file",filename);
@@ -2114,6 +2229,7 @@ void Document::restore (const char *filename,
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
     reader.readFiles(zipstream);
+    d->deferredFiles = reader.hasDeferredFiles();
 
     if (reader.testStatus(Base::XMLReader::ReaderStatus::PartialRestore)) {
         setStatus(Document::PartialRestore, true);
@@ -2548,6 +2664,158 @@ std::vector<App::DocumentObject*> Document::getDependencyList(
     return ret;
 }
 
+// Repair the cached dependency order after 'obj' got a new dependency 'dep'
+// that is currently placed after it, following Pearce and Kelly's dynamic
+// topological sort. Only objects placed between the two are visited: those
+// depending on 'obj' are moved after those 'dep' depends on, reusing their
+// positions. Returns false on cyclic dependency.
+bool DocumentP::repairDependencyOrder(DocumentObject *obj, DocumentObject *dep)
+{
+    std::size_t lower = dependencyPos[obj];
+    std::size_t upper = dependencyPos[dep];
+
+    std::vector<DocumentObject*> forward;
+    std::unordered_set<DocumentObject*> forwardSet {obj};
+    std::vector<DocumentObject*> stack {obj};
+    while (!stack.empty()) {
+        auto cur = stack.back();
+        stack.pop_back();
+        forward.push_back(cur);
+        for (auto inObj : cur->getInList()) {
+            auto it = dependencyPos.find(inObj);
+            if (it == dependencyPos.end() || it->second < lower || it->second > upper)
+                continue;
+            if (inObj == dep)
+                return false;
+            if (forwardSet.insert(inObj).second)
+                stack.push_back(inObj);
+        }
+    }
+
+    std::vector<DocumentObject*> backward;
+    std::unordered_set<DocumentObject*> backwardSet {dep};
+    stack.push_back(dep);
+    while (!stack.empty()) {
+        auto cur = stack.back();
+        stack.pop_back();
+        backward.push_back(cur);
+        for (auto outObj : cur->getOutList()) {
+            auto it = dependencyPos.find(outObj);
+            if (it == dependencyPos.end() || it->second < lower || it->second > upper)
+                continue;
+            if (forwardSet.count(outObj))
+                return false;
+            if (backwardSet.insert(outObj).second)
+                stack.push_back(outObj);
+        }
+    }
+
+    auto byPosition = [this](DocumentObject *a, DocumentObject *b) {
+        return dependencyPos[a] < dependencyPos[b];
+    };
+    std::sort(forward.begin(), forward.end(), byPosition);
+    std::sort(backward.begin(), backward.end(), byPosition);
+
+    std::vector<std::size_t> slots;
+    slots.reserve(forward.size() + backward.size());
+    for (auto o : backward)
+        slots.push_back(dependencyPos[o]);
+    for (auto o : forward)
+        slots.push_back(dependencyPos[o]);
+    std::sort(slots.begin(), slots.end());
+
+    auto slot = slots.begin();
+    for (auto objs : {&backward, &forward}) {
+        for (auto o : *objs) {
+            dependencyOrder[*slot] = o;
+            dependencyPos[o] = *slot++;
+        }
+    }
+    return true;
+}
+
+const std::vector<DocumentObject*> &DocumentP::getDependencyOrder(int options)
+{
+    // an order built with other options has to be rebuilt
+    if (dependencyOrderValid && options != dependencyOptions)
+        invalidateDependencyOrder();
+
+    if (dependencyOrderValid) {
+        for (auto dirty : dependencyDirty) {
+            auto it = dependencyPos.find(dirty);
+            if (it == dependencyPos.end())
+                continue;
+            auto obj = dependencyOrder[it->second];
+            for (auto dep : obj->getOutList()) {
+                if (!dep || !dep->isAttachedToDocument())
+                    continue;
+                auto itDep = dependencyPos.find(dep);
+                // dependency on external object or itself, let getDependencyList() handle it
+                if (itDep == dependencyPos.end() || dep == obj) {
+                    dependencyOrderValid = false;
+                    break;
+                }
+                if (itDep->second > dependencyPos[obj] && !repairDependencyOrder(obj, dep)) {
+                    dependencyOrderValid = false;
+                    break;
+                }
+            }
+            if (!dependencyOrderValid)
+                break;
+            for (auto inObj : obj->getInList()) {
+                auto itIn = dependencyPos.find(inObj);
+                if (itIn != dependencyPos.end() && itIn->second < dependencyPos[obj]
+                        && !repairDependencyOrder(inObj, obj)) {
+                    dependencyOrderValid = false;
+                    break;
+                }
+            }
+            if (!dependencyOrderValid)
+                break;
+        }
+        dependencyDirty.clear();
+
+        if (dependencyOrderValid && !dependencyOrderCompact) {
+            dependencyOrder.erase(std::remove(dependencyOrder.begin(), dependencyOrder.end(), nullptr),
+                                  dependencyOrder.end());
+            for (std::size_t i = 0; i < dependencyOrder.size(); ++i)
+                dependencyPos[dependencyOrder[i]] = i;
+            dependencyOrderCompact = true;
+        }
+        if (dependencyOrderValid)
+            return dependencyOrder;
+    }
+
+    invalidateDependencyOrder();
+    dependencyOrder = Document::getDependencyList(objectArray, Document::DepSort | options);
+    dependencyOptions = options;
+    dependencyOrderCompact = true;
+    for (std::size_t i = 0; i < dependencyOrder.size(); ++i)
+        dependencyPos[dependencyOrder[i]] = i;
+
+    // Only keep the order for patching if it is a valid topological order of
+    // objects of this document only, i.e. no external or cyclic dependency.
+    dependencyOrderValid = dependencyOrder.size() == objectArray.size();
+    for (std::size_t i = 0; dependencyOrderValid && i < dependencyOrder.size(); ++i) {
+        for (auto dep : dependencyOrder[i]->getOutList()) {
+            if (!dep || !dep->isAttachedToDocument())
+                continue;
+            auto it = dependencyPos.find(dep);
+            if (it == dependencyPos.end() || it->second >= i) {
+                dependencyOrderValid = false;
+                break;
+            }
+        }
+    }
+    return dependencyOrder;
+}
+
+void Document::_outListChanged(const DocumentObject *Who)
+{
+    if (d->dependencyOrderValid)
+        d->dependencyDirty.insert(Who);
+}
+
 std::vector<App::Document*> Document::getDependentDocuments(bool sort) {
     return getDependentDocuments({this},sort);
 }
@@ -2782,6 +3050,32 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
 
 #else //ifdef USE_OLD_DAG
 
+// Stable sort the dependency ordered objects by their dependency depth, so
+// that each run of objects with the same depth forms a ready set of mutually
+// independent objects. Returns the depth of each sorted object.
+static std::vector<int> _sortByReadySet(std::vector<App::DocumentObject*> &objs)
+{
+    std::unordered_map<App::DocumentObject*, int> depths;
+    for (auto obj : objs) {
+        int depth = 0;
+        for (auto dep : obj->getOutList()) {
+            auto it = depths.find(dep);
+            if (it != depths.end())
+                depth = std::max(depth, it->second + 1);
+        }
+        depths[obj] = depth;
+    }
+    std::stable_sort(objs.begin(), objs.end(),
+        [&depths](App::DocumentObject *a, App::DocumentObject *b) {
+            return depths[a] < depths[b];
+        });
+    std::vector<int> res;
+    res.reserve(objs.size());
+    for (auto obj : objs)
+        res.push_back(depths[obj]);
+    return res;
+}
+
 int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool force, bool *hasError, int options)
 {
     if (d->undoing || d->rollback) {
@@ -2835,7 +3129,8 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
     }
     std::reverse(topoSortedObjects.begin(),topoSortedObjects.end());
 #else
-    auto topoSortedObjects = getDependencyList(objs.empty()?d->objectArray:objs,DepSort|options);
+    auto topoSortedObjects = objs.empty() ? d->getDependencyOrder(options)
+                                          : getDependencyList(objs,DepSort|options);
 #endif
     for(auto obj : topoSortedObjects)
         obj->setStatus(ObjectStatus::PendingRecompute,true);
@@ -2844,6 +3139,12 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
             "User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute",true);
 
+    std::vector<int> readySets;
+    if (hGrp->GetBool("ParallelRecompute", false))
+        readySets = _sortByReadySet(topoSortedObjects);
+    size_t readySetEnd = 0;
+    d->recomputePass = 0;
+
     std::set<App::DocumentObject *> filter;
     size_t idx = 0;
 
@@ -2857,16 +3158,50 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
                 seq = std::make_unique<Base::SequencerLauncher>("Recompute...", topoSortedObjects.size());
             }
             FC_LOG("Recompute pass " << passes);
+            d->recomputePass = passes;
+            readySetEnd = idx;
             for (; idx < topoSortedObjects.size(); ++idx) {
+                if (!readySets.empty() && idx >= readySetEnd) {
+                    // execute the eligible objects of the next ready set at once
+                    std::vector<DocumentObject*> concurrentObjs;
+                    for (readySetEnd = idx; readySetEnd < topoSortedObjects.size()
+                            && readySets[readySetEnd] == readySets[idx]; ++readySetEnd)
+                    {
+                        auto obj = topoSortedObjects[readySetEnd];
+                        if (obj->isAttachedToDocument() && !filter.count(obj)
+                                && obj->canRecomputeConcurrently() && obj->mustRecompute())
+                            concurrentObjs.push_back(obj);
+                    }
+                    if (concurrentObjs.size() > 1)
+                        _recomputeConcurrently(concurrentObjs);
+                }
                 auto obj = topoSortedObjects[idx];
                 if(!obj->isAttachedToDocument() || filter.find(obj)!=filter.end())
                     continue;
+                auto concurrent = d->concurrentRecomputes.find(obj);
                 // ask the object if it should be recomputed
                 bool doRecompute = false;
-                if (obj->mustRecompute()) {
+                if (concurrent != d->concurrentRecomputes.end() || obj->mustRecompute()) {
                     doRecompute = true;
                     ++objectCount;
-                    int res = _recomputeFeature(obj);
+                    int res;
+                    if (concurrent != d->concurrentRecomputes.end()) {
+                        // replay the queued notifications in topological order
+                        for (auto &change : concurrent->second.changes) {
+                            if (change.second) {
+                                signalBeforeChangeObject(*obj, *change.first);
+                                obj->signalBeforeChange(*obj, *change.first);
+                            }
+                            else {
+                                onChangedProperty(obj, change.first);
+                                obj->signalChanged(*obj, *change.first);
+                            }
+                        }
+                        res = concurrent->second.result;
+                        d->concurrentRecomputes.erase(concurrent);
+                    }
+                    else
+                        res = _recomputeFeature(obj);
                     if(res) {
                         if(hasError)
                             *hasError = true;
@@ -2885,8 +3220,7 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
                     signalRecomputedObject(*obj);
                     obj->purgeTouched();
                     // set all dependent object touched to force recompute
-                    for (auto inObjIt : obj->getInList())
-                        inObjIt->enforceRecompute();
+                    obj->enforceDependentRecompute();
                 }
                 if (seq)
                     seq->next(true);
@@ -2912,6 +3246,9 @@ int Document::recompute(const std::vector<App::DocumentObject*> &objs, bool forc
     }catch(Base::Exception &e) {
         e.ReportException();
     }
+    d->concurrentRecomputes.clear();
+    if (d->recomputeProfile)
+        d->recomputeProfile->finish(d->recomputePass + 1);
 
     FC_TIME_LOG(t2, "Recompute");
 
@@ -3135,6 +3472,17 @@ int Document::_recomputeFeature(DocumentObject* Feat)
 {
     FC_LOG("Recomputing " << Feat->getFullName());
 
+    if (d->recomputeProfile) {
+        d->recomputeProfile->beginObject(Feat, d->recomputePass);
+        int res = _executeFeature(Feat);
+        d->recomputeProfile->endObject(res != 0);
+        return res;
+    }
+    return _executeFeature(Feat);
+}
+
+int Document::_executeFeature(DocumentObject* Feat)
+{
     DocumentObjectExecReturn  *returnCode = nullptr;
     try {
         returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
@@ -3186,6 +3534,48 @@ int Document::_recomputeFeature(DocumentObject* Feat)
     return 0;
 }
 
+void Document::_recomputeConcurrently(const std::vector<DocumentObject*> &objs)
+{
+    ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Document");
+    int threads = hGrp->GetInt("RecomputeThreads", 0);
+    if (threads <= 0)
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::max(1, std::min(threads, static_cast<int>(objs.size())));
+
+    FC_LOG("Recompute " << objs.size() << " objects on " << threads << " threads");
+
+    // create all entries up front, so that the map is only read by the workers
+    for (auto obj : objs)
+        d->concurrentRecomputes[obj] = ConcurrentRecompute();
+
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < objs.size(); i = next++) {
+            _ConcurrentRecompute = &d->concurrentRecomputes.find(objs[i])->second;
+            _ConcurrentRecompute->result = _recomputeFeature(objs[i]);
+            _ConcurrentRecompute = nullptr;
+        }
+    };
+
+    // the workers may need the interpreter, e.g. for expressions
+    std::unique_ptr<Base::PyGILStateRelease> release;
+    if (Py_IsInitialized() && PyGILState_Check())
+        release = std::make_unique<Base::PyGILStateRelease>();
+
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; ++i)
+        pool.emplace_back(worker);
+    worker();
+    for (auto &thread : pool)
+        thread.join();
+}
+
+void Document::setRecomputeProfile(RecomputeProfile *profile)
+{
+    d->recomputeProfile = profile;
+}
+
 bool Document::recomputeFeature(DocumentObject* Feat, bool recursive)
 {
     // delete recompute log
@@ -3245,6 +3635,7 @@ DocumentObject * Document::addObject(const char* sType, const char* pObjectName,
 
     // insert in the name map
     d->objectMap[ObjectName] = pcObject;
+    ObjectIdentifier::invalidateBindings();
     // generate object id and add to id map;
     pcObject->_Id = ++d->lastObjectId;
     d->objectIdMap[pcObject->_Id] = pcObject;
@@ -3252,6 +3643,7 @@ DocumentObject * Document::addObject(const char* sType, const char* pObjectName,
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    d->addDependencyObject(pcObject);
 
     // If we are restoring, don't set the Label object now; it will be restored later. This is to avoid potential duplicate
     // label conflicts later.
@@ -3349,6 +3741,7 @@ std::vector<DocumentObject *> Document::addObjects(const char* sType, const std:
 
         // insert in the name map
         d->objectMap[ObjectName] = pcObject;
+        ObjectIdentifier::invalidateBindings();
         // generate object id and add to id map;
         pcObject->_Id = ++d->lastObjectId;
         d->objectIdMap[pcObject->_Id] = pcObject;
@@ -3356,6 +3749,7 @@ std::vector<DocumentObject *> Document::addObjects(const char* sType, const std:
         pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
         // insert in the vector
         d->objectArray.push_back(pcObject);
+        d->addDependencyObject(pcObject);
 
         pcObject->Label.setValue(ObjectName);
 
@@ -3413,6 +3807,7 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
 
     // insert in the name map
     d->objectMap[ObjectName] = pcObject;
+    ObjectIdentifier::invalidateBindings();
     // generate object id and add to id map;
     if(!pcObject->_Id) pcObject->_Id = ++d->lastObjectId;
     d->objectIdMap[pcObject->_Id] = pcObject;
@@ -3420,6 +3815,7 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    d->addDependencyObject(pcObject);
 
     pcObject->Label.setValue( ObjectName );
 
@@ -3443,10 +3839,12 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
 {
     std::string ObjectName = getUniqueObjectName(pObjectName);
     d->objectMap[ObjectName] = pcObject;
+    ObjectIdentifier::invalidateBindings();
     // generate object id and add to id map;
     if(!pcObject->_Id) pcObject->_Id = ++d->lastObjectId;
     d->objectIdMap[pcObject->_Id] = pcObject;
     d->objectArray.push_back(pcObject);
+    d->addDependencyObject(pcObject);
     // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
 
@@ -3559,6 +3957,7 @@ void Document::removeObject(const char* sName)
     for (std::vector<DocumentObject*>::iterator obj = d->objectArray.begin(); obj != d->objectArray.end(); ++obj) {
         if (*obj == pos->second) {
             d->objectArray.erase(obj);
+            d->removeDependencyObject(pos->second);
             break;
         }
     }
@@ -3568,6 +3967,7 @@ void Document::removeObject(const char* sName)
         tobedestroyed->pcNameInDocument = nullptr;
     }
     d->objectMap.erase(pos);
+    ObjectIdentifier::invalidateBindings();
 }
 
 /// Remove an object out of the document (internal)
@@ -3632,10 +4032,12 @@ void Document::_removeObject(DocumentObject* pcObject)
     pcObject->setStatus(ObjectStatus::Remove, false); // Unset the bit to be on the safe side
     d->objectIdMap.erase(pcObject->_Id);
     d->objectMap.erase(pos);
+    ObjectIdentifier::invalidateBindings();
 
     for (std::vector<DocumentObject*>::iterator it = d->objectArray.begin(); it != d->objectArray.end(); ++it) {
         if (*it == pcObject) {
             d->objectArray.erase(it);
+            d->removeDependencyObject(pcObject);
             break;
         }
     }
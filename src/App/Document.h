@@ -49,6 +49,7 @@ namespace App
     class Document;
     class DocumentPy; // the python document class
     class Application;
+    class RecomputeProfile;
     class Transaction;
     class StringHasher;
     using StringHasherRef = Base::Reference<StringHasher>;
@@ -120,6 +121,11 @@ public:
     PropertyBool ShowHidden;
     /// Whether to use hasher on topological naming
     PropertyBool UseHasher;
+    /** Whether to store shapes in binary format
+     * Meshes and points are then stored in the compact format if the
+     * preference 'SaveCompactMesh' is set, which older versions cannot read.
+     */
+    PropertyBool BinaryStorage;
     //@}
 
     /** @name Signals of the document */
@@ -347,11 +353,25 @@ public:
      *
      * @param objs: specify a sub set of objects to recompute. If empty, then
      * all object in this document is checked for recompute
+     *
+     * If the parameter 'ParallelRecompute' in 'BaseApp/Preferences/Document'
+     * is enabled, the dependency ordered objects are grouped into ready sets
+     * of mutually independent objects, and those objects of a set that
+     * return true in DocumentObject::canRecomputeConcurrently() are executed
+     * on a pool of 'RecomputeThreads' worker threads (0 for the number of
+     * cores). Signals of these objects are still emitted in topological order
+     * on the calling thread.
      */
     int recompute(const std::vector<App::DocumentObject*> &objs={},
             bool force=false,bool *hasError=nullptr, int options=0);
     /// Recompute only one feature
     bool recomputeFeature(DocumentObject* Feat,bool recursive=false);
+    /** Collect timing of the following recomputes into the given profile
+     *
+     * @param profile: the profile to fill, or nullptr to stop profiling. The
+     * caller keeps the ownership.
+     */
+    void setRecomputeProfile(RecomputeProfile *profile);
     /// get the text of the error of a specified object
     const char* getErrorDescription(const App::DocumentObject*) const;
     /// return the status bits
@@ -406,10 +426,27 @@ public:
     /// Check if a transaction is open and its list is empty.
     /// If no transaction is open true is returned.
     bool isTransactionEmpty() const;
-    /// Set the Undo limit in Byte!
-    void setUndoLimit(unsigned int UndoMemSize=0);
+    /** Set the Undo limit in Byte!
+     * If the Undo/Redo stacks exceed the limit after committing a transaction the
+     * oldest transactions get removed. 0 means no limit.
+     */
+    void setUndoLimit(std::size_t UndoMemSize=0);
+    /// Returns the Undo limit in Byte
+    std::size_t getUndoLimit() const;
     /// Returns the actual memory consumption of the Undo redo stuff.
-    unsigned int getUndoMemSize () const;
+    std::size_t getUndoMemSize () const;
+    /// Memory statistics of the Undo/Redo stacks
+    struct UndoStats {
+        int undoCount = 0;
+        int redoCount = 0;
+        /// memory of the Undo stack in byte, without data shared with the document
+        std::size_t undoMemSize = 0;
+        /// memory of the Redo stack in byte, without data shared with the Undo stack
+        std::size_t redoMemSize = 0;
+        /// number of transactions removed to stay within the Undo limit
+        int evicted = 0;
+    };
+    UndoStats getUndoStats() const;
     /// Set the Undo limit as stack size
     void setMaxUndoStackSize(unsigned int UndoMaxStackSize=20);
     /// Set the Undo limit as stack size
@@ -570,6 +607,17 @@ protected:
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
+    /// executes the feature and handles its errors, called by _recomputeFeature()
+    int _executeFeature(DocumentObject* Feat);
+    /// recompute the given mutually independent objects on worker threads
+    void _recomputeConcurrently(const std::vector<DocumentObject*> &objs);
+    /** queue the property change notification if raised by an object that is
+     * recomputed on a worker thread
+     * @return true if the notification has been queued
+     */
+    bool _deferPropertyChange(const Property *What, bool before);
+    /// mark the cached dependency order to be checked for the given object
+    void _outListChanged(const DocumentObject *Who);
     void _clearRedos();
 
     /// refresh the internal dependency graph
@@ -255,6 +255,12 @@ void DocumentObject::enforceRecompute()
     touch(false);
 }
 
+void DocumentObject::enforceDependentRecompute()
+{
+    for (auto obj : getInList())
+        obj->enforceRecompute();
+}
+
 /**
  * @brief Check whether the document object must be recomputed or not.
  * This means that the 'Enforce' flag is set or that \ref mustExecute()
@@ -743,8 +749,11 @@ void DocumentObject::onBeforeChange(const Property* prop)
     if (prop == &Label)
         oldLabel = Label.getStrValue();
 
-    if (_pDoc)
+    if (_pDoc) {
         onBeforeChangeProperty(_pDoc, prop);
+        if (_pDoc->_deferPropertyChange(prop, true))
+            return;
+    }
 
     signalBeforeChange(*this,*prop);
 }
@@ -797,8 +806,10 @@ void DocumentObject::onChanged(const Property* prop)
     // if (_pDoc)
     //     _pDoc->onChangedProperty(this,prop);
 
-    if (prop == &Label && _pDoc && oldLabel != Label.getStrValue())
+    if (prop == &Label && _pDoc && oldLabel != Label.getStrValue()) {
+        ObjectIdentifier::invalidateBindings();
         _pDoc->signalRelabelObject(*this);
+    }
 
     // set object touched if it is an input property
     if (!testStatus(ObjectStatus::NoTouch) 
@@ -817,9 +828,13 @@ void DocumentObject::onChanged(const Property* prop)
     //call the parent for appropriate handling
     TransactionalObject::onChanged(prop);
 
-    // Now signal the view provider
-    if (_pDoc)
+    // Now signal the view provider, or let the document do it later if this
+    // object is recomputed on a worker thread
+    if (_pDoc) {
+        if (_pDoc->_deferPropertyChange(prop, false))
+            return;
         _pDoc->onChangedProperty(this,prop);
+    }
 
     signalChanged(*this,*prop);
 }
@@ -828,6 +843,8 @@ void DocumentObject::clearOutListCache() const {
     _outList.clear();
     _outListMap.clear();
     _outListCached = false;
+    if (_pDoc)
+        _pDoc->_outListChanged(this);
 }
 
 PyObject *DocumentObject::getPyObject()
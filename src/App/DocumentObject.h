@@ -161,8 +161,26 @@ public:
     bool isTouched() const;
     /// Enforce this document object to be recomputed
     void enforceRecompute();
+    /** Enforce the recompute of the objects depending on this object
+     *
+     * Called by the document after this object has been recomputed. The
+     * default enforces the recompute of the whole InList. Objects that know
+     * which of their properties changed may skip the unaffected dependents.
+     */
+    virtual void enforceDependentRecompute();
     /// Test if this document object must be recomputed
     bool mustRecompute() const;
+    /** Test if this object may be recomputed on a worker thread
+     *
+     * During a parallel document recompute, objects returning true here are
+     * executed concurrently with other independent objects. The object must
+     * then only change its own properties, must not modify any links and
+     * must not access shared resources like the document string hasher.
+     * Change notifications are delayed until the execution has finished.
+     */
+    virtual bool canRecomputeConcurrently() const {
+        return false;
+    }
     /// reset this document object touched
     void purgeTouched() {
         StatusBits.reset(ObjectStatus::Touch);
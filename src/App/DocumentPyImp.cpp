@@ -31,6 +31,7 @@
 #include "DocumentObject.h"
 #include "DocumentObjectPy.h"
 #include "MergeDocuments.h"
+#include "RecomputeProfile.h"
 
 // inclusion of the generated files (generated By DocumentPy.xml)
 #include "DocumentPy.h"
@@ -556,15 +557,28 @@ PyObject* DocumentPy::isClosable(PyObject* args)
     return Py::new_reference_to(Py::Boolean(ok));
 }
 
-PyObject*  DocumentPy::recompute(PyObject * args)
+PyObject*  DocumentPy::recompute(PyObject * args, PyObject * kwd)
 {
     PyObject *pyobjs = Py_None;
     PyObject *force = Py_False;
     PyObject *checkCycle = Py_False;
-    if (!PyArg_ParseTuple(args, "|OO!O!",&pyobjs,
-                &PyBool_Type,&force,&PyBool_Type,&checkCycle))
+    PyObject *profile = Py_False;
+    PyObject *trace = Py_None;
+    static const std::array<const char *, 6> kwlist{"objs", "force", "checkCycle", "profile", "trace",
+                                                    nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args, kwd, "|OO!O!O!O", kwlist, &pyobjs,
+                &PyBool_Type, &force, &PyBool_Type, &checkCycle, &PyBool_Type, &profile, &trace))
         return nullptr;
 
+    std::string traceFile;
+    if (trace != Py_None) {
+        if (!PyUnicode_Check(trace)) {
+            PyErr_SetString(PyExc_TypeError, "expect trace to be a file name or None");
+            return nullptr;
+        }
+        traceFile = PyUnicode_AsUTF8(trace);
+    }
+
     PY_TRY {
         std::vector<App::DocumentObject *> objs;
         if (pyobjs!=Py_None) {
@@ -587,7 +601,21 @@ PyObject*  DocumentPy::recompute(PyObject * args)
         if (Base::asBoolean(checkCycle))
             options = Document::DepNoCycle;
 
-        int objectCount = getDocumentPtr()->recompute(objs, Base::asBoolean(force), nullptr, options);
+        std::unique_ptr<RecomputeProfile> recomputeProfile;
+        if (Base::asBoolean(profile) || !traceFile.empty()) {
+            recomputeProfile = std::make_unique<RecomputeProfile>();
+            getDocumentPtr()->setRecomputeProfile(recomputeProfile.get());
+        }
+
+        int objectCount = 0;
+        try {
+            objectCount = getDocumentPtr()->recompute(objs, Base::asBoolean(force), nullptr, options);
+        }
+        catch (...) {
+            getDocumentPtr()->setRecomputeProfile(nullptr);
+            throw;
+        }
+        getDocumentPtr()->setRecomputeProfile(nullptr);
 
         // Document::recompute() hides possibly raised Python exceptions by its features
         // So, check if an error is set and return null if yes
@@ -595,7 +623,42 @@ PyObject*  DocumentPy::recompute(PyObject * args)
             return nullptr;
         }
 
-        return Py::new_reference_to(Py::Int(objectCount));
+        if (!recomputeProfile)
+            return Py::new_reference_to(Py::Int(objectCount));
+
+        if (!traceFile.empty()) {
+            Base::FileInfo fi(traceFile);
+            Base::ofstream str(fi, std::ios::out | std::ios::binary);
+            if (!str)
+                throw Base::FileException("Failed to open trace file", fi);
+            recomputeProfile->writeChromeTrace(str);
+        }
+
+        Py::List entries;
+        for (const auto &entry : recomputeProfile->getEntries()) {
+            Py::Dict dict;
+            dict.setItem("Object", Py::String(entry.object));
+            dict.setItem("Label", Py::String(entry.label));
+            dict.setItem("Pass", Py::Long(entry.pass));
+            dict.setItem("Thread", Py::Long(entry.thread));
+            dict.setItem("Start", Py::Float(entry.start));
+            dict.setItem("Duration", Py::Float(entry.duration));
+            dict.setItem("PythonTime", Py::Float(entry.pythonTime));
+            dict.setItem("MemoryDelta", Py::Long(entry.memoryDelta));
+            dict.setItem("Error", Py::Boolean(entry.error));
+            Py::List touchedBy;
+            for (const auto &name : entry.touchedBy)
+                touchedBy.append(Py::String(name));
+            dict.setItem("TouchedBy", touchedBy);
+            entries.append(dict);
+        }
+        Py::Dict res;
+        res.setItem("Count", Py::Long(objectCount));
+        res.setItem("Passes", Py::Long(recomputeProfile->getPasses()));
+        res.setItem("TotalTime", Py::Float(recomputeProfile->getTotalTime()));
+        res.setItem("MemoryDelta", Py::Long(recomputeProfile->getMemoryDelta()));
+        res.setItem("Objects", entries);
+        return Py::new_reference_to(res);
     } PY_CATCH;
 }
 
@@ -786,6 +849,19 @@ Py::Int DocumentPy::getUndoRedoMemSize() const
     return Py::Int((long)getDocumentPtr()->getUndoMemSize());
 }
 
+Py::Int DocumentPy::getUndoLimit() const
+{
+    return Py::Int((long)getDocumentPtr()->getUndoLimit());
+}
+
+void DocumentPy::setUndoLimit(Py::Int arg)
+{
+    long limit = arg;
+    if (limit < 0)
+        throw Py::ValueError("Undo limit must not be negative");
+    getDocumentPtr()->setUndoLimit(static_cast<std::size_t>(limit));
+}
+
 Py::Int DocumentPy::getUndoCount() const
 {
     return Py::Int((long)getDocumentPtr()->getAvailableUndos());
@@ -969,6 +1045,23 @@ Py::List DocumentPy::getOutList() const
     return ret;
 }
 
+PyObject *DocumentPy::getUndoStats(PyObject *args) {
+    if (!PyArg_ParseTuple(args, ""))
+        return nullptr;
+    PY_TRY {
+        auto doc = getDocumentPtr();
+        auto stats = doc->getUndoStats();
+        Py::Dict ret;
+        ret.setItem("UndoCount", Py::Long(stats.undoCount));
+        ret.setItem("RedoCount", Py::Long(stats.redoCount));
+        ret.setItem("UndoMemSize", Py::Long(static_cast<unsigned long>(stats.undoMemSize)));
+        ret.setItem("RedoMemSize", Py::Long(static_cast<unsigned long>(stats.redoMemSize)));
+        ret.setItem("UndoLimit", Py::Long(static_cast<unsigned long>(doc->getUndoLimit())));
+        ret.setItem("Evicted", Py::Long(stats.evicted));
+        return Py::new_reference_to(ret);
+    } PY_CATCH;
+}
+
 PyObject *DocumentPy::getDependentDocuments(PyObject *args) {
     PyObject *sort = Py_True;
     if (!PyArg_ParseTuple(args, "|O!", &PyBool_Type, &sort))
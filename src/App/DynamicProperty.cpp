@@ -29,6 +29,7 @@
 
 #include "DynamicProperty.h"
 #include "Application.h"
+#include "ObjectIdentifier.h"
 #include "Property.h"
 #include "PropertyContainer.h"
 
@@ -202,6 +203,7 @@ Property* DynamicProperty::addDynamicProperty(PropertyContainer &pc, const char*
     pcProperty->syncType(attr);
     pcProperty->StatusBits.set((size_t)Property::PropDynamic);
 
+    ObjectIdentifier::invalidateBindings();
     GetApplication().signalAppendDynamicProperty(*pcProperty);
 
     return pcProperty;
@@ -240,6 +242,7 @@ bool DynamicProperty::removeDynamicProperty(const char* name)
         else if(!it->property->testStatus(Property::PropDynamic))
             throw Base::RuntimeError("property is not dynamic");
         Property *prop = it->property;
+        ObjectIdentifier::invalidateBindings();
         GetApplication().signalRemoveDynamicProperty(*prop);
 
         // Handle possible recursive calls of removeDynamicProperty
@@ -1364,11 +1364,9 @@ bool OperatorExpression::isTouched() const
     return left->isTouched() || right->isTouched();
 }
 
-static Py::Object calc(const Expression *expr, int op,
-                 const Expression *left, const Expression *right, bool inplace)
+Py::Object OperatorExpression::calc(const Expression *expr, Operator op,
+                 Py::Object l, const Py::Object &r, bool inplace)
 {
-    Py::Object l = left->getPyValue();
-
     // For security reason, restrict supported types
     if(!PyObject_TypeCheck(l.ptr(),&PyObjectBase::Type)
             && !l.isNumeric() && !l.isString() && !l.isList() && !l.isDict())
@@ -1391,7 +1389,6 @@ static Py::Object calc(const Expression *expr, int op,
         break;
     }
 
-    Py::Object r = right->getPyValue();
     // For security reason, restrict supported types
     if((op!=OperatorExpression::MOD || !l.isString())
             && !PyObject_TypeCheck(r.ptr(),&PyObjectBase::Type)
@@ -1477,7 +1474,10 @@ static Py::Object calc(const Expression *expr, int op,
 }
 
 Py::Object OperatorExpression::_getPyValue() const {
-    return calc(this,op,left,right,false);
+    Py::Object l = left->getPyValue();
+    if(isUnary(op))
+        return calc(this,op,l,Py::Object());
+    return calc(this,op,l,right->getPyValue());
 }
 
 /**
@@ -188,6 +188,19 @@ public:
 
     Expression * getRight() const { return right; }
 
+    static bool isUnary(Operator op) { return op == NEG || op == POS; }
+
+    /** Apply an operator to evaluated operands
+     *
+     * @param expr: expression reported in error messages
+     * @param op: the operator
+     * @param left: left or only operand
+     * @param right: right operand, ignored by unary operators
+     * @param inplace: whether to use the in-place version of the operator
+     */
+    static Py::Object calc(const Expression *expr, Operator op,
+            Py::Object left, const Py::Object &right, bool inplace=false);
+
 protected:
     Expression * _copy() const override;
 
@@ -221,6 +234,12 @@ public:
 
     int priority() const override;
 
+    Expression * getCondition() const { return condition; }
+
+    Expression * getTrueExpression() const { return trueExpr; }
+
+    Expression * getFalseExpression() const { return falseExpr; }
+
 protected:
     Expression * _copy() const override;
     void _visit(ExpressionVisitor & v) override;
@@ -33,6 +33,7 @@
 
 #include "FeaturePython.h"
 #include "FeaturePythonPyImp.h"
+#include "RecomputeProfile.h"
 
 
 using namespace App;
@@ -76,6 +77,8 @@ bool FeaturePythonImp::execute()
 {
     FC_PY_CALL_CHECK(execute)
     Base::PyGILStateLocker lock;
+    // started after the lock, so waiting for the GIL is not billed as Python time
+    RecomputeProfile::PythonTimer timer;
     try {
         if (has__object__) {
             Py::Object res = Base::pyCall(py_execute.ptr());
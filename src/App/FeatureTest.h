@@ -199,6 +199,9 @@ public:
     /** @name methods override Feature */
     //@{
     DocumentObjectExecReturn *execute() override;
+    bool canRecomputeConcurrently() const override {
+        return true;
+    }
     //@}
 };
 
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <atomic>
 # include <cassert>
 #endif
 
@@ -1806,6 +1807,51 @@ Py::Object ObjectIdentifier::getPyValue(bool pathValue, bool *isPseudoProperty)
     return Py::Object();
 }
 
+// Incremented on any change that may alter the resolution of an identifier
+static std::atomic<unsigned> _BindingRevision(1);
+
+void ObjectIdentifier::invalidateBindings()
+{
+    ++_BindingRevision;
+}
+
+ObjectIdentifier::Binding::Binding(const ObjectIdentifier &path)
+    : path(path)
+{
+}
+
+ObjectIdentifier::Binding::~Binding() = default;
+
+Py::Object ObjectIdentifier::Binding::getPyValue() const
+{
+    if(!path.subObjectName.getString().empty())
+        return path.getPyValue(true);
+
+    unsigned current = _BindingRevision;
+    if(!results || revision != current) {
+        results = std::make_unique<ResolveResults>(path);
+        revision = current;
+    }
+    // Do not keep a failed resolution, access() reports the error
+    if(!results->resolvedProperty) {
+        std::unique_ptr<ResolveResults> rs(std::move(results));
+        return path.access(*rs);
+    }
+
+    if(results->propertyType==PseudoNone) {
+        Py::Object res;
+        if(results->resolvedProperty->getPyPathValue(path,res))
+            return res;
+    }
+
+    try {
+        return path.access(*results);
+    }catch(Py::Exception &) {
+        Base::PyException::ThrowException();
+    }
+    return Py::Object();
+}
+
 /**
  * @brief Set value of a property or field pointed to by this object identifier.
  *
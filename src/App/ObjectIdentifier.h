@@ -26,6 +26,7 @@
 
 #include <bitset>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -444,6 +445,11 @@ public:
 
     std::size_t hash() const;
 
+    class Binding;
+
+    /// Invalidate the resolution cached by all bindings
+    static void invalidateBindings();
+
 protected:
 
     struct ResolveResults {
@@ -499,6 +505,34 @@ private:
     std::size_t _hash; // Cached hash of this string
 };
 
+/** Value access of an object identifier with cached resolution
+ *
+ * Resolving an identifier looks up the document, object and property by name
+ * on every access. A binding keeps the result of the last resolution until
+ * ObjectIdentifier::invalidateBindings() is called, which happens on creation,
+ * deletion and relabeling of objects and documents, and on adding or removing
+ * dynamic properties. Identifiers with a sub-object path are resolved on each
+ * access, because the linked sub-object may change without notice.
+ */
+class AppExport ObjectIdentifier::Binding {
+public:
+    explicit Binding(const ObjectIdentifier &path);
+    ~Binding();
+
+    Binding(const Binding &) = delete;
+    Binding &operator=(const Binding &) = delete;
+
+    /// Same as ObjectIdentifier::getPyValue(true)
+    Py::Object getPyValue() const;
+
+    const ObjectIdentifier &getPath() const { return path; }
+
+private:
+    ObjectIdentifier path;
+    mutable std::unique_ptr<ResolveResults> results;
+    mutable unsigned revision{0};
+};
+
 inline std::size_t hash_value(const App::ObjectIdentifier & path) {
     return path.hash();
 }
@@ -32,6 +32,7 @@
 #include <CXX/Objects.hxx>
 
 #include "PropertyExpressionEngine.h"
+#include "CompiledExpression.h"
 #include "ExpressionVisitors.h"
 
 
@@ -129,6 +130,10 @@ Property *PropertyExpressionEngine::Copy() const
 
 void PropertyExpressionEngine::hasSetValue()
 {
+    // Expressions may have been modified in place
+    for(auto &e : expressions)
+        e.second.compiled.reset();
+
     App::DocumentObject *owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if(!owner || !owner->isAttachedToDocument() || owner->isRestoring() || testFlag(LinkDetached)) {
         PropertyExpressionContainer::hasSetValue();
@@ -675,9 +680,14 @@ DocumentObjectExecReturn *App::PropertyExpressionEngine::execute(ExecuteOption o
         App::any value;
         try {
             // Evaluate expression
-            std::shared_ptr<App::Expression> expression = expressions[*it].expression;
-            if (expression) {
-                value = expression->getValueAsAny();
+            ExpressionInfo &info = expressions[*it];
+            if (info.expression) {
+                if (!info.compiled || info.compiled->getExpression() != info.expression.get())
+                    info.compiled = std::make_shared<CompiledExpression>(info.expression.get());
+                // Keep both alive in case the evaluation modifies the expressions
+                auto expression = info.expression;
+                auto compiled = info.compiled;
+                value = compiled->getValueAsAny();
 
                 // Enable value comparison for all expression bindings to reduce
                 // unnecessary touch and recompute.
@@ -42,6 +42,7 @@ class DocumentObject;
 class DocumentObjectExecReturn;
 class ObjectIdentifier;
 class Expression;
+class CompiledExpression;
 using ExpressionPtr = std::unique_ptr<Expression>;
 
 class AppExport PropertyExpressionContainer : public App::PropertyXLinkContainer
@@ -85,6 +86,9 @@ public:
 
     struct ExpressionInfo {
         std::shared_ptr<App::Expression> expression; /**< The actual expression tree */
+        /** Evaluation program of the expression, compiled on first execution
+         * and discarded on any change of the expressions */
+        std::shared_ptr<App::CompiledExpression> compiled;
         bool busy;
 
         explicit ExpressionInfo(std::shared_ptr<App::Expression> expression = std::shared_ptr<App::Expression>()) {
@@ -23,6 +23,9 @@
 
 #include "PreCompiled.h"
 
+#include <mutex>
+
+#include <Base/Console.h>
 #include <Base/MatrixPy.h>
 #include <Base/PlacementPy.h>
 #include <Base/Reader.h>
@@ -1288,6 +1291,8 @@ bool PropertyComplexGeoData::checkElementMapVersion(const char * ver) const
 
 void PropertyComplexGeoData::afterRestore()
 {
+    // only the element map is checked, which is restored in any case
+    Base::FlagToggler<bool> flag(suspendDeferred, false);
     auto data = getComplexData();
     if (data && data->isRestoreFailed()) {
         data->resetRestoreFailure();
@@ -1300,3 +1305,75 @@ void PropertyComplexGeoData::afterRestore()
     }
     PropertyGeometry::afterRestore();
 }
+
+namespace {
+std::recursive_mutex deferredMutex;
+}
+
+bool PropertyComplexGeoData::isDeferred() const
+{
+    return hasDeferredFile;
+}
+
+const void* PropertyComplexGeoData::getSharingKey() const
+{
+    return isDeferred() ? nullptr : getComplexData();
+}
+
+bool PropertyComplexGeoData::setDeferredFile(const std::shared_ptr<Base::DeferredFile>& file)
+{
+    std::lock_guard<std::recursive_mutex> lock(deferredMutex);
+    deferredFile = file;
+    hasDeferredFile = static_cast<bool>(file);
+    return hasDeferredFile;
+}
+
+void PropertyComplexGeoData::restoreDeferred() const
+{
+    if (!hasDeferredFile || suspendDeferred) {
+        return;
+    }
+
+    // the data may be accessed by concurrent recomputes
+    std::lock_guard<std::recursive_mutex> lock(deferredMutex);
+    if (!deferredFile) {
+        return;
+    }
+    auto self = const_cast<PropertyComplexGeoData*>(this);  // NOLINT
+    auto file = std::move(self->deferredFile);
+    self->deferredFile.reset();
+    try {
+        file->read([self](Base::Reader& reader) {
+            self->restoreDeferredFile(reader);
+        });
+    }
+    catch (const Base::Exception& e) {
+        Base::Console().Error("Failed to restore %s: %s\n", getFullName().c_str(), e.what());
+    }
+    catch (const std::exception& e) {
+        Base::Console().Error("Failed to restore %s: %s\n", getFullName().c_str(), e.what());
+    }
+    self->hasDeferredFile = false;
+}
+
+void PropertyComplexGeoData::discardDeferred()
+{
+    if (hasDeferredFile) {
+        setDeferredFile(nullptr);
+    }
+}
+
+unsigned int PropertyComplexGeoData::getDeferredSize() const
+{
+    if (!hasDeferredFile) {
+        return 0;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(deferredMutex);
+    return deferredFile ? static_cast<unsigned int>(deferredFile->getSize()) : 0;
+}
+
+void PropertyComplexGeoData::restoreDeferredFile(Base::Reader& reader)
+{
+    RestoreDocFile(reader);
+}
@@ -24,6 +24,9 @@
 #ifndef APP_PROPERTYGEO_H
 #define APP_PROPERTYGEO_H
 
+#include <atomic>
+#include <memory>
+
 #include <Base/BoundBox.h>
 #include <Base/Matrix.h>
 #include <Base/Placement.h>
@@ -35,6 +38,8 @@
 
 
 namespace Base {
+class DeferredFile;
+class Reader;
 class Writer;
 }
 
@@ -552,6 +557,35 @@ public:
     virtual bool checkElementMapVersion(const char * ver) const;
 
     void afterRestore() override;
+
+    /// check if the data is still to be restored from a deferred file
+    bool isDeferred() const;
+
+    /** Return a key of the data that copies of this property share
+     * Used to count copy-on-write data only once in the memory statistics of
+     * the Undo/Redo stacks. Returns null if the data is still deferred.
+     */
+    virtual const void* getSharingKey() const;
+
+protected:
+    /** Keep the file to restore the data on first access
+     * Subclasses supporting lazy restore call this in their deferDocFile()
+     * and restoreDeferred() in every accessor of the data.
+     */
+    bool setDeferredFile(const std::shared_ptr<Base::DeferredFile>& file);
+    /// restore the data from the deferred file, if any
+    void restoreDeferred() const;
+    /// drop the deferred file because the data is replaced
+    void discardDeferred();
+    /// the size of the data still to be restored, to be added to getMemSize()
+    unsigned int getDeferredSize() const;
+    /// read the data of a deferred file without signaling a change
+    virtual void restoreDeferredFile(Base::Reader& reader);
+
+private:
+    std::shared_ptr<Base::DeferredFile> deferredFile;
+    std::atomic<bool> hasDeferredFile {false};
+    bool suspendDeferred {false};
 };
 
 } // namespace App
@@ -0,0 +1,205 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <iomanip>
+#endif
+
+#if defined(FC_OS_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "RecomputeProfile.h"
+#include "DocumentObject.h"
+
+
+using namespace App;
+
+namespace
+{
+
+struct RunningObject
+{
+    RecomputeProfile::Entry* entry = nullptr;
+    Base::TimeElapsed start;
+    long memory = 0;
+};
+
+// object executed by the current thread
+thread_local RunningObject _Running;
+
+void writeJsonString(std::ostream& str, const std::string& text)
+{
+    str << '"';
+    for (char c : text) {
+        switch (c) {
+            case '"':
+                str << "\\\"";
+                break;
+            case '\\':
+                str << "\\\\";
+                break;
+            case '\n':
+                str << "\\n";
+                break;
+            case '\t':
+                str << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    str << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                        << static_cast<int>(c) << std::dec << std::setfill(' ');
+                }
+                else {
+                    str << c;
+                }
+                break;
+        }
+    }
+    str << '"';
+}
+
+}  // namespace
+
+RecomputeProfile::RecomputeProfile()
+    : startMemory(getPeakMemory())
+{}
+
+void RecomputeProfile::beginObject(const DocumentObject* obj, int pass)
+{
+    Entry* entry {};
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entry = &entries.emplace_back();
+        auto id = std::this_thread::get_id();
+        auto it = std::find(threads.begin(), threads.end(), id);
+        entry->thread = static_cast<int>(it - threads.begin());
+        if (it == threads.end()) {
+            threads.push_back(id);
+        }
+        for (auto dep : obj->getOutList()) {
+            if (dep && executed.count(dep)) {
+                entry->touchedBy.push_back(dep->getFullName());
+            }
+        }
+        executed.insert(obj);
+    }
+    entry->object = obj->getFullName();
+    entry->label = obj->Label.getStrValue();
+    entry->pass = pass;
+
+    _Running.entry = entry;
+    _Running.memory = getPeakMemory();
+    _Running.start.setCurrent();
+    entry->start = Base::TimeElapsed::diffTimeF(startTime, _Running.start);
+}
+
+void RecomputeProfile::endObject(bool error)
+{
+    Entry* entry = _Running.entry;
+    if (!entry) {
+        return;
+    }
+    entry->duration = Base::TimeElapsed::diffTimeF(_Running.start);
+    entry->memoryDelta = getPeakMemory() - _Running.memory;
+    entry->error = error;
+    _Running.entry = nullptr;
+}
+
+void RecomputeProfile::finish(int passes)
+{
+    this->passes = passes;
+    totalTime = Base::TimeElapsed::diffTimeF(startTime);
+    memoryDelta = getPeakMemory() - startMemory;
+}
+
+void RecomputeProfile::writeChromeTrace(std::ostream& str) const
+{
+    // Complete events with durations in microseconds, one row per thread
+    str << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& entry : entries) {
+        if (!first) {
+            str << ',';
+        }
+        first = false;
+        str << "\n{\"name\":";
+        writeJsonString(str, entry.label);
+        str << ",\"cat\":\"recompute\",\"ph\":\"X\",\"pid\":0,\"tid\":" << entry.thread
+            << std::fixed << std::setprecision(0)
+            << ",\"ts\":" << entry.start * 1e6
+            << ",\"dur\":" << entry.duration * 1e6
+            << std::defaultfloat << std::setprecision(6)
+            << ",\"args\":{\"object\":";
+        writeJsonString(str, entry.object);
+        str << ",\"pass\":" << entry.pass
+            << ",\"python\":" << entry.pythonTime
+            << ",\"memory\":" << entry.memoryDelta
+            << ",\"error\":" << (entry.error ? "true" : "false")
+            << ",\"touchedBy\":[";
+        for (std::size_t i = 0; i < entry.touchedBy.size(); ++i) {
+            if (i > 0) {
+                str << ',';
+            }
+            writeJsonString(str, entry.touchedBy[i]);
+        }
+        str << "]}}";
+    }
+    str << "\n]}\n";
+}
+
+long RecomputeProfile::getPeakMemory()
+{
+#if defined(FC_OS_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+        return static_cast<long>(pmc.PeakWorkingSetSize / 1024);
+    }
+#else
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(FC_OS_MACOSX)
+        return static_cast<long>(usage.ru_maxrss / 1024);
+#else
+        return static_cast<long>(usage.ru_maxrss);
+#endif
+    }
+#endif
+    return 0;
+}
+
+RecomputeProfile::PythonTimer::PythonTimer()
+    : entry(_Running.entry)
+{}
+
+RecomputeProfile::PythonTimer::~PythonTimer()
+{
+    if (entry) {
+        entry->pythonTime += Base::TimeElapsed::diffTimeF(start);
+    }
+}
@@ -0,0 +1,138 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef APP_RECOMPUTEPROFILE_H
+#define APP_RECOMPUTEPROFILE_H
+
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include <Base/TimeInfo.h>
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class DocumentObject;
+
+/** Timing record of a document recompute
+ *
+ * Install an instance with Document::setRecomputeProfile() to collect the
+ * wall time of each executed object. For Python features the time spent in
+ * the Python execute() is recorded separately, the rest of the duration is
+ * native code, e.g. OCCT.
+ */
+class AppExport RecomputeProfile
+{
+public:
+    struct Entry
+    {
+        std::string object;
+        std::string label;
+        /// recompute pass of the document, starting with 0
+        int pass = 0;
+        /// index of the thread that executed the object, 0 for the calling thread
+        int thread = 0;
+        /// start time in seconds, relative to the start of the profile
+        double start = 0.0;
+        /// wall time of the execution in seconds
+        double duration = 0.0;
+        /// part of the duration spent in Python
+        double pythonTime = 0.0;
+        /// growth of the peak resident memory of the process in kB
+        long memoryDelta = 0;
+        /// dependencies recomputed before, empty if the object itself was touched
+        std::vector<std::string> touchedBy;
+        bool error = false;
+    };
+
+    RecomputeProfile();
+
+    /// start timing the execution of an object
+    void beginObject(const DocumentObject* obj, int pass);
+    /// finish timing the object started by the calling thread
+    void endObject(bool error);
+
+    /// finish the profile after the recompute
+    void finish(int passes);
+
+    const std::deque<Entry>& getEntries() const
+    {
+        return entries;
+    }
+    int getPasses() const
+    {
+        return passes;
+    }
+    /// total wall time in seconds
+    double getTotalTime() const
+    {
+        return totalTime;
+    }
+    /// growth of the peak resident memory of the process in kB
+    long getMemoryDelta() const
+    {
+        return memoryDelta;
+    }
+
+    /// write the profile in the Chrome trace event format (chrome://tracing)
+    void writeChromeTrace(std::ostream& str) const;
+
+    /// peak resident memory of the process in kB
+    static long getPeakMemory();
+
+    /// Accumulates the wall time of its scope as Python time of the executed object
+    class AppExport PythonTimer
+    {
+    public:
+        PythonTimer();
+        ~PythonTimer();
+
+        PythonTimer(const PythonTimer&) = delete;
+        PythonTimer(PythonTimer&&) = delete;
+        PythonTimer& operator=(const PythonTimer&) = delete;
+        PythonTimer& operator=(PythonTimer&&) = delete;
+
+    private:
+        Entry* entry;
+        Base::TimeElapsed start;
+    };
+
+private:
+    Base::TimeElapsed startTime;
+    long startMemory;
+    std::deque<Entry> entries;
+    std::vector<std::thread::id> threads;
+    std::unordered_set<const DocumentObject*> executed;
+    int passes = 0;
+    double totalTime = 0.0;
+    long memoryDelta = 0;
+    std::mutex mutex;
+};
+
+}  // namespace App
+
+#endif  // APP_RECOMPUTEPROFILE_H
@@ -37,6 +37,7 @@
 #include "Document.h"
 #include "DocumentObject.h"
 #include "Property.h"
+#include "PropertyGeo.h"
 
 
 FC_LOG_LEVEL_INIT("App",true,true)
@@ -111,7 +112,52 @@ int Transaction::getLastID() {
 
 unsigned int Transaction::getMemSize () const
 {
-    return 0;
+    std::unordered_set<const void*> counted;
+    return static_cast<unsigned int>(getMemSize(counted));
+}
+
+static const void* getSharingKey(const Property* prop)
+{
+    // copy-on-write geometry is shared by the values of several transactions
+    // and the document, use the shared data as key to count it only once
+    auto geo = dynamic_cast<const PropertyComplexGeoData*>(prop);
+    if (geo) {
+        if (auto data = geo->getSharingKey())
+            return data;
+    }
+    return prop;
+}
+
+std::size_t Transaction::getMemSize(std::unordered_set<const void*>& counted) const
+{
+    if (!_MemSizesValid) {
+        _MemSizes.clear();
+        auto addProperty = [this](const Property* prop) {
+            _MemSizes.emplace_back(getSharingKey(prop), prop->getMemSize());
+        };
+        for (auto &info : _Objects.get<0>()) {
+            for (auto &v : info.second->_PropChangeMap) {
+                if (v.second.property)
+                    addProperty(v.second.property);
+            }
+            // a removed object is owned by the transaction, see ~Transaction()
+            if (info.second->status == TransactionObject::New
+                    && !info.first->isAttachedToDocument()) {
+                std::vector<Property*> props;
+                info.first->getPropertyList(props);
+                for (auto prop : props)
+                    addProperty(prop);
+            }
+        }
+        _MemSizesValid = true;
+    }
+
+    std::size_t size = 0;
+    for (const auto &v : _MemSizes) {
+        if (counted.insert(v.first).second)
+            size += v.second;
+    }
+    return size;
 }
 
 void Transaction::Save (Base::Writer &/*writer*/) const
@@ -142,6 +188,7 @@ bool Transaction::hasObject(const TransactionalObject *Obj) const
 void Transaction::addOrRemoveProperty(TransactionalObject *Obj,
                                     const Property* pcProp, bool add)
 {
+    _MemSizesValid = false;
     auto &index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -190,6 +237,7 @@ void Transaction::apply(Document &Doc, bool forward)
 
 void Transaction::addObjectNew(TransactionalObject *Obj)
 {
+    _MemSizesValid = false;
     auto &index = _Objects.get<1>();
     auto pos = index.find(Obj);
     if (pos != index.end()) {
@@ -219,6 +267,7 @@ void Transaction::addObjectNew(TransactionalObject *Obj)
 
 void Transaction::addObjectDel(const TransactionalObject *Obj)
 {
+    _MemSizesValid = false;
     auto &index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -240,6 +289,7 @@ void Transaction::addObjectDel(const TransactionalObject *Obj)
 
 void Transaction::addObjectChange(const TransactionalObject *Obj, const Property *Prop)
 {
+    _MemSizesValid = false;
     auto &index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -406,7 +456,12 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize () const
 {
-    return 0;
+    unsigned int size = 0;
+    for (const auto &v : _PropChangeMap) {
+        if (v.second.property)
+            size += v.second.property->getMemSize();
+    }
+    return size;
 }
 
 void TransactionObject::Save (Base::Writer &/*writer*/) const
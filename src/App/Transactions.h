@@ -26,6 +26,8 @@
 #define APP_TRANSACTION_H
 
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <Base/Factory.h>
 #include <Base/Persistence.h>
 #include <App/PropertyContainer.h>
@@ -66,6 +68,13 @@ public:
     std::string Name;
 
     unsigned int getMemSize () const override;
+    /** Returns the memory held by the stored property values
+     *
+     * Geometry shared copy-on-write by several property values (see
+     * PropertyComplexGeoData::getComplexData()) is only counted if it isn't
+     * yet in \a counted, which is updated accordingly.
+     */
+    std::size_t getMemSize(std::unordered_set<const void*>& counted) const;
     void Save (Base::Writer &writer) const override;
     /// This method is used to restore properties from an XML document.
     void Restore(Base::XMLReader &reader) override;
@@ -99,6 +108,10 @@ private:
             >
         >
     > _Objects;
+
+    // memory of the stored values, pairs of the sharing key and the size
+    mutable std::vector<std::pair<const void*, std::size_t>> _MemSizes;
+    mutable bool _MemSizesValid = false;
 };
 
 /** Represents an entry for an object in a Transaction
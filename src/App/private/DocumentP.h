@@ -33,6 +33,7 @@
 #include <CXX/Objects.hxx>
 #include <boost/bimap.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -55,8 +56,19 @@ using Path =  std::vector <size_t>;
 
 namespace App {
 using HasherMap = boost::bimap<StringHasherRef, int>;
+class RecomputeProfile;
 class Transaction;
 
+// Result of an object recomputed on a worker thread during a parallel
+// recompute. Property change notifications raised by the object are queued
+// here and replayed on the calling thread in topological order.
+struct ConcurrentRecompute
+{
+    int result = 0;
+    // changed property and whether it is a 'before change' notification
+    std::vector<std::pair<const Property*, bool> > changes;
+};
+
 // Pimpl class
 struct DocumentP
 {
@@ -79,8 +91,9 @@ struct DocumentP
     bool opentransaction;
     std::bitset<32> StatusBits;
     int iUndoMode;
-    unsigned int UndoMemSize;
+    std::size_t UndoMemSize;
     unsigned int UndoMaxStackSize;
+    int UndoEvicted = 0;
     std::string programVersion;
     mutable HasherMap hashers;
 #ifdef USE_OLD_DAG
@@ -90,6 +103,25 @@ struct DocumentP
 #endif //USE_OLD_DAG
     std::multimap<const App::DocumentObject*,
         std::unique_ptr<App::DocumentObjectExecReturn> > _RecomputeLog;
+    std::unordered_map<const App::DocumentObject*, ConcurrentRecompute> concurrentRecomputes;
+    // Cached dependency order of all objects, i.e. the result of
+    // Document::getDependencyList(objectArray, DepSort). It is patched when
+    // objects are added, removed or change their out list, instead of being
+    // rebuilt on each recompute. See getDependencyOrder().
+    std::vector<DocumentObject*> dependencyOrder;
+    // the Document::DependencyOption flags the order was built with
+    int dependencyOptions = 0;
+    std::unordered_map<const DocumentObject*, std::size_t> dependencyPos;
+    std::unordered_set<const DocumentObject*> dependencyDirty;
+    bool dependencyOrderValid = false;
+    bool dependencyOrderCompact = true;
+    // guards recompute log and transaction during parallel recompute
+    std::mutex recomputeMutex;
+    RecomputeProfile *recomputeProfile = nullptr;
+    int recomputePass = 0;
+    // some data is restored on demand from the document file, see
+    // Base::XMLReader::setLazyFiles()
+    bool deferredFiles = false;
 
     StringHasherRef Hasher;
 
@@ -108,6 +140,7 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::mutex> lock(recomputeMutex);
         _RecomputeLog.emplace(returnCode->Which, std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error, true);
     }
@@ -120,6 +153,7 @@ struct DocumentP
     }
 
     void clearDocument() {
+        invalidateDependencyOrder();
         objectArray.clear();
         for(auto &v : objectMap) {
             v.second->setStatus(ObjectStatus::Destroy, true);
@@ -137,6 +171,35 @@ struct DocumentP
         return (--range.second)->second->Why.c_str();
     }
 
+    void invalidateDependencyOrder() {
+        dependencyOrderValid = false;
+        dependencyOrder.clear();
+        dependencyPos.clear();
+        dependencyDirty.clear();
+    }
+
+    void addDependencyObject(DocumentObject *obj) {
+        if (!dependencyOrderValid)
+            return;
+        // a new object has no dependency yet, so it can go last
+        dependencyPos[obj] = dependencyOrder.size();
+        dependencyOrder.push_back(obj);
+        dependencyDirty.insert(obj);
+    }
+
+    void removeDependencyObject(const DocumentObject *obj) {
+        dependencyDirty.erase(obj);
+        auto it = dependencyPos.find(obj);
+        if (it == dependencyPos.end())
+            return;
+        dependencyOrder[it->second] = nullptr;
+        dependencyPos.erase(it);
+        dependencyOrderCompact = false;
+    }
+
+    const std::vector<DocumentObject*> &getDependencyOrder(int options);
+    bool repairDependencyOrder(DocumentObject *obj, DocumentObject *dep);
+
     static
     void findAllPathsAt(const std::vector <Node> &all_nodes, size_t id,
                         std::vector <Path> &all_paths, Path tmp);
@@ -24,10 +24,13 @@
 #ifndef APP_PERSISTENCE_H
 #define APP_PERSISTENCE_H
 
+#include <memory>
+
 #include "BaseClass.h"
 
 namespace Base
 {
+class DeferredFile;
 class Reader;
 class Writer;
 class XMLReader;
@@ -142,6 +145,15 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** Defer restoring a file to the first access of the data
+     * Called by XMLReader::readFiles() in lazy mode instead of RestoreDocFile().
+     * An object that returns true keeps \a file and restores its data from it
+     * later, otherwise RestoreDocFile() is called as usual.
+     */
+    virtual bool deferDocFile(const std::shared_ptr<DeferredFile>& /*file*/)
+    {
+        return false;
+    }
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
 
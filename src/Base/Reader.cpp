@@ -34,6 +34,7 @@
 #include "Base64.h"
 #include "Base64Filter.h"
 #include "Console.h"
+#include "Exception.h"
 #include "InputSource.h"
 #include "Persistence.h"
 #include "Sequencer.h"
@@ -43,6 +44,7 @@
 #ifdef _MSC_VER
 #include <zipios++/zipios-config.h>
 #endif
+#include <zipios++/zipfile.h>
 #include <zipios++/zipinputstream.h>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -421,7 +423,19 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         }
         // If this condition is true both file names match and we can read-in the data, otherwise
         // no file name for the current entry in the zip was registered.
-        if (jt != FileList.end()) {
+        if (jt != FileList.end() && _lazy && !_archive) {
+            _archive = std::make_shared<DeferredArchive>(_File.filePath());
+        }
+        if (jt != FileList.end() && _lazy
+            && jt->Object->deferDocFile(
+                std::make_shared<DeferredFile>(_archive,
+                                               jt->FileName,
+                                               FileVersion,
+                                               entry->getSize()))) {
+            _deferred = true;
+            it = jt + 1;
+        }
+        else if (jt != FileList.end()) {
             try {
                 Base::Reader reader(zipstream, jt->FileName, FileVersion);
                 jt->Object->RestoreDocFile(reader);
@@ -472,6 +486,21 @@ const std::vector<std::string>& Base::XMLReader::getFilenames() const
     return FileNames;
 }
 
+void Base::XMLReader::setLazyFiles(bool on)
+{
+    _lazy = on;
+}
+
+bool Base::XMLReader::isLazyFiles() const
+{
+    return _lazy;
+}
+
+bool Base::XMLReader::hasDeferredFiles() const
+{
+    return _deferred;
+}
+
 bool Base::XMLReader::isRegistered(Base::Persistence* Object) const
 {
     if (Object) {
@@ -677,3 +706,74 @@ std::shared_ptr<Base::XMLReader> Base::Reader::getLocalReader() const
 {
     return (this->localreader);
 }
+
+// ----------------------------------------------------------------------------
+
+Base::DeferredArchive::DeferredArchive(std::string archive)
+    : _archive(std::move(archive))
+{}
+
+Base::DeferredArchive::~DeferredArchive() = default;
+
+std::unique_ptr<std::istream> Base::DeferredArchive::getInputStream(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::unique_ptr<std::istream> str;
+    try {
+        if (!_opened) {
+            _opened = true;
+            _zip = std::make_unique<zipios::ZipFile>(_archive);
+        }
+        if (_zip && _zip->isValid()) {
+            str.reset(_zip->getInputStream(name));
+        }
+    }
+    catch (const std::exception&) {
+        // invalid or modified archive
+    }
+    return str;
+}
+
+const std::string& Base::DeferredArchive::getFileName() const
+{
+    return _archive;
+}
+
+// ----------------------------------------------------------------------------
+
+Base::DeferredFile::DeferredFile(std::shared_ptr<DeferredArchive> archive,
+                                 std::string name,
+                                 int version,
+                                 std::size_t size)
+    : _archive(std::move(archive))
+    , _name(std::move(name))
+    , fileVersion(version)
+    , _size(size)
+{}
+
+void Base::DeferredFile::read(const std::function<void(Reader&)>& func) const
+{
+    std::unique_ptr<std::istream> str = _archive->getInputStream(_name);
+    if (!str) {
+        throw Base::FileException("Cannot read deferred file from project file",
+                                  _archive->getFileName().c_str());
+    }
+
+    Base::Reader reader(*str, _name, fileVersion);
+    func(reader);
+}
+
+const std::string& Base::DeferredFile::getArchive() const
+{
+    return _archive->getFileName();
+}
+
+const std::string& Base::DeferredFile::getFileName() const
+{
+    return _name;
+}
+
+std::size_t Base::DeferredFile::getSize() const
+{
+    return _size;
+}
@@ -24,8 +24,10 @@
 #define BASE_READER_H
 
 #include <bitset>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -40,6 +42,7 @@
 
 namespace zipios
 {
+class ZipFile;
 class ZipInputStream;
 }
 #ifndef XERCES_CPP_NAMESPACE_BEGIN
@@ -59,6 +62,7 @@ XERCES_CPP_NAMESPACE_END
 
 namespace Base
 {
+class DeferredArchive;
 class Persistence;
 
 /** The XML reader class
@@ -259,6 +263,17 @@ public:
     virtual bool doNameMapping() const;
     //@}
 
+    /** @name lazy file reading */
+    //@{
+    /** In lazy mode readFiles() offers every file to Persistence::deferDocFile()
+     * first, objects accepting it restore their data from the archive on demand.
+     */
+    void setLazyFiles(bool on);
+    bool isLazyFiles() const;
+    /// check if readFiles() has deferred any file
+    bool hasDeferredFiles() const;
+    //@}
+
     /// Schema Version of the document
     int DocumentSchema {0};
     /// Version of FreeCAD that wrote this document
@@ -352,6 +367,9 @@ private:
     XERCES_CPP_NAMESPACE_QUALIFIER XMLPScanToken token;
     bool _valid {false};
     bool _verbose {true};
+    bool _lazy {false};
+    mutable bool _deferred {false};
+    mutable std::shared_ptr<DeferredArchive> _archive;
 
 public:
     struct FileEntry
@@ -386,6 +404,52 @@ private:
     std::shared_ptr<Base::XMLReader> localreader;
 };
 
+/** Project archive shared by the deferred files of a document
+ * The central directory is read once on first access and then used by all
+ * files, each of which opens its own stream.
+ */
+class BaseExport DeferredArchive
+{
+public:
+    explicit DeferredArchive(std::string archive);
+    ~DeferredArchive();
+
+    /// open the file \a name in the archive, returns null on failure
+    std::unique_ptr<std::istream> getInputStream(const std::string& name);
+    const std::string& getFileName() const;
+
+private:
+    std::string _archive;
+    std::unique_ptr<zipios::ZipFile> _zip;
+    bool _opened {false};
+    std::mutex _mutex;
+};
+
+/** Handle to a file inside a project archive whose restore has been deferred
+ * \see XMLReader::setLazyFiles(), Persistence::deferDocFile()
+ */
+class BaseExport DeferredFile
+{
+public:
+    DeferredFile(std::shared_ptr<DeferredArchive> archive,
+                 std::string name,
+                 int version,
+                 std::size_t size = 0);
+
+    /// open the file in the archive and pass it to \a func
+    void read(const std::function<void(Reader&)>& func) const;
+    const std::string& getArchive() const;
+    const std::string& getFileName() const;
+    /// the uncompressed size of the file
+    std::size_t getSize() const;
+
+private:
+    std::shared_ptr<DeferredArchive> _archive;
+    std::string _name;
+    int fileVersion;
+    std::size_t _size;
+};
+
 }  // namespace Base
 
 
@@ -27,6 +27,7 @@
 #include <QBuffer>
 #include <QByteArray>
 #include <QIODevice>
+#include <algorithm>
 #include <cstring>
 #ifdef __GNUC__
 #include <cstdint>
@@ -40,6 +41,47 @@
 
 using namespace Base;
 
+namespace
+{
+
+// number of values swapped at once by the array methods
+constexpr std::size_t swapChunk = 4096;
+
+template<typename T>
+void writeArray(std::ostream& out, const T* data, std::size_t n, bool swap)
+{
+    if (!swap) {
+        out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(n * sizeof(T)));
+        return;
+    }
+
+    T buf[swapChunk];
+    while (n > 0) {
+        std::size_t count = std::min(n, swapChunk);
+        for (std::size_t i = 0; i < count; i++) {
+            buf[i] = data[i];
+            SwapEndian<T>(buf[i]);
+        }
+        out.write(reinterpret_cast<const char*>(buf),
+                  static_cast<std::streamsize>(count * sizeof(T)));
+        data += count;
+        n -= count;
+    }
+}
+
+template<typename T>
+void readArray(std::istream& in, T* data, std::size_t n, bool swap)
+{
+    in.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(n * sizeof(T)));
+    if (swap) {
+        for (std::size_t i = 0; i < n; i++) {
+            SwapEndian<T>(data[i]);
+        }
+    }
+}
+
+}  // namespace
+
 Stream::Stream() = default;
 
 Stream::~Stream() = default;
@@ -156,6 +198,18 @@ OutputStream& OutputStream::write(const char* s, int n)
     return *this;
 }
 
+OutputStream& OutputStream::write(const uint32_t* ui, std::size_t n)
+{
+    writeArray(_out, ui, n, isSwapped());
+    return *this;
+}
+
+OutputStream& OutputStream::write(const float* f, std::size_t n)
+{
+    writeArray(_out, f, n, isSwapped());
+    return *this;
+}
+
 InputStream::InputStream(std::istream& rin)
     : _in(rin)
 {}
@@ -258,6 +312,18 @@ InputStream& InputStream::read(char* s, int n)
     return *this;
 }
 
+InputStream& InputStream::read(uint32_t* ui, std::size_t n)
+{
+    readArray(_in, ui, n, isSwapped());
+    return *this;
+}
+
+InputStream& InputStream::read(float* f, std::size_t n)
+{
+    readArray(_in, f, n, isSwapped());
+    return *this;
+}
+
 // ----------------------------------------------------------------------
 
 ByteArrayOStreambuf::ByteArrayOStreambuf(QByteArray& ba)
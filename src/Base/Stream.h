@@ -96,6 +96,9 @@ public:
     OutputStream& operator<<(double d);
 
     OutputStream& write(const char* s, int n);
+    /// Writes an array of n values with the byte order of the stream
+    OutputStream& write(const uint32_t* ui, std::size_t n);
+    OutputStream& write(const float* f, std::size_t n);
 
     OutputStream(const OutputStream&) = delete;
     OutputStream(OutputStream&&) = delete;
@@ -129,6 +132,9 @@ public:
     InputStream& operator>>(double& d);
 
     InputStream& read(char* s, int n);
+    /// Reads an array of n values with the byte order of the stream
+    InputStream& read(uint32_t* ui, std::size_t n);
+    InputStream& read(float* f, std::size_t n);
 
     explicit operator bool() const
     {
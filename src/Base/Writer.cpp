@@ -23,9 +23,15 @@
 
 #include "PreCompiled.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <limits>
 #include <locale>
 #include <iomanip>
+#include <mutex>
+#include <thread>
+#include <zlib.h>
 
 #include "Writer.h"
 #include "Base64.h"
@@ -327,6 +333,53 @@ void Writer::putNextEntry(const char* file, const char* obj)
 
 // ----------------------------------------------------------------------------
 
+namespace
+{
+
+struct ZipPayload
+{
+    std::string name;
+    std::string data;
+    std::string compressed;
+    uLong crc = 0;
+    zipios::StorageMethod method = zipios::STORED;
+};
+
+void compressPayload(ZipPayload& payload, int level)
+{
+    const auto* input = reinterpret_cast<const Bytef*>(payload.data.data());
+    auto size = static_cast<uInt>(payload.data.size());
+    payload.crc = crc32(crc32(0, Z_NULL, 0), input, size);
+    payload.method = zipios::STORED;
+    if (level == Z_NO_COMPRESSION || size == 0) {
+        return;
+    }
+
+    // raw deflate data without zlib header as written by zipios
+    z_stream zs {};
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return;
+    }
+    payload.compressed.resize(deflateBound(&zs, size));
+    zs.next_in = const_cast<Bytef*>(input);  // NOLINT
+    zs.avail_in = size;
+    zs.next_out = reinterpret_cast<Bytef*>(&payload.compressed[0]);
+    zs.avail_out = static_cast<uInt>(payload.compressed.size());
+    int ret = deflate(&zs, Z_FINISH);
+    payload.compressed.resize(zs.total_out);
+    deflateEnd(&zs);
+
+    // keep the data uncompressed if it doesn't shrink
+    if (ret == Z_STREAM_END && payload.compressed.size() < payload.data.size()) {
+        payload.method = zipios::DEFLATED;
+    }
+    else {
+        payload.compressed.clear();
+    }
+}
+
+}  // namespace
+
 ZipWriter::ZipWriter(const char* FileName)
     : ZipStream(FileName)
 {
@@ -360,6 +413,11 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
 
 void ZipWriter::writeFiles()
 {
+    if (Threads != 1) {
+        writeFilesConcurrently();
+        return;
+    }
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
@@ -373,6 +431,91 @@ void ZipWriter::writeFiles()
     }
 }
 
+void ZipWriter::writeFilesConcurrently()
+{
+    // limit the memory held by the buffers, files are processed in batches
+    const std::size_t batchSize = 256 * 1024 * 1024;
+    std::size_t numThreads = Threads > 0 ? Threads : std::thread::hardware_concurrency();
+    numThreads = std::max<std::size_t>(numThreads, 1);
+
+    // use a while loop because it is possible that while
+    // processing the files new ones can be added
+    size_t index = 0;
+    while (index < FileList.size()) {
+        // Persistence::SaveDocFile() is not thread-safe, so the files
+        // are produced on the calling thread
+        std::vector<ZipPayload> batch;
+        std::size_t bytes = 0;
+        while (index < FileList.size() && bytes < batchSize) {
+            FileEntry entry = FileList[index];
+            Writer::putNextEntry(entry.FileName.c_str());
+            indent = 0;
+            indBuf[0] = 0;
+
+            std::ostringstream buffer;
+            buffer.imbue(ZipStream.getloc());
+            buffer.precision(ZipStream.precision());
+            buffer.flags(ZipStream.flags());
+            Buffer = &buffer;
+            try {
+                entry.Object->SaveDocFile(*this);
+            }
+            catch (...) {
+                Buffer = nullptr;
+                throw;
+            }
+            Buffer = nullptr;
+
+            ZipPayload& payload = batch.emplace_back();
+            payload.name = entry.FileName;
+            payload.data = buffer.str();
+            bytes += payload.data.size();
+            index++;
+        }
+
+        // an exception must not escape a thread, the first one is rethrown after the join
+        std::atomic<std::size_t> next(0);
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        auto worker = [&batch, &next, &error, &errorMutex, this]() {
+            try {
+                for (std::size_t i = next++; i < batch.size(); i = next++) {
+                    compressPayload(batch[i], Level);
+                }
+            }
+            catch (...) {
+                next = batch.size();
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        };
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < std::min(numThreads, batch.size()); ++i) {
+            workers.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : workers) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        for (auto& payload : batch) {
+            const std::string& data =
+                payload.method == zipios::STORED ? payload.data : payload.compressed;
+            ZipStream.putRawEntry(zipios::ZipCDirEntry(payload.name),
+                                  data.data(),
+                                  static_cast<zipios::uint32>(data.size()),
+                                  static_cast<zipios::uint32>(payload.data.size()),
+                                  static_cast<zipios::uint32>(payload.crc),
+                                  payload.method);
+        }
+    }
+}
+
 ZipWriter::~ZipWriter()
 {
     ZipStream.close();
@@ -198,6 +198,9 @@ public:
 
     std::ostream& Stream() override
     {
+        if (Buffer) {
+            return *Buffer;
+        }
         return ZipStream;
     }
 
@@ -207,8 +210,19 @@ public:
     }
     void setLevel(int level)
     {
+        Level = level;
         ZipStream.setLevel(level);
     }
+    /** Set the number of threads used by writeFiles() to compress the files.
+     * With more than one thread the files are saved into memory buffers on the
+     * calling thread, the buffers are compressed concurrently and then written
+     * in the order they were added. 0 uses the number of cores, 1 (the default)
+     * compresses while saving. A level of 0 stores the files uncompressed.
+     */
+    void setThreads(int count)
+    {
+        Threads = count;
+    }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
     ZipWriter(const ZipWriter&) = delete;
@@ -216,8 +230,14 @@ public:
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
+private:
+    void writeFilesConcurrently();
+
 private:
     zipios::ZipOutputStream ZipStream;
+    std::ostringstream* Buffer = nullptr;
+    int Level = 6;
+    int Threads = 1;
 };
 
 /** The StringWriter class
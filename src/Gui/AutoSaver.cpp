@@ -182,6 +182,9 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
                 // So, always force binary format because ASCII
                 // is not reentrant. See PropertyPartShape::SaveDocFile
                 writer.setMode("BinaryBrep");
+                if (hGrp->GetBool("SaveCompactMesh", false)) {
+                    writer.setMode("BinaryMesh");
+                }
 
                 writer.putNextEntry("Document.xml");
 
@@ -202,11 +205,18 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
                 if (file.is_open())
                 {
                     Base::ZipWriter writer(file);
-                    if (hGrp->GetBool("SaveBinaryBrep", true))
+                    if (hGrp->GetBool("SaveBinaryBrep", true)) {
                         writer.setMode("BinaryBrep");
+                    }
+                    if (hGrp->GetBool("SaveCompactMesh", false)) {
+                        writer.setMode("BinaryMesh");
+                    }
 
                     writer.setComment("AutoRecovery file");
-                    writer.setLevel(1); // apparently the fastest compression
+                    // 1 is apparently the fastest compression, 0 only stores the files
+                    int level = hGrp->GetInt("AutoSaveCompressionLevel", 1);
+                    writer.setLevel(Base::clamp<int>(level, 0, 9));
+                    writer.setThreads(hGrp->GetInt("CompressionThreads", 1));
                     writer.putNextEntry("Document.xml");
 
                     doc->Save(writer);
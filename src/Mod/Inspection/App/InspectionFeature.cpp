@@ -46,13 +46,14 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/GeometryView.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
 #include <Mod/Points/App/PointsFeature.h>
-#include <Mod/Points/App/PointsGrid.h>
+#include <Mod/Points/App/PointsOctree.h>
 
 #include "InspectionFeature.h"
 
@@ -199,7 +200,8 @@ protected:
         assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
     }
 
-    void AddFacet(const MeshCore::MeshGeomFacet& rclFacet, unsigned long ulFacetIndex)
+    void GetFacetGrids(const MeshCore::MeshGeomFacet& rclFacet,
+                       std::vector<unsigned long>& raulGrids) const
     {
         unsigned long ulX1;
         unsigned long ulY1;
@@ -222,21 +224,19 @@ protected:
                 for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
                     for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                         if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                            _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                            raulGrids.push_back(GetIndexToPosition(ulX, ulY, ulZ));
                         }
                     }
                 }
             }
         }
         else {
-            _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+            raulGrids.push_back(GetIndexToPosition(ulX1, ulY1, ulZ1));
         }
     }
 
     void InitGrid() override
     {
-        unsigned long i, j;
-
         Base::BoundBox3f clBBMesh = _pclMesh->GetBoundBox().Transformed(_transform);
 
         float fLengthX = clBBMesh.LengthX();
@@ -252,14 +252,8 @@ protected:
         _fGridLenZ = (1.0f + fLengthZ) / float(_ulCtGridsZ);
         _fMinZ = clBBMesh.MinZ - 0.5f;
 
-        _aulGrid.clear();
-        _aulGrid.resize(_ulCtGridsX);
-        for (i = 0; i < _ulCtGridsX; i++) {
-            _aulGrid[i].resize(_ulCtGridsY);
-            for (j = 0; j < _ulCtGridsY; j++) {
-                _aulGrid[i][j].resize(_ulCtGridsZ);
-            }
-        }
+        _aulGridOffsets.assign(_ulCtGridsX * _ulCtGridsY * _ulCtGridsZ + 1, 0);
+        _aulGridElements.clear();
     }
 
     void RebuildGrid() override
@@ -267,12 +261,14 @@ protected:
         _ulCtElements = _pclMesh->CountFacets();
         InitGrid();
 
-        unsigned long i = 0;
-        MeshCore::MeshFacetIterator clFIter(*_pclMesh);
-        clFIter.Transform(_transform);
-        for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-            AddFacet(*clFIter, i++);
-        }
+        FillGrid(_ulCtElements,
+                 [&](MeshCore::ElementIndex index, std::vector<unsigned long>& grids) {
+                     MeshCore::MeshGeomFacet facet = _pclMesh->GetFacet(index);
+                     for (auto& point : facet._aclPoints) {
+                         point = _transform * point;
+                     }
+                     GetFacetGrids(facet, grids);
+                 });
     }
 
 private:
@@ -283,10 +279,6 @@ private:
 InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset)
     : _mesh(rMesh.getKernel())
 {
-    Base::Matrix4D tmp;
-    _clTrf = rMesh.getTransform();
-    _bApply = _clTrf != tmp;
-
     // Max. limit of grid elements
     float fMaxGridElements = 8000000.0f;
     Base::BoundBox3f box = _mesh.GetBoundBox().Transformed(rMesh.getTransform());
@@ -304,6 +296,8 @@ InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offs
 
     // build up grid structure to speed up algorithms
     _pGrid = new MeshInspectGrid(_mesh, fGridLen, rMesh.getTransform());
+    // the transformed facets in a layout suitable for the distance computations
+    _pView = new MeshCore::MeshGeometryView(_mesh, rMesh.getTransform());
     _box = box;
     _box.Enlarge(offset);
 }
@@ -311,6 +305,7 @@ InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offs
 InspectNominalMesh::~InspectNominalMesh()
 {
     delete this->_pGrid;
+    delete this->_pView;
 }
 
 float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
@@ -319,28 +314,12 @@ float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
         return FLT_MAX;  // must be inside bbox
     }
 
-    std::vector<unsigned long> indices;
-    //_pGrid->GetElements(point, indices);
-    if (indices.empty()) {
-        std::set<unsigned long> inds;
-        _pGrid->MeshGrid::SearchNearestFromPoint(point, inds);
-        indices.insert(indices.begin(), inds.begin(), inds.end());
-    }
+    std::set<unsigned long> indices;
+    _pGrid->MeshGrid::SearchNearestFromPoint(point, indices);
 
     float fMinDist = FLT_MAX;
     bool positive = true;
-    for (unsigned long it : indices) {
-        MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(it);
-        if (_bApply) {
-            geomFace.Transform(_clTrf);
-        }
-
-        float fDist = geomFace.DistanceToPoint(point);
-        if (fabs(fDist) < fabs(fMinDist)) {
-            fMinDist = fDist;
-            positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
-        }
-    }
+    _pView->NearestFacet(point, indices, fMinDist, positive);
 
     if (!positive) {
         fMinDist = -fMinDist;
@@ -355,10 +334,6 @@ InspectNominalFastMesh::InspectNominalFastMesh(const Mesh::MeshObject& rMesh, fl
 {
     const MeshCore::MeshKernel& kernel = rMesh.getKernel();
 
-    Base::Matrix4D tmp;
-    _clTrf = rMesh.getTransform();
-    _bApply = _clTrf != tmp;
-
     // Max. limit of grid elements
     float fMaxGridElements = 8000000.0f;
     Base::BoundBox3f box = kernel.GetBoundBox().Transformed(rMesh.getTransform());
@@ -376,6 +351,7 @@ InspectNominalFastMesh::InspectNominalFastMesh(const Mesh::MeshObject& rMesh, fl
 
     // build up grid structure to speed up algorithms
     _pGrid = new MeshInspectGrid(kernel, fGridLen, rMesh.getTransform());
+    _pView = new MeshCore::MeshGeometryView(kernel, rMesh.getTransform());
     _box = box;
     _box.Enlarge(offset);
     max_level = (unsigned long)(offset / fGridLen);
@@ -384,6 +360,7 @@ InspectNominalFastMesh::InspectNominalFastMesh(const Mesh::MeshObject& rMesh, fl
 InspectNominalFastMesh::~InspectNominalFastMesh()
 {
     delete this->_pGrid;
+    delete this->_pView;
 }
 
 /**
@@ -415,18 +392,7 @@ float InspectNominalFastMesh::getDistance(const Base::Vector3f& point) const
 
     float fMinDist = FLT_MAX;
     bool positive = true;
-    for (unsigned long it : indices) {
-        MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(it);
-        if (_bApply) {
-            geomFace.Transform(_clTrf);
-        }
-
-        float fDist = geomFace.DistanceToPoint(point);
-        if (fabs(fDist) < fabs(fMinDist)) {
-            fMinDist = fDist;
-            positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
-        }
-    }
+    _pView->NearestFacet(point, indices, fMinDist, positive);
 
     if (!positive) {
         fMinDist = -fMinDist;
@@ -437,35 +403,24 @@ float InspectNominalFastMesh::getDistance(const Base::Vector3f& point) const
 // ----------------------------------------------------------------
 
 InspectNominalPoints::InspectNominalPoints(const Points::PointKernel& Kernel, float /*offset*/)
-    : _rKernel(Kernel)
 {
-    int uGridPerAxis = 50;  // totally 125.000 grid elements
-    this->_pGrid = new Points::PointsGrid(Kernel, uGridPerAxis);
+    // the octree adapts to the density of the scan data
+    this->_pOctree = new Points::PointsOctree(Kernel);
 }
 
 InspectNominalPoints::~InspectNominalPoints()
 {
-    delete this->_pGrid;
+    delete this->_pOctree;
 }
 
 float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 {
-    // TODO: Make faster
-    std::set<unsigned long> indices;
-    unsigned long x, y, z;
+    std::vector<Points::PointsOctree::index_type> indices;
+    std::vector<double> distances;
     Base::Vector3d pointd(point.x, point.y, point.z);
-    _pGrid->Position(pointd, x, y, z);
-    _pGrid->GetElements(x, y, z, indices);
-
-    double fMinDist = DBL_MAX;
-    for (unsigned long it : indices) {
-        Base::Vector3d pt = _rKernel.getPoint(it);
-        double fDist = Base::Distance(pointd, pt);
-        if (fDist < fMinDist) {
-            fMinDist = fDist;
-        }
-    }
+    _pOctree->nearestNeighbours(pointd, 1, indices, distances);
 
+    double fMinDist = distances.empty() ? DBL_MAX : distances.front();
     return (float)fMinDist;
 }
 
@@ -38,6 +38,7 @@ namespace MeshCore
 {
 class MeshKernel;
 class MeshGrid;
+class MeshGeometryView;
 }  // namespace MeshCore
 
 namespace Mesh
@@ -46,7 +47,7 @@ class MeshObject;
 }
 namespace Points
 {
-class PointsGrid;
+class PointsOctree;
 }
 namespace Part
 {
@@ -126,9 +127,8 @@ public:
 private:
     const MeshCore::MeshKernel& _mesh;
     MeshCore::MeshGrid* _pGrid;
+    MeshCore::MeshGeometryView* _pView;
     Base::BoundBox3f _box;
-    bool _bApply;
-    Base::Matrix4D _clTrf;
 };
 
 class InspectionExport InspectNominalFastMesh: public InspectNominalGeometry
@@ -141,10 +141,9 @@ public:
 protected:
     const MeshCore::MeshKernel& _mesh;
     MeshCore::MeshGrid* _pGrid;
+    MeshCore::MeshGeometryView* _pView;
     Base::BoundBox3f _box;
     unsigned long max_level;
-    bool _bApply;
-    Base::Matrix4D _clTrf;
 };
 
 class InspectionExport InspectNominalPoints: public InspectNominalGeometry
@@ -155,8 +154,7 @@ public:
     float getDistance(const Base::Vector3f&) const override;
 
 private:
-    const Points::PointKernel& _rKernel;
-    Points::PointsGrid* _pGrid;
+    Points::PointsOctree* _pOctree;
 };
 
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
@@ -0,0 +1,180 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "BVH.h"
+#include "Functional.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+/// inserts two zero bits after each of the lower 21 bits
+std::uint64_t splitBits(std::uint64_t value)
+{
+    value &= 0x1fffff;
+    value = (value | value << 32) & 0x1f00000000ffff;
+    value = (value | value << 16) & 0x1f0000ff0000ff;
+    value = (value | value << 8) & 0x100f00f00f00f00f;
+    value = (value | value << 4) & 0x10c30c30c30c30c3;
+    value = (value | value << 2) & 0x1249249249249249;
+    return value;
+}
+
+int highestBit(std::uint64_t value)
+{
+    int bit = -1;
+    while (value != 0) {
+        value >>= 1;
+        bit++;
+    }
+    return bit;
+}
+}  // namespace
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& mesh, unsigned int leafSize)
+{
+    const MeshPointArray& points = mesh.GetPoints();
+    const MeshFacetArray& facets = mesh.GetFacets();
+    std::size_t count = facets.size();
+    if (count == 0) {
+        return;
+    }
+
+    _boxes.resize(count);
+    Base::BoundBox3f centers;
+    std::mutex mutex;
+    parallel_for(count, [&](std::size_t begin, std::size_t end) {
+        Base::BoundBox3f part;
+        for (std::size_t i = begin; i < end; i++) {
+            Base::BoundBox3f& box = _boxes[i];
+            for (PointIndex index : facets[i]._aulPoints) {
+                box.Add(points[index]);
+            }
+            part.Add(box.GetCenter());
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        centers.Add(part);
+    });
+
+    // quantize the centers on 21 bits per axis
+    const double cells = double(1 << 21);
+    double scaleX = centers.LengthX() > 0.0F ? (cells - 1.0) / centers.LengthX() : 0.0;
+    double scaleY = centers.LengthY() > 0.0F ? (cells - 1.0) / centers.LengthY() : 0.0;
+    double scaleZ = centers.LengthZ() > 0.0F ? (cells - 1.0) / centers.LengthZ() : 0.0;
+
+    std::vector<std::pair<std::uint64_t, FacetIndex>> keys(count);
+    parallel_for(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            Base::Vector3f center = _boxes[i].GetCenter();
+            auto x = static_cast<std::uint64_t>((center.x - centers.MinX) * scaleX);
+            auto y = static_cast<std::uint64_t>((center.y - centers.MinY) * scaleY);
+            auto z = static_cast<std::uint64_t>((center.z - centers.MinZ) * scaleZ);
+            keys[i].first = splitBits(x) | splitBits(y) << 1 | splitBits(z) << 2;
+            keys[i].second = i;
+        }
+    });
+
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_sort(keys.begin(), keys.end(), std::less<>(), threads);
+
+    std::vector<std::uint64_t> codes(count);
+    _facets.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        codes[i] = keys[i].first;
+        _facets[i] = keys[i].second;
+    }
+    std::vector<std::pair<std::uint64_t, FacetIndex>>().swap(keys);
+
+    Node root;
+    root.count = static_cast<std::uint32_t>(count);
+    _nodes.reserve(2 * count / std::max(leafSize, 1U) + 1);
+    _nodes.push_back(root);
+    Subdivide(codes, 0, std::max(leafSize, 1U));
+}
+
+void MeshFacetBVH::Subdivide(const std::vector<std::uint64_t>& codes,
+                             std::uint32_t index,
+                             unsigned int leafSize)
+{
+    std::uint32_t begin = _nodes[index].first;
+    std::uint32_t count = _nodes[index].count;
+    if (count <= leafSize) {
+        Base::BoundBox3f box;
+        for (std::uint32_t i = begin; i < begin + count; i++) {
+            box.Add(_boxes[_facets[i]]);
+        }
+        _nodes[index].box = box;
+        return;
+    }
+
+    // split at the highest bit where the codes differ or in the middle of equal codes
+    std::uint32_t end = begin + count;
+    std::uint32_t split = begin + count / 2;
+    int bit = highestBit(codes[begin] ^ codes[end - 1]);
+    if (bit >= 0) {
+        std::uint64_t mask = std::uint64_t(1) << bit;
+        auto it = std::partition_point(codes.begin() + begin,
+                                       codes.begin() + end,
+                                       [mask](std::uint64_t code) {
+                                           return (code & mask) == 0;
+                                       });
+        split = static_cast<std::uint32_t>(it - codes.begin());
+    }
+
+    auto child = static_cast<std::uint32_t>(_nodes.size());
+    Node left;
+    left.first = begin;
+    left.count = split - begin;
+    Node right;
+    right.first = split;
+    right.count = end - split;
+    _nodes.push_back(left);
+    _nodes.push_back(right);
+
+    _nodes[index].first = child;
+    _nodes[index].count = 0;
+    Subdivide(codes, child, leafSize);
+    Subdivide(codes, child + 1, leafSize);
+
+    Base::BoundBox3f box = _nodes[child].box;
+    box.Add(_nodes[child + 1].box);
+    _nodes[index].box = box;
+}
+
+Base::BoundBox3f MeshFacetBVH::GetBoundBox() const
+{
+    if (_nodes.empty()) {
+        return Base::BoundBox3f();
+    }
+    return _nodes.front().box;
+}
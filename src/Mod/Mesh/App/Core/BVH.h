@@ -0,0 +1,127 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef MESH_BVH_H
+#define MESH_BVH_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <Base/BoundBox.h>
+
+#include "Definitions.h"
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshFacetBVH class is a bounding volume hierarchy of the facets of a mesh. It is a binary
+ * tree whose leaves hold a few facets and whose nodes keep the bounding box of all facets below.
+ *
+ * The facets are sorted along a Morton curve of the centers of their bounding boxes and the
+ * tree is built by splitting at the highest differing bit of the Morton codes. Unlike a
+ * MeshFacetGrid the tree adapts to the distribution of the facets and a facet is referenced
+ * exactly once, so a pair of facets is never reported twice.
+ *
+ * The bounding boxes and codes are computed and sorted in parallel. A built tree is read-only,
+ * so it can be searched from several threads at once.
+ */
+class MeshExport MeshFacetBVH
+{
+public:
+    /// Builds the hierarchy, a leaf holds at most \a leafSize facets
+    explicit MeshFacetBVH(const MeshKernel& mesh, unsigned int leafSize = 4);
+
+    /** Returns the number of facets. */
+    std::size_t CountFacets() const
+    {
+        return _boxes.size();
+    }
+    /** Returns the bounding box of all facets. */
+    Base::BoundBox3f GetBoundBox() const;
+    /** Returns the bounding box of the facet with index \a facet. */
+    const Base::BoundBox3f& GetBoundBox(FacetIndex facet) const
+    {
+        return _boxes[facet];
+    }
+
+    /** Calls \a func(FacetIndex) for each facet whose bounding box intersects \a box. */
+    template<class Func>
+    void Search(const Base::BoundBox3f& box, Func&& func) const
+    {
+        if (_nodes.empty()) {
+            return;
+        }
+
+        // the depth of the tree is limited by the bits of the Morton codes and the splitting of
+        // equal codes
+        std::array<std::uint32_t, MaxDepth> stack {};
+        std::size_t top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node& node = _nodes[stack[--top]];
+            if (!(node.box && box)) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (std::uint32_t i = node.first; i < node.first + node.count; i++) {
+                    FacetIndex facet = _facets[i];
+                    if (_boxes[facet] && box) {
+                        func(facet);
+                    }
+                }
+            }
+            else {
+                stack[top++] = node.first;
+                stack[top++] = node.first + 1;
+            }
+        }
+    }
+
+private:
+    struct Node
+    {
+        Base::BoundBox3f box;
+        // a leaf refers to the facets [first, first + count) of the sorted order, an inner node
+        // has its children at first and first + 1
+        std::uint32_t first = 0;
+        std::uint32_t count = 0;
+    };
+
+    static constexpr std::size_t MaxDepth = 128;
+
+    void Subdivide(const std::vector<std::uint64_t>& codes,
+                   std::uint32_t index,
+                   unsigned int leafSize);
+
+private:
+    std::vector<Base::BoundBox3f> _boxes;
+    std::vector<FacetIndex> _facets;
+    std::vector<Node> _nodes;
+};
+
+}  // namespace MeshCore
+
+#endif  // MESH_BVH_H
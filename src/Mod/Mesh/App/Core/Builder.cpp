@@ -24,6 +24,9 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <numeric>
 #endif
 
 #include <Base/Exception.h>
@@ -401,3 +404,243 @@ void MeshFastBuilder::Finish()
 
     _meshKernel.Adopt(rPoints, rFacets, true);
 }
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+/** Hash table of the corner points of a triangle soup. It is split into shards that are locked
+ * separately so that several threads can insert corners at the same time.
+ */
+class SoupPointTable
+{
+public:
+    static constexpr std::size_t NumShards = 256;
+    static constexpr std::size_t BatchSize = 512;
+
+    SoupPointTable(const char* data, std::size_t stride, std::size_t count)
+        : data(data)
+        , stride(stride)
+        , shards(NumShards)
+    {
+        // assume that each point is shared by six facets as in a closed mesh
+        std::size_t capacity = 16;
+        while (capacity * NumShards < count) {
+            capacity *= 2;
+        }
+        for (auto& shard : shards) {
+            shard.slots.resize(capacity);
+        }
+    }
+
+    Base::Vector3f point(PointIndex corner) const
+    {
+        float coords[3];
+        std::memcpy(coords,
+                    data + (corner / 3) * stride + (corner % 3) * sizeof(coords),
+                    sizeof(coords));
+        // adding zero turns -0 into +0 so that both get the same hash
+        return Base::Vector3f(coords[0] + 0.0F, coords[1] + 0.0F, coords[2] + 0.0F);
+    }
+
+    std::size_t shard(PointIndex corner) const
+    {
+        return hash(point(corner)) >> 56;
+    }
+
+    /// Adds the corners to the shard, equal points keep the lowest corner index
+    void insert(std::size_t index, const std::vector<PointIndex>& corners)
+    {
+        Shard& shard = shards[index];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (PointIndex corner : corners) {
+            if ((shard.used + 1) * 2 > shard.slots.size()) {
+                grow(shard);
+            }
+            Base::Vector3f pnt = point(corner);
+            std::size_t mask = shard.slots.size() - 1;
+            for (std::size_t i = hash(pnt) & mask;; i = (i + 1) & mask) {
+                Slot& slot = shard.slots[i];
+                if (slot.corner == POINT_INDEX_MAX) {
+                    slot.point = pnt;
+                    slot.corner = corner;
+                    shard.used++;
+                    break;
+                }
+                if (isEqual(slot.point, pnt)) {
+                    slot.corner = std::min(slot.corner, corner);
+                    break;
+                }
+            }
+        }
+    }
+
+    /// Returns the lowest corner index with the same point as \a corner
+    PointIndex find(PointIndex corner) const
+    {
+        Base::Vector3f pnt = point(corner);
+        std::uint64_t key = hash(pnt);
+        const Shard& shard = shards[key >> 56];
+        std::size_t mask = shard.slots.size() - 1;
+        for (std::size_t i = key & mask;; i = (i + 1) & mask) {
+            const Slot& slot = shard.slots[i];
+            if (slot.corner == POINT_INDEX_MAX) {
+                return corner;  // NaN
+            }
+            if (isEqual(slot.point, pnt)) {
+                return slot.corner;
+            }
+        }
+    }
+
+private:
+    struct Slot
+    {
+        Base::Vector3f point;
+        PointIndex corner = POINT_INDEX_MAX;
+    };
+    struct Shard
+    {
+        std::mutex mutex;
+        std::vector<Slot> slots;
+        std::size_t used = 0;
+    };
+
+    static bool isEqual(const Base::Vector3f& p1, const Base::Vector3f& p2)
+    {
+        return p1.x == p2.x && p1.y == p2.y && p1.z == p2.z;
+    }
+
+    static std::uint64_t hash(const Base::Vector3f& pnt)
+    {
+        std::uint32_t bits[3];
+        std::memcpy(&bits[0], &pnt.x, sizeof(float));
+        std::memcpy(&bits[1], &pnt.y, sizeof(float));
+        std::memcpy(&bits[2], &pnt.z, sizeof(float));
+        std::uint64_t key = (std::uint64_t(bits[0]) << 32) ^ bits[1];
+        key ^= std::uint64_t(bits[2]) * 0x9e3779b97f4a7c15ULL;
+        // finalizer of splitmix64
+        key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+        return key ^ (key >> 31);
+    }
+
+    static void grow(Shard& shard)
+    {
+        std::vector<Slot> slots(shard.slots.size() * 2);
+        std::size_t mask = slots.size() - 1;
+        for (const auto& slot : shard.slots) {
+            if (slot.corner != POINT_INDEX_MAX) {
+                std::size_t i = hash(slot.point) & mask;
+                while (slots[i].corner != POINT_INDEX_MAX) {
+                    i = (i + 1) & mask;
+                }
+                slots[i] = slot;
+            }
+        }
+        shard.slots.swap(slots);
+    }
+
+private:
+    const char* data;
+    std::size_t stride;
+    std::vector<Shard> shards;
+};
+}  // namespace
+
+MeshSoupBuilder::MeshSoupBuilder(MeshKernel& rclM)
+    : _meshKernel(rclM)
+{}
+
+void MeshSoupBuilder::Build(const char* data, std::size_t count, std::size_t stride)
+{
+    // corner indices are stored in the facets while building
+    if (count >= POINT_INDEX_MAX / 3) {
+        throw Base::MemoryException();
+    }
+
+    SoupPointTable table(data, stride, count);
+    parallel_for(count, [&table](std::size_t begin, std::size_t end) {
+        // collect the corners per shard to lock each shard only once in a while
+        std::vector<std::vector<PointIndex>> pending(SoupPointTable::NumShards);
+        for (PointIndex corner = 3 * begin; corner < 3 * end; corner++) {
+            std::size_t shard = table.shard(corner);
+            pending[shard].push_back(corner);
+            if (pending[shard].size() >= SoupPointTable::BatchSize) {
+                table.insert(shard, pending[shard]);
+                pending[shard].clear();
+            }
+        }
+        for (std::size_t shard = 0; shard < pending.size(); shard++) {
+            table.insert(shard, pending[shard]);
+        }
+    });
+
+    // Split into a fixed number of blocks so that the points can be numbered in the order of
+    // their first occurrence independent of the number of threads
+    std::size_t blockSize = std::max<std::size_t>(count / 64, 1000);
+    std::size_t numBlocks = (count + blockSize - 1) / blockSize;
+    auto forEachBlock = [count, blockSize, numBlocks](auto&& func) {
+        parallel_for(
+            numBlocks,
+            [&func, count, blockSize](std::size_t begin, std::size_t end) {
+                for (std::size_t block = begin; block < end; block++) {
+                    func(block,
+                         block * blockSize,
+                         std::min<std::size_t>((block + 1) * blockSize, count));
+                }
+            },
+            1);
+    };
+
+    // a corner whose point occurs the first time is the representative of the point
+    MeshFacetArray facets(count);
+    std::vector<PointIndex> blockStart(numBlocks + 1, 0);
+    forEachBlock([&](std::size_t block, std::size_t begin, std::size_t end) {
+        PointIndex unique = 0;
+        for (std::size_t i = begin; i < end; i++) {
+            for (int j = 0; j < 3; j++) {
+                PointIndex corner = 3 * i + j;
+                facets[i]._aulPoints[j] = table.find(corner);
+                if (facets[i]._aulPoints[j] == corner) {
+                    unique++;
+                }
+            }
+        }
+        blockStart[block + 1] = unique;
+    });
+    std::partial_sum(blockStart.begin(), blockStart.end(), blockStart.begin());
+
+    // the final point index of a representative is kept in the neighbour array for the moment
+    MeshPointArray points(blockStart.back());
+    forEachBlock([&](std::size_t block, std::size_t begin, std::size_t end) {
+        PointIndex index = blockStart[block];
+        for (std::size_t i = begin; i < end; i++) {
+            for (int j = 0; j < 3; j++) {
+                PointIndex corner = 3 * i + j;
+                if (facets[i]._aulPoints[j] == corner) {
+                    points[index] = table.point(corner);
+                    facets[i]._aulNeighbours[j] = index++;
+                }
+            }
+        }
+    });
+
+    forEachBlock([&facets](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            for (auto& point : facets[i]._aulPoints) {
+                point = facets[point / 3]._aulNeighbours[point % 3];
+            }
+        }
+    });
+
+    forEachBlock([&facets](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            std::fill(std::begin(facets[i]._aulNeighbours),
+                      std::end(facets[i]._aulNeighbours),
+                      FACET_INDEX_MAX);
+        }
+    });
+
+    _meshKernel.Adopt(points, facets, true);
+}
@@ -228,6 +228,32 @@ private:
     Private* p;
 };
 
+/**
+ * Class for creating the mesh structure from a triangle soup, e.g. the facets of a binary STL
+ * file, in parallel. The facets are read from a buffer where each record starts with the nine
+ * coordinates of the corner points, so the data of a memory-mapped file can be used without
+ * copying it. Equal points are merged with a hash table that is split into shards which are
+ * filled concurrently, so unlike MeshFastBuilder no global sort of all corners is needed.
+ * The points are numbered in the order of their first occurrence.
+ * \code
+ * MeshSoupBuilder builder(someMeshReference);
+ * builder.Build(data, numberOfFacets, recordSize);
+ * \endcode
+ */
+class MeshExport MeshSoupBuilder
+{
+public:
+    explicit MeshSoupBuilder(MeshKernel& rclM);
+
+    /** Replaces the mesh with \a count facets. The first record starts at \a data and the
+     * records are \a stride bytes apart.
+     */
+    void Build(const char* data, std::size_t count, std::size_t stride);
+
+private:
+    MeshKernel& _meshKernel;
+};
+
 }  // namespace MeshCore
 
 #endif
@@ -24,6 +24,12 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #endif
 
@@ -32,6 +38,7 @@
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "BVH.h"
 #include "Evaluation.h"
 #include "Functional.h"
 #include "Grid.h"
@@ -327,66 +334,346 @@ struct Edge_Less
         else if (x.p1 > y.p1) {
             return false;
         }
-        return false;
+        // the order of the facets makes the result independent of the sort algorithm
+        return x.f < y.f;
     }
 };
 
 }  // namespace MeshCore
 
-bool MeshEvalTopology::Evaluate()
+namespace
 {
-    // Using and sorting a vector seems to be faster and more memory-efficient
-    // than a map.
-    const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * rclFAry.size());
+/**
+ * The progress of a check that runs on worker threads. The sequencer may only be used by the
+ * calling thread, so the workers count their steps and the calling thread forwards them.
+ */
+class CheckProgress
+{
+public:
+    void advance(std::size_t steps)
+    {
+        done += steps;
+    }
+    bool isAborted() const
+    {
+        return aborted;
+    }
 
-    // build up an array of edges
-    MeshFacetArray::_TConstIterator pI;
-    Base::SequencerLauncher seq("Checking topology...", rclFAry.size());
-    for (pI = rclFAry.begin(); pI != rclFAry.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - rclFAry.begin();
-            edges.push_back(item);
+    /// Runs \a func on a worker thread and shows its progress. If the user cancels the check
+    /// the worker is stopped and Base::AbortException is thrown.
+    template<class Func>
+    void run(const char* text, std::size_t steps, bool canAbort, Func&& func)
+    {
+        Base::SequencerLauncher seq(text, steps);
+        std::future<void> future = std::async(std::launch::async, std::forward<Func>(func));
+        std::size_t reported = 0;
+        try {
+            bool ready = false;
+            while (!ready) {
+                ready = future.wait_for(std::chrono::milliseconds(100))
+                    == std::future_status::ready;
+                for (std::size_t current = done; reported < current; reported++) {
+                    seq.next(canAbort);
+                }
+            }
         }
+        catch (...) {
+            aborted = true;
+            future.wait();
+            throw;
+        }
+        future.get();
+    }
+
+private:
+    std::atomic<std::size_t> done {0};
+    std::atomic<bool> aborted {false};
+};
+
+/// calls parallel_for in blocks, counts them in \a progress and stops when it is aborted
+template<class Func>
+void ParallelForWithProgress(std::size_t count,
+                             CheckProgress* progress,
+                             Func&& func,
+                             std::size_t minBlock = 10000)
+{
+    const std::size_t step = 1000;
+    parallel_for(
+        count,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t first = begin; first < end; first += step) {
+                if (progress && progress->isAborted()) {
+                    break;
+                }
+                std::size_t last = std::min(first + step, end);
+                func(first, last);
+                if (progress) {
+                    progress->advance(last - first);
+                }
+            }
+        },
+        minBlock);
+}
 
-        seq.next();
+/// returns the sorted edges of the facets from index \a first on
+std::vector<Edge_Index>
+SortedEdges(const MeshFacetArray& rFacets, FacetIndex first = 0, CheckProgress* progress = nullptr)
+{
+    std::size_t count = rFacets.size() - first;
+    std::vector<Edge_Index> edges(3 * count);
+    ParallelForWithProgress(count, progress, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& rFace = rFacets[first + i];
+            for (int j = 0; j < 3; j++) {
+                Edge_Index& item = edges[3 * i + j];
+                item.p0 = std::min<PointIndex>(rFace._aulPoints[j], rFace._aulPoints[(j + 1) % 3]);
+                item.p1 = std::max<PointIndex>(rFace._aulPoints[j], rFace._aulPoints[(j + 1) % 3]);
+                item.f = first + i;
+            }
+        }
+    });
+    if (progress && progress->isAborted()) {
+        return {};
     }
 
-    // sort the edges
-    std::sort(edges.begin(), edges.end(), Edge_Less());
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), threads);
+    return edges;
+}
+
+/// calls \a func(first, last) for each range of equal edges until it returns false
+template<class Func>
+void ForEachEdge(const std::vector<Edge_Index>& edges, Func&& func)
+{
+    auto first = edges.begin();
+    while (first != edges.end()) {
+        auto last = first + 1;
+        while (last != edges.end() && last->p0 == first->p0 && last->p1 == first->p1) {
+            ++last;
+        }
+        if (!func(first, last)) {
+            break;
+        }
+        first = last;
+    }
+}
 
-    // search for non-manifold edges
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    nonManifoldList.clear();
-    nonManifoldFacets.clear();
+void FindNonManifoldEdges(const std::vector<Edge_Index>& edges,
+                          std::vector<std::pair<PointIndex, PointIndex>>& nonManifolds,
+                          std::list<std::vector<FacetIndex>>& facets)
+{
+    ForEachEdge(edges, [&](auto first, auto last) {
+        if (last - first > 2) {
+            // Edge that is shared by more than 2 facets
+            nonManifolds.emplace_back(first->p0, first->p1);
+            std::vector<FacetIndex> faces;
+            for (auto it = first; it != last; ++it) {
+                faces.push_back(it->f);
+            }
+            facets.push_back(faces);
+        }
+        return true;
+    });
+}
 
-    int count = 0;
-    std::vector<FacetIndex> facets;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            count++;
-            facets.push_back(pE->f);
+/// collects the facets with wrong neighbour indices, stops at the first if \a all is false
+std::vector<FacetIndex>
+FindInvalidNeighbours(const MeshFacetArray& rFacets, const std::vector<Edge_Index>& edges, bool all)
+{
+    std::vector<FacetIndex> inds;
+    ForEachEdge(edges, [&](auto first, auto last) {
+        // we handle only the cases for 1 and 2, for all higher
+        // values we have a non-manifold that is ignored here
+        PointIndex p0 = first->p0;
+        PointIndex p1 = first->p1;
+        if (last - first == 2) {
+            FacetIndex f0 = first->f;
+            FacetIndex f1 = (first + 1)->f;
+            const MeshFacet& rFace0 = rFacets[f0];
+            const MeshFacet& rFace1 = rFacets[f1];
+            unsigned short side0 = rFace0.Side(p0, p1);
+            unsigned short side1 = rFace1.Side(p0, p1);
+            // Check whether rFace0 and rFace1 reference each other as
+            // neighbours
+            if (rFace0._aulNeighbours[side0] != f1 || rFace1._aulNeighbours[side1] != f0) {
+                inds.push_back(f0);
+                inds.push_back(f1);
+            }
         }
-        else {
-            if (count > 2) {
-                // Edge that is shared by more than 2 facets
-                nonManifoldList.emplace_back(p0, p1);
-                nonManifoldFacets.push_back(facets);
+        else if (last - first == 1) {
+            const MeshFacet& rFace = rFacets[first->f];
+            unsigned short side = rFace.Side(p0, p1);
+            // should be "open edge" but isn't marked as such
+            if (rFace._aulNeighbours[side] != FACET_INDEX_MAX) {
+                inds.push_back(first->f);
             }
+        }
+        return all || inds.empty();
+    });
 
-            p0 = pE->p0;
-            p1 = pE->p1;
-            facets.clear();
-            facets.push_back(pE->f);
-            count = 1;
+    // remove duplicates
+    std::sort(inds.begin(), inds.end());
+    inds.erase(std::unique(inds.begin(), inds.end()), inds.end());
+    return inds;
+}
+
+/// calls \a func for each distinct point of the facet
+template<class Func>
+void ForEachDistinctPoint(const MeshFacet& rFace, Func&& func)
+{
+    const auto& pts = rFace._aulPoints;
+    func(pts[0]);
+    if (pts[1] != pts[0]) {
+        func(pts[1]);
+    }
+    if (pts[2] != pts[0] && pts[2] != pts[1]) {
+        func(pts[2]);
+    }
+}
+
+void FindNonManifoldPoints(const MeshKernel& rMesh,
+                           const std::vector<Edge_Index>& edges,
+                           std::vector<PointIndex>& points,
+                           std::list<std::vector<FacetIndex>>& facets)
+{
+    // For an inner point the number of adjacent points is equal to the number of shared faces,
+    // for a boundary point it is higher by one. A non-manifold point has more adjacent points.
+    // The adjacent points are the distinct edges at the point.
+    const MeshFacetArray& rFacets = rMesh.GetFacets();
+    std::size_t ctPoints = rMesh.CountPoints();
+    std::vector<std::uint32_t> adjacentPoints(ctPoints);
+    std::vector<std::uint32_t> adjacentFacets(ctPoints);
+    ForEachEdge(edges, [&](auto first, auto) {
+        adjacentPoints[first->p0]++;
+        if (first->p1 != first->p0) {
+            adjacentPoints[first->p1]++;
         }
+        return true;
+    });
+    for (const auto& rFace : rFacets) {
+        ForEachDistinctPoint(rFace, [&adjacentFacets](PointIndex index) {
+            adjacentFacets[index]++;
+        });
     }
 
+    std::unordered_map<PointIndex, std::size_t> slots;
+    for (PointIndex index = 0; index < ctPoints; index++) {
+        if (adjacentPoints[index] > adjacentFacets[index] + 1) {
+            slots[index] = points.size();
+            points.push_back(index);
+        }
+    }
+    if (points.empty()) {
+        return;
+    }
+
+    std::vector<std::vector<FacetIndex>> faces(points.size());
+    for (std::size_t i = 0; i < rFacets.size(); i++) {
+        ForEachDistinctPoint(rFacets[i], [&](PointIndex index) {
+            auto it = slots.find(index);
+            if (it != slots.end()) {
+                faces[it->second].push_back(i);
+            }
+        });
+    }
+    facets.insert(facets.end(), faces.begin(), faces.end());
+}
+
+/// collects the pairs of intersecting facets, stops at the first if \a all is false
+void FindSelfIntersections(const MeshKernel& rMesh,
+                           bool all,
+                           std::vector<std::pair<FacetIndex, FacetIndex>>& intersection,
+                           CheckProgress* progress = nullptr)
+{
+    const MeshFacetArray& rFaces = rMesh.GetFacets();
+    MeshFacetBVH bvh(rMesh);
+    std::mutex mutex;
+    std::atomic<bool> found(false);
+
+    ParallelForWithProgress(
+        rFaces.size(),
+        progress,
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<std::pair<FacetIndex, FacetIndex>> local;
+            Base::Vector3f pt1, pt2;
+            for (FacetIndex i = begin; i < end; i++) {
+                if (!all && found) {
+                    break;
+                }
+
+                const MeshFacet& rface1 = rFaces[i];
+                MeshGeomFacet facet1 = rMesh.GetFacet(rface1);
+                bvh.Search(bvh.GetBoundBox(i), [&](FacetIndex j) {
+                    if (j <= i) {
+                        return;
+                    }
+                    // If the facets share a common vertex we do not check for self-intersections
+                    // because they could but usually do not intersect each other and the
+                    // algorithm below would detect false-positives, otherwise
+                    const MeshFacet& rface2 = rFaces[j];
+                    for (PointIndex index : rface1._aulPoints) {
+                        if (index == rface2._aulPoints[0] || index == rface2._aulPoints[1]
+                            || index == rface2._aulPoints[2]) {
+                            return;
+                        }
+                    }
+
+                    MeshGeomFacet facet2 = rMesh.GetFacet(rface2);
+                    if (facet1.IntersectWithFacet(facet2, pt1, pt2) == 2) {
+                        local.emplace_back(i, j);
+                    }
+                });
+
+                if (!local.empty()) {
+                    found = true;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            intersection.insert(intersection.end(), local.begin(), local.end());
+        },
+        1000);
+
+    std::sort(intersection.begin(), intersection.end());
+    if (!all && intersection.size() > 1) {
+        intersection.resize(1);
+    }
+}
+
+/// returns the sorted edges and shows the progress
+std::vector<Edge_Index> SortedEdgesWithProgress(const MeshFacetArray& rFacets, const char* text)
+{
+    CheckProgress progress;
+    std::vector<Edge_Index> edges;
+    progress.run(text, rFacets.size(), false, [&]() {
+        edges = SortedEdges(rFacets, 0, &progress);
+    });
+    return edges;
+}
+
+/// returns the pairs of intersecting facets and shows the progress, the user can abort the check
+std::vector<std::pair<FacetIndex, FacetIndex>> SelfIntersectionsWithProgress(const MeshKernel& rMesh,
+                                                                             bool all)
+{
+    CheckProgress progress;
+    std::vector<std::pair<FacetIndex, FacetIndex>> intersection;
+    progress.run("Checking for self-intersections...", rMesh.CountFacets(), true, [&]() {
+        FindSelfIntersections(rMesh, all, intersection, &progress);
+    });
+    return intersection;
+}
+}  // namespace
+
+bool MeshEvalTopology::Evaluate()
+{
+    // Using and sorting a vector seems to be faster and more memory-efficient
+    // than a map.
+    nonManifoldList.clear();
+    nonManifoldFacets.clear();
+
+    std::vector<Edge_Index> edges =
+        SortedEdgesWithProgress(_rclMesh.GetFacets(), "Checking topology...");
+    FindNonManifoldEdges(edges, nonManifoldList, nonManifoldFacets);
     return nonManifoldList.empty();
 }
 
@@ -476,30 +763,9 @@ bool MeshEvalPointManifolds::Evaluate()
     this->nonManifoldPoints.clear();
     this->facetsOfNonManifoldPoints.clear();
 
-    MeshCore::MeshRefPointToPoints vv_it(_rclMesh);
-    MeshCore::MeshRefPointToFacets vf_it(_rclMesh);
-
-    unsigned long ctPoints = _rclMesh.CountPoints();
-    for (PointIndex index = 0; index < ctPoints; index++) {
-        // get the local neighbourhood of the point
-        const std::set<FacetIndex>& nf = vf_it[index];
-        const std::set<PointIndex>& np = vv_it[index];
-
-        std::set<unsigned long>::size_type sp {}, sf {};
-        sp = np.size();
-        sf = nf.size();
-        // for an inner point the number of adjacent points is equal to the number of shared faces
-        // for a boundary point the number of adjacent points is higher by one than the number of
-        // shared faces for a non-manifold point the number of adjacent points is higher by more
-        // than one than the number of shared faces
-        if (sp > sf + 1) {
-            nonManifoldPoints.push_back(index);
-            std::vector<FacetIndex> faces;
-            faces.insert(faces.end(), nf.begin(), nf.end());
-            this->facetsOfNonManifoldPoints.push_back(faces);
-        }
-    }
-
+    std::vector<Edge_Index> edges =
+        SortedEdgesWithProgress(_rclMesh.GetFacets(), "Checking topology...");
+    FindNonManifoldPoints(_rclMesh, edges, nonManifoldPoints, facetsOfNonManifoldPoints);
     return this->nonManifoldPoints.empty();
 }
 
@@ -600,81 +866,7 @@ bool MeshFixSingleFacet::Fixup()
 
 bool MeshEvalSelfIntersection::Evaluate()
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (std::vector<FacetIndex>::iterator it = aulGridElements.begin();
-             it != aulGridElements.end();
-             ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (std::vector<FacetIndex>::iterator jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
-                    }
-                }
-            }
-        }
-    }
-
-    return true;
+    return SelfIntersectionsWithProgress(_rclMesh, false).empty();
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
@@ -705,79 +897,11 @@ void MeshEvalSelfIntersection::GetIntersections(
 void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (std::vector<FacetIndex>::iterator it = aulGridElements.begin();
-             it != aulGridElements.end();
-             ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (std::vector<FacetIndex>::iterator jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
-                    }
-                }
-            }
-        }
-    }
+    // The facets are searched with a bounding volume hierarchy that references each facet
+    // once, so no pair is reported twice
+    std::vector<std::pair<FacetIndex, FacetIndex>> pairs =
+        SelfIntersectionsWithProgress(_rclMesh, true);
+    intersection.insert(intersection.end(), pairs.begin(), pairs.end());
 }
 
 std::vector<FacetIndex> MeshFixSelfIntersection::GetFacets() const
@@ -830,169 +954,91 @@ bool MeshEvalNeighbourhood::Evaluate()
     // Using and sorting a vector seems to be faster and more memory-efficient
     // than a map.
     const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * rclFAry.size());
-
-    // build up an array of edges
-    MeshFacetArray::_TConstIterator pI;
-    Base::SequencerLauncher seq("Checking indices...", rclFAry.size());
-    for (pI = rclFAry.begin(); pI != rclFAry.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - rclFAry.begin();
-            edges.push_back(item);
-        }
-
-        seq.next();
-    }
-
-    // sort the edges
-    std::sort(edges.begin(), edges.end(), Edge_Less());
-
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    PointIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
-    int count = 0;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            f1 = pE->f;
-            count++;
-        }
-        else {
-            // we handle only the cases for 1 and 2, for all higher
-            // values we have a non-manifold that is ignored here
-            if (count == 2) {
-                const MeshFacet& rFace0 = rclFAry[f0];
-                const MeshFacet& rFace1 = rclFAry[f1];
-                unsigned short side0 = rFace0.Side(p0, p1);
-                unsigned short side1 = rFace1.Side(p0, p1);
-                // Check whether rFace0 and rFace1 reference each other as
-                // neighbours
-                if (rFace0._aulNeighbours[side0] != f1 || rFace1._aulNeighbours[side1] != f0) {
-                    return false;
-                }
-            }
-            else if (count == 1) {
-                const MeshFacet& rFace = rclFAry[f0];
-                unsigned short side = rFace.Side(p0, p1);
-                // should be "open edge" but isn't marked as such
-                if (rFace._aulNeighbours[side] != FACET_INDEX_MAX) {
-                    return false;
-                }
-            }
-
-            p0 = pE->p0;
-            p1 = pE->p1;
-            f0 = pE->f;
-            count = 1;
-        }
-    }
-
-    return true;
+    std::vector<Edge_Index> edges = SortedEdgesWithProgress(rclFAry, "Checking indices...");
+    return FindInvalidNeighbours(rclFAry, edges, false).empty();
 }
 
 std::vector<FacetIndex> MeshEvalNeighbourhood::GetIndices() const
 {
-    std::vector<FacetIndex> inds;
     const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * rclFAry.size());
+    std::vector<Edge_Index> edges = SortedEdgesWithProgress(rclFAry, "Checking indices...");
+    return FindInvalidNeighbours(rclFAry, edges, true);
+}
 
-    // build up an array of edges
-    MeshFacetArray::_TConstIterator pI;
-    Base::SequencerLauncher seq("Checking indices...", rclFAry.size());
-    for (pI = rclFAry.begin(); pI != rclFAry.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - rclFAry.begin();
-            edges.push_back(item);
-        }
+bool MeshFixNeighbourhood::Fixup()
+{
+    _rclMesh.RebuildNeighbours();
+    return true;
+}
 
-        seq.next();
-    }
+// ----------------------------------------------------------------
 
-    // sort the edges
-    std::sort(edges.begin(), edges.end(), Edge_Less());
+bool MeshEvalDefects::Evaluate()
+{
+    report = MeshDefectReport();
+
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    std::size_t ctPoints = _rclMesh.CountPoints();
+    bool validPoints = std::all_of(rFacets.begin(), rFacets.end(), [ctPoints](const MeshFacet& f) {
+        return f._aulPoints[0] < ctPoints && f._aulPoints[1] < ctPoints
+            && f._aulPoints[2] < ctPoints;
+    });
+
+    bool checkSelfIntersections = (checks & SelfIntersections) && validPoints;
+    bool checkEdges = checks & (NonManifoldEdges | NonManifoldPoints | Neighbourhood);
+    std::size_t steps = 0;
+    if (checkSelfIntersections) {
+        steps += rFacets.size();
+    }
+    if (checkEdges) {
+        steps += rFacets.size();
+    }
 
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    PointIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
-    int count = 0;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            f1 = pE->f;
-            count++;
+    CheckProgress progress;
+    progress.run("Checking mesh...", steps, true, [&]() {
+        // the self-intersections don't need the edges and run in the meantime
+        std::future<void> selfIntersections;
+        if (checkSelfIntersections) {
+            selfIntersections = std::async(std::launch::async, [this, &progress]() {
+                FindSelfIntersections(_rclMesh, true, report.selfIntersections, &progress);
+            });
         }
-        else {
-            // we handle only the cases for 1 and 2, for all higher
-            // values we have a non-manifold that is ignored here
-            if (count == 2) {
-                const MeshFacet& rFace0 = rclFAry[f0];
-                const MeshFacet& rFace1 = rclFAry[f1];
-                unsigned short side0 = rFace0.Side(p0, p1);
-                unsigned short side1 = rFace1.Side(p0, p1);
-                // Check whether rFace0 and rFace1 reference each other as
-                // neighbours
-                if (rFace0._aulNeighbours[side0] != f1 || rFace1._aulNeighbours[side1] != f0) {
-                    inds.push_back(f0);
-                    inds.push_back(f1);
-                }
+
+        if (checkEdges) {
+            std::vector<Edge_Index> edges = SortedEdges(rFacets, 0, &progress);
+            std::vector<std::future<void>> futures;
+            if (checks & NonManifoldEdges) {
+                futures.push_back(std::async(std::launch::async, [this, &edges]() {
+                    FindNonManifoldEdges(edges, report.nonManifoldEdges, report.nonManifoldFacets);
+                }));
             }
-            else if (count == 1) {
-                const MeshFacet& rFace = rclFAry[f0];
-                unsigned short side = rFace.Side(p0, p1);
-                // should be "open edge" but isn't marked as such
-                if (rFace._aulNeighbours[side] != FACET_INDEX_MAX) {
-                    inds.push_back(f0);
-                }
+            if ((checks & NonManifoldPoints) && validPoints) {
+                futures.push_back(std::async(std::launch::async, [this, &edges]() {
+                    FindNonManifoldPoints(_rclMesh,
+                                          edges,
+                                          report.nonManifoldPoints,
+                                          report.facetsOfNonManifoldPoints);
+                }));
+            }
+            if (checks & Neighbourhood) {
+                report.invalidNeighbours = FindInvalidNeighbours(rFacets, edges, true);
+            }
+            for (auto& future : futures) {
+                future.get();
             }
-
-            p0 = pE->p0;
-            p1 = pE->p1;
-            f0 = pE->f;
-            count = 1;
         }
-    }
-
-    // remove duplicates
-    std::sort(inds.begin(), inds.end());
-    inds.erase(std::unique(inds.begin(), inds.end()), inds.end());
 
-    return inds;
-}
+        if (selfIntersections.valid()) {
+            selfIntersections.get();
+        }
+    });
 
-bool MeshFixNeighbourhood::Fixup()
-{
-    _rclMesh.RebuildNeighbours();
-    return true;
+    return report.IsValid();
 }
 
 void MeshKernel::RebuildNeighbours(FacetIndex index)
 {
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * (this->_aclFacetArray.size() - index));
-
-    // build up an array of edges
-    MeshFacetArray::_TConstIterator pI;
-    MeshFacetArray::_TConstIterator pB = this->_aclFacetArray.begin();
-    for (pI = pB + index; pI != this->_aclFacetArray.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - pB;
-            edges.push_back(item);
-        }
-    }
-
-    // sort the edges
-    // std::sort(edges.begin(), edges.end(), Edge_Less());
-    int threads = int(std::thread::hardware_concurrency());
-    MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), threads);
+    std::vector<Edge_Index> edges = SortedEdges(this->_aclFacetArray, index);
 
     PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
     PointIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
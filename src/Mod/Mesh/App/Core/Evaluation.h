@@ -390,6 +390,67 @@ public:
 
 // ----------------------------------------------------
 
+/**
+ * The MeshDefectReport holds the results of a MeshEvalDefects run.
+ */
+struct MeshExport MeshDefectReport
+{
+    /// non-manifold edges as pairs of point indices, see MeshEvalTopology
+    std::vector<std::pair<PointIndex, PointIndex>> nonManifoldEdges;
+    /// the facets of each non-manifold edge
+    std::list<std::vector<FacetIndex>> nonManifoldFacets;
+    /// non-manifold points, see MeshEvalPointManifolds
+    std::vector<PointIndex> nonManifoldPoints;
+    /// the facets of each non-manifold point
+    std::list<std::vector<FacetIndex>> facetsOfNonManifoldPoints;
+    /// facets with wrong neighbour indices, see MeshEvalNeighbourhood
+    std::vector<FacetIndex> invalidNeighbours;
+    /// pairs of intersecting facets, see MeshEvalSelfIntersection
+    std::vector<std::pair<FacetIndex, FacetIndex>> selfIntersections;
+
+    bool IsValid() const
+    {
+        return nonManifoldEdges.empty() && nonManifoldPoints.empty() && invalidNeighbours.empty()
+            && selfIntersections.empty();
+    }
+};
+
+/**
+ * The MeshEvalDefects class runs several checks in one go. The sorted edge list that is
+ * needed for the topological checks is built only once and the checks run concurrently. The
+ * results are the same as of the single evaluation classes.
+ * If a facet refers to a point that doesn't exist only the checks of the edges are done.
+ */
+class MeshExport MeshEvalDefects: public MeshEvaluation
+{
+public:
+    enum Check
+    {
+        NonManifoldEdges = 1,
+        NonManifoldPoints = 2,
+        Neighbourhood = 4,
+        SelfIntersections = 8,
+        AllChecks = 15
+    };
+
+    explicit MeshEvalDefects(const MeshKernel& rclB, int checks = AllChecks)
+        : MeshEvaluation(rclB)
+        , checks(checks)
+    {}
+    /// Returns false if any of the selected checks has found a defect
+    bool Evaluate() override;
+    const MeshDefectReport& GetReport() const
+    {
+        return report;
+    }
+
+private:
+    int checks;
+    MeshDefectReport report;
+};
+
+// ----------------------------------------------------
+
 /**
  * The MeshEigensystem class actually does not try to check for or fix errors but
  * it provides methods to calculate the mesh's local coordinate system with the center
@@ -25,6 +25,8 @@
 
 #include <algorithm>
 #include <future>
+#include <thread>
+#include <vector>
 
 
 namespace MeshCore
@@ -62,6 +64,31 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/** Splits the range [0, count) into contiguous blocks and calls \a func(begin, end) for each block
+ * in its own thread. Ranges smaller than \a minBlock are processed in the calling thread. */
+template<class Func>
+static void parallel_for(std::size_t count, Func func, std::size_t minBlock = 10000)
+{
+    std::size_t threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    threads = std::min<std::size_t>(threads, count / std::max<std::size_t>(minBlock, 1));
+    if (threads < 2) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    std::size_t block = (count + threads - 1) / threads;
+    std::vector<std::future<void>> futures;
+    futures.reserve(threads - 1);
+    for (std::size_t begin = block; begin < count; begin += block) {
+        futures.push_back(
+            std::async(std::launch::async, func, begin, std::min<std::size_t>(begin + block, count)));
+    }
+    func(std::size_t(0), std::min<std::size_t>(block, count));
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 }  // namespace MeshCore
 
 
@@ -0,0 +1,367 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <mutex>
+#endif
+
+#include "Functional.h"
+#include "GeometryView.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// number of points or facets that are copied to the stack and processed at once
+const std::size_t BlockSize = 256;
+const std::size_t FacetBlockSize = 16;
+
+// squared distance of the point d to the segment from the origin to e
+inline float SquaredDistanceToSegment(float dx, float dy, float dz, float ex, float ey, float ez)
+{
+    float t = (dx * ex + dy * ey + dz * ez) / std::max(ex * ex + ey * ey + ez * ez, FLT_MIN);
+    // clamp t to [0, 1] with arithmetic only, a branch would prevent the vectorization
+    t = 0.5F * (t + std::fabs(t));
+    t = 1.0F - 0.5F * ((1.0F - t) + std::fabs(1.0F - t));
+    float x = dx - t * ex;
+    float y = dy - t * ey;
+    float z = dz - t * ez;
+    return x * x + y * y + z * z;
+}
+
+// The point d is given relative to the first corner of the triangle and e0, e1 are the edges from
+// the first corner to the other two corners. Apart from the selects there are no branches, so the
+// compiler can vectorize a loop over several triangles.
+inline float SquaredDistanceToTriangle(float dx,
+                                       float dy,
+                                       float dz,
+                                       float e0x,
+                                       float e0y,
+                                       float e0z,
+                                       float e1x,
+                                       float e1y,
+                                       float e1z,
+                                       float& side)
+{
+    // normal of the triangle
+    float nx = e0y * e1z - e0z * e1y;
+    float ny = e0z * e1x - e0x * e1z;
+    float nz = e0x * e1y - e0y * e1x;
+    float nn = nx * nx + ny * ny + nz * nz;
+    side = dx * nx + dy * ny + dz * nz;
+
+    // the projection of the point lies inside if it is left of all edges
+    float e2x = e1x - e0x;
+    float e2y = e1y - e0y;
+    float e2z = e1z - e0z;
+    float fx = dx - e0x;
+    float fy = dy - e0y;
+    float fz = dz - e0z;
+    float gx = dx - e1x;
+    float gy = dy - e1y;
+    float gz = dz - e1z;
+    float c0 = nx * (e0y * dz - e0z * dy) + ny * (e0z * dx - e0x * dz) + nz * (e0x * dy - e0y * dx);
+    float c1 = nx * (e2y * fz - e2z * fy) + ny * (e2z * fx - e2x * fz) + nz * (e2x * fy - e2y * fx);
+    float c2 = nx * (gy * e1z - gz * e1y) + ny * (gz * e1x - gx * e1z) + nz * (gx * e1y - gy * e1x);
+    float inside = std::min(std::min(c0, c1), c2);
+    float outside = (inside >= 0.0F && nn > 0.0F) ? 0.0F : FLT_MAX;
+    float plane = side * side / std::max(nn, FLT_MIN) + outside;
+
+    // otherwise the nearest point lies on one of the edges
+    float s0 = SquaredDistanceToSegment(dx, dy, dz, e0x, e0y, e0z);
+    float s1 = SquaredDistanceToSegment(fx, fy, fz, e2x, e2y, e2z);
+    float s2 = SquaredDistanceToSegment(dx, dy, dz, e1x, e1y, e1z);
+    return std::min(std::min(plane, s0), std::min(s1, s2));
+}
+}  // namespace
+
+MeshGeometryView::MeshGeometryView(const MeshKernel& kernel)
+{
+    Assign(kernel);
+}
+
+MeshGeometryView::MeshGeometryView(const MeshKernel& kernel, const Base::Matrix4D& mat)
+{
+    Assign(kernel);
+    Transform(mat);
+}
+
+void MeshGeometryView::Assign(const MeshKernel& kernel)
+{
+    const MeshPointArray& points = kernel.GetPoints();
+    _x.resize(points.size());
+    _y.resize(points.size());
+    _z.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        _x[i] = points[i].x;
+        _y[i] = points[i].y;
+        _z[i] = points[i].z;
+    }
+
+    const MeshFacetArray& facets = kernel.GetFacets();
+    _indices.resize(3 * facets.size());
+    for (std::size_t i = 0; i < facets.size(); i++) {
+        _indices[3 * i] = facets[i]._aulPoints[0];
+        _indices[3 * i + 1] = facets[i]._aulPoints[1];
+        _indices[3 * i + 2] = facets[i]._aulPoints[2];
+    }
+}
+
+void MeshGeometryView::Transform(const Base::Matrix4D& mat)
+{
+    parallel_for(_x.size(), [this, &mat](std::size_t begin, std::size_t end) {
+        TransformPoints(_x.data() + begin, _y.data() + begin, _z.data() + begin, end - begin, mat);
+    });
+}
+
+Base::BoundBox3f MeshGeometryView::GetBoundBox() const
+{
+    Base::BoundBox3f box;
+    AddToBoundBox(_x.data(), _y.data(), _z.data(), _x.size(), box);
+    return box;
+}
+
+void MeshGeometryView::GetFacetNormals(std::vector<Base::Vector3f>& normals, bool normalize) const
+{
+    std::size_t count = CountFacets();
+    normals.resize(count);
+    parallel_for(count, [this, &normals, normalize](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const PointIndex* index = &_indices[3 * i];
+            float e0x = _x[index[1]] - _x[index[0]];
+            float e0y = _y[index[1]] - _y[index[0]];
+            float e0z = _z[index[1]] - _z[index[0]];
+            float e1x = _x[index[2]] - _x[index[0]];
+            float e1y = _y[index[2]] - _y[index[0]];
+            float e1z = _z[index[2]] - _z[index[0]];
+            Base::Vector3f normal(e0y * e1z - e0z * e1y,
+                                  e0z * e1x - e0x * e1z,
+                                  e0x * e1y - e0y * e1x);
+            if (normalize) {
+                normal.Normalize();
+            }
+            normals[i] = normal;
+        }
+    });
+}
+
+void MeshGeometryView::GetFacetAreas(std::vector<float>& areas) const
+{
+    std::vector<Base::Vector3f> normals;
+    GetFacetNormals(normals, false);
+    areas.resize(normals.size());
+    std::transform(normals.begin(), normals.end(), areas.begin(), [](const Base::Vector3f& n) {
+        return 0.5F * n.Length();
+    });
+}
+
+std::size_t MeshGeometryView::NearestFacet(const Base::Vector3f& point,
+                                           const FacetIndex* facets,
+                                           std::size_t count,
+                                           float& distance,
+                                           bool& positive) const
+{
+    float dx[FacetBlockSize], dy[FacetBlockSize], dz[FacetBlockSize];
+    float e0x[FacetBlockSize], e0y[FacetBlockSize], e0z[FacetBlockSize];
+    float e1x[FacetBlockSize], e1y[FacetBlockSize], e1z[FacetBlockSize];
+    float dist[FacetBlockSize], side[FacetBlockSize];
+
+    std::size_t nearest = count;
+    float minDist = FLT_MAX;
+    positive = true;
+    for (std::size_t first = 0; first < count; first += FacetBlockSize) {
+        std::size_t num = std::min(FacetBlockSize, count - first);
+
+        // gather the corners of the facets
+        for (std::size_t i = 0; i < num; i++) {
+            const PointIndex* index = &_indices[3 * facets[first + i]];
+            float x = _x[index[0]];
+            float y = _y[index[0]];
+            float z = _z[index[0]];
+            dx[i] = point.x - x;
+            dy[i] = point.y - y;
+            dz[i] = point.z - z;
+            e0x[i] = _x[index[1]] - x;
+            e0y[i] = _y[index[1]] - y;
+            e0z[i] = _z[index[1]] - z;
+            e1x[i] = _x[index[2]] - x;
+            e1y[i] = _y[index[2]] - y;
+            e1z[i] = _z[index[2]] - z;
+        }
+
+        for (std::size_t i = 0; i < num; i++) {
+            dist[i] = SquaredDistanceToTriangle(dx[i],
+                                                dy[i],
+                                                dz[i],
+                                                e0x[i],
+                                                e0y[i],
+                                                e0z[i],
+                                                e1x[i],
+                                                e1y[i],
+                                                e1z[i],
+                                                side[i]);
+        }
+
+        for (std::size_t i = 0; i < num; i++) {
+            if (dist[i] < minDist) {
+                minDist = dist[i];
+                nearest = first + i;
+                positive = side[i] > 0.0F;
+            }
+        }
+    }
+
+    distance = nearest < count ? std::sqrt(minDist) : FLT_MAX;
+    return nearest;
+}
+
+FacetIndex MeshGeometryView::NearestFacet(const Base::Vector3f& point,
+                                          const std::set<FacetIndex>& facets,
+                                          float& distance,
+                                          bool& positive) const
+{
+    FacetIndex block[FacetBlockSize];
+    FacetIndex nearest = FACET_INDEX_MAX;
+    distance = FLT_MAX;
+    positive = true;
+    for (auto it = facets.begin(); it != facets.end();) {
+        std::size_t num = 0;
+        for (; it != facets.end() && num < FacetBlockSize; ++it) {
+            block[num++] = *it;
+        }
+
+        float dist {};
+        bool side {};
+        std::size_t pos = NearestFacet(point, block, num, dist, side);
+        if (pos < num && dist < distance) {
+            distance = dist;
+            positive = side;
+            nearest = block[pos];
+        }
+    }
+
+    return nearest;
+}
+
+void MeshGeometryView::TransformPoints(float* x,
+                                       float* y,
+                                       float* z,
+                                       std::size_t count,
+                                       const Base::Matrix4D& mat)
+{
+    // same arithmetic as Base::Matrix4D::operator*(const Vector3f&)
+    const double m00 = mat[0][0], m01 = mat[0][1], m02 = mat[0][2], m03 = mat[0][3];
+    const double m10 = mat[1][0], m11 = mat[1][1], m12 = mat[1][2], m13 = mat[1][3];
+    const double m20 = mat[2][0], m21 = mat[2][1], m22 = mat[2][2], m23 = mat[2][3];
+    for (std::size_t i = 0; i < count; i++) {
+        double sx = static_cast<double>(x[i]);
+        double sy = static_cast<double>(y[i]);
+        double sz = static_cast<double>(z[i]);
+        x[i] = static_cast<float>(m00 * sx + m01 * sy + m02 * sz + m03);
+        y[i] = static_cast<float>(m10 * sx + m11 * sy + m12 * sz + m13);
+        z[i] = static_cast<float>(m20 * sx + m21 * sy + m22 * sz + m23);
+    }
+}
+
+void MeshGeometryView::AddToBoundBox(const float* x,
+                                     const float* y,
+                                     const float* z,
+                                     std::size_t count,
+                                     Base::BoundBox3f& box)
+{
+    float minX = box.MinX, minY = box.MinY, minZ = box.MinZ;
+    float maxX = box.MaxX, maxY = box.MaxY, maxZ = box.MaxZ;
+    for (std::size_t i = 0; i < count; i++) {
+        minX = x[i] < minX ? x[i] : minX;
+        minY = y[i] < minY ? y[i] : minY;
+        minZ = z[i] < minZ ? z[i] : minZ;
+        maxX = x[i] > maxX ? x[i] : maxX;
+        maxY = y[i] > maxY ? y[i] : maxY;
+        maxZ = z[i] > maxZ ? z[i] : maxZ;
+    }
+    box.MinX = minX;
+    box.MinY = minY;
+    box.MinZ = minZ;
+    box.MaxX = maxX;
+    box.MaxY = maxY;
+    box.MaxZ = maxZ;
+}
+
+Base::BoundBox3f MeshGeometryView::TransformPoints(MeshPointArray& points,
+                                                   const Base::Matrix4D& mat)
+{
+    Base::BoundBox3f box;
+    std::mutex mutex;
+    parallel_for(points.size(), [&](std::size_t begin, std::size_t end) {
+        float x[BlockSize], y[BlockSize], z[BlockSize];
+        Base::BoundBox3f local;
+        for (std::size_t first = begin; first < end; first += BlockSize) {
+            std::size_t count = std::min(BlockSize, end - first);
+            for (std::size_t i = 0; i < count; i++) {
+                const MeshPoint& pt = points[first + i];
+                x[i] = pt.x;
+                y[i] = pt.y;
+                z[i] = pt.z;
+            }
+            TransformPoints(x, y, z, count, mat);
+            AddToBoundBox(x, y, z, count, local);
+            for (std::size_t i = 0; i < count; i++) {
+                points[first + i].Set(x[i], y[i], z[i]);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        box.Add(local);
+    });
+    return box;
+}
+
+Base::BoundBox3f MeshGeometryView::GetBoundBox(const MeshPointArray& points)
+{
+    Base::BoundBox3f box;
+    std::mutex mutex;
+    parallel_for(points.size(), [&](std::size_t begin, std::size_t end) {
+        float x[BlockSize], y[BlockSize], z[BlockSize];
+        Base::BoundBox3f local;
+        for (std::size_t first = begin; first < end; first += BlockSize) {
+            std::size_t count = std::min(BlockSize, end - first);
+            for (std::size_t i = 0; i < count; i++) {
+                const MeshPoint& pt = points[first + i];
+                x[i] = pt.x;
+                y[i] = pt.y;
+                z[i] = pt.z;
+            }
+            AddToBoundBox(x, y, z, count, local);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        box.Add(local);
+    });
+    return box;
+}
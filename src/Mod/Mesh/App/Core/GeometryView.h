@@ -0,0 +1,134 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef MESH_GEOMETRYVIEW_H
+#define MESH_GEOMETRYVIEW_H
+
+#include <set>
+#include <vector>
+#include <Base/BoundBox.h>
+#include <Base/Matrix.h>
+
+#include "Definitions.h"
+
+namespace MeshCore
+{
+
+class MeshKernel;
+class MeshPointArray;
+
+/**
+ * The MeshGeometryView class holds a copy of the geometry of a mesh kernel in a
+ * structure-of-arrays layout: the x, y and z coordinates of the points are kept in
+ * separate arrays and the facets as packed index triples. Without the flag and
+ * property members in between, the loops over the coordinates can be vectorized
+ * by the compiler. This pays off for algorithms that evaluate the same geometry
+ * many times, e.g. the distance computations of an inspection.
+ */
+class MeshExport MeshGeometryView
+{
+public:
+    MeshGeometryView() = default;
+    /// Copies the geometry of \a kernel
+    explicit MeshGeometryView(const MeshKernel& kernel);
+    /// Copies the geometry of \a kernel and transforms it with \a mat
+    MeshGeometryView(const MeshKernel& kernel, const Base::Matrix4D& mat);
+
+    std::size_t CountPoints() const
+    {
+        return _x.size();
+    }
+    std::size_t CountFacets() const
+    {
+        return _indices.size() / 3;
+    }
+    Base::Vector3f GetPoint(PointIndex index) const
+    {
+        return Base::Vector3f(_x[index], _y[index], _z[index]);
+    }
+
+    /// Transforms all points with \a mat
+    void Transform(const Base::Matrix4D& mat);
+    /// Returns the bounding box of all points
+    Base::BoundBox3f GetBoundBox() const;
+    /// Computes the normals of all facets, optionally normalized
+    void GetFacetNormals(std::vector<Base::Vector3f>& normals, bool normalize = true) const;
+    /// Computes the areas of all facets
+    void GetFacetAreas(std::vector<float>& areas) const;
+
+    /**
+     * Searches among \a count facets of the array \a facets for the facet nearest to
+     * \a point and returns its position in \a facets, or \a count if there is none.
+     * \a distance is set to the distance to the facet, \a positive to whether the point
+     * is in front of the facet.
+     */
+    std::size_t NearestFacet(const Base::Vector3f& point,
+                             const FacetIndex* facets,
+                             std::size_t count,
+                             float& distance,
+                             bool& positive) const;
+    /**
+     * Searches among \a facets for the facet nearest to \a point and returns its index,
+     * or FACET_INDEX_MAX if there is none. The facets are gathered block-wise, so they
+     * don't need to be copied into an array first.
+     */
+    FacetIndex NearestFacet(const Base::Vector3f& point,
+                            const std::set<FacetIndex>& facets,
+                            float& distance,
+                            bool& positive) const;
+
+    /** @name Kernels on coordinate arrays */
+    //@{
+    /// Transforms \a count points with \a mat
+    static void
+    TransformPoints(float* x, float* y, float* z, std::size_t count, const Base::Matrix4D& mat);
+    /// Extends \a box by \a count points
+    static void AddToBoundBox(const float* x,
+                              const float* y,
+                              const float* z,
+                              std::size_t count,
+                              Base::BoundBox3f& box);
+    //@}
+
+    /** @name Kernels on point arrays
+     * The points are processed block-wise in the structure-of-arrays layout and
+     * spread over several threads for big arrays.
+     */
+    //@{
+    /// Transforms all points with \a mat and returns their bounding box
+    static Base::BoundBox3f TransformPoints(MeshPointArray& points, const Base::Matrix4D& mat);
+    /// Returns the bounding box of all points
+    static Base::BoundBox3f GetBoundBox(const MeshPointArray& points);
+    //@}
+
+private:
+    void Assign(const MeshKernel& kernel);
+
+private:
+    std::vector<float> _x, _y, _z;
+    std::vector<PointIndex> _indices;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_GEOMETRYVIEW_H
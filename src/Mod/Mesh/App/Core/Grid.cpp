@@ -24,9 +24,11 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
 #endif
 
 #include "Algorithm.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
@@ -70,7 +72,8 @@ void MeshGrid::Attach(const MeshKernel& rclM)
 
 void MeshGrid::Clear()
 {
-    _aulGrid.clear();
+    _aulGridOffsets.clear();
+    _aulGridElements.clear();
     _pclMesh = nullptr;
 }
 
@@ -128,14 +131,56 @@ void MeshGrid::InitGrid()
     }
 
     // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
+    _aulGridOffsets.assign(_ulCtGridsX * _ulCtGridsY * _ulCtGridsZ + 1, 0);
+    _aulGridElements.clear();
+}
+
+void MeshGrid::FillGrid(unsigned long ulCtElements, const GridIndexFunction& gridIndices)
+{
+    std::size_t ulCtGrids = _aulGridOffsets.size() - 1;
+    std::vector<std::atomic<std::size_t>> counts(ulCtGrids);
+
+    // count the elements of each grid
+    parallel_for(ulCtElements, [&](std::size_t begin, std::size_t end) {
+        std::vector<unsigned long> grids;
+        for (std::size_t i = begin; i < end; i++) {
+            grids.clear();
+            gridIndices(static_cast<ElementIndex>(i), grids);
+            for (auto grid : grids) {
+                counts[grid].fetch_add(1, std::memory_order_relaxed);
+            }
         }
-    }
+    });
+
+    // the counters are re-used as insert positions
+    _aulGridOffsets[0] = 0;
+    for (std::size_t i = 0; i < ulCtGrids; i++) {
+        std::size_t count = counts[i].load(std::memory_order_relaxed);
+        counts[i].store(_aulGridOffsets[i], std::memory_order_relaxed);
+        _aulGridOffsets[i + 1] = _aulGridOffsets[i] + count;
+    }
+    _aulGridElements.resize(_aulGridOffsets.back());
+
+    // store the elements
+    parallel_for(ulCtElements, [&](std::size_t begin, std::size_t end) {
+        std::vector<unsigned long> grids;
+        for (std::size_t i = begin; i < end; i++) {
+            grids.clear();
+            gridIndices(static_cast<ElementIndex>(i), grids);
+            for (auto grid : grids) {
+                std::size_t pos = counts[grid].fetch_add(1, std::memory_order_relaxed);
+                _aulGridElements[pos] = static_cast<ElementIndex>(i);
+            }
+        }
+    });
+
+    // sort the elements of each grid to be independent of the thread scheduling
+    parallel_for(ulCtGrids, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            std::sort(_aulGridElements.begin() + static_cast<std::ptrdiff_t>(_aulGridOffsets[i]),
+                      _aulGridElements.begin() + static_cast<std::ptrdiff_t>(_aulGridOffsets[i + 1]));
+        }
+    });
 }
 
 unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
@@ -158,9 +203,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(raulElements.end(),
-                                    _aulGrid[i][j][k].begin(),
-                                    _aulGrid[i][j][k].end());
+                GridElements elements = GetGridElements(i, j, k);
+                raulElements.insert(raulElements.end(), elements.begin(), elements.end());
             }
         }
     }
@@ -200,9 +244,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(raulElements.end(),
-                                        _aulGrid[i][j][k].begin(),
-                                        _aulGrid[i][j][k].end());
+                    GridElements elements = GetGridElements(i, j, k);
+                    raulElements.insert(raulElements.end(), elements.begin(), elements.end());
                 }
             }
         }
@@ -237,7 +280,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                GridElements elements = GetGridElements(i, j, k);
+                raulElements.insert(elements.begin(), elements.end());
             }
         }
     }
@@ -461,7 +505,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            GridElements elements = GetGridElements(nX, i, j);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nX++;
@@ -473,7 +518,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            GridElements elements = GetGridElements(nX, i, j);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nX++;
@@ -485,7 +531,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            GridElements elements = GetGridElements(i, nY, j);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nY++;
@@ -497,7 +544,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            GridElements elements = GetGridElements(i, nY, j);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nY--;
@@ -509,7 +557,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            GridElements elements = GetGridElements(i, j, nZ);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nZ++;
@@ -521,7 +570,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            GridElements elements = GetGridElements(i, j, nZ);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nZ--;
@@ -609,7 +659,7 @@ unsigned long MeshGrid::GetElements(unsigned long ulX,
                                     unsigned long ulZ,
                                     std::set<ElementIndex>& raclInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
+    GridElements rclSet = GetGridElements(ulX, ulY, ulZ);
     if (!rclSet.empty()) {
         raclInd.insert(rclSet.begin(), rclSet.end());
         return rclSet.size();
@@ -628,9 +678,8 @@ unsigned long MeshGrid::GetElements(const Base::Vector3f& rclPoint,
         return 0;
     }
 
-    aulFacets.resize(_aulGrid[ulX][ulY][ulZ].size());
-
-    std::copy(_aulGrid[ulX][ulY][ulZ].begin(), _aulGrid[ulX][ulY][ulZ].end(), aulFacets.begin());
+    GridElements elements = GetGridElements(ulX, ulY, ulZ);
+    aulFacets.assign(elements.begin(), elements.end());
     return aulFacets.size();
 }
 
@@ -747,13 +796,9 @@ void MeshFacetGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-    MeshFacetIterator clFIter(*_pclMesh);
-
-    unsigned long i = 0;
-    for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-        //    AddFacet(*clFIter, i++, 2.0f);
-        AddFacet(*clFIter, i++);
-    }
+    FillGrid(_ulCtElements, [&](ElementIndex index, std::vector<unsigned long>& grids) {
+        GetFacetGrids(_pclMesh->GetFacet(index), grids);
+    });
 }
 
 unsigned long MeshFacetGrid::SearchNearestFromPoint(const Base::Vector3f& rclPt) const
@@ -984,8 +1029,7 @@ void MeshFacetGrid::SearchNearestFacetInGrid(unsigned long ulX,
                                              float& rfMinDist,
                                              ElementIndex& rulFacetInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    for (ElementIndex pI : rclSet) {
+    for (ElementIndex pI : GetGridElements(ulX, ulY, ulZ)) {
         float fDist = _pclMesh->GetFacet(pI).DistanceToPoint(rclPt);
         if (fDist < rfMinDist) {
             rfMinDist = fDist;
@@ -994,6 +1038,45 @@ void MeshFacetGrid::SearchNearestFacetInGrid(unsigned long ulX,
     }
 }
 
+void MeshFacetGrid::SearchNearestFromPoints(const std::vector<Base::Vector3f>& raclPts,
+                                            std::vector<ElementIndex>& raulFacetInd,
+                                            float fMaxSearchArea) const
+{
+    raulFacetInd.resize(raclPts.size());
+    parallel_for(
+        raclPts.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                raulFacetInd[i] = fMaxSearchArea < FLOAT_MAX
+                    ? SearchNearestFromPoint(raclPts[i], fMaxSearchArea)
+                    : SearchNearestFromPoint(raclPts[i]);
+            }
+        },
+        1000);
+}
+
+void MeshFacetGrid::SearchNearestOnRays(const std::vector<Base::Vector3f>& raclPts,
+                                        const std::vector<Base::Vector3f>& raclDirs,
+                                        std::vector<ElementIndex>& raulFacetInd,
+                                        std::vector<Base::Vector3f>& raclRes) const
+{
+    std::size_t count = std::min(raclPts.size(), raclDirs.size());
+    raulFacetInd.assign(count, ELEMENT_INDEX_MAX);
+    raclRes.resize(count);
+    MeshAlgorithm clAlg(*_pclMesh);
+    parallel_for(
+        count,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                FacetIndex ulFacet {};
+                if (clAlg.NearestFacetOnRay(raclPts[i], raclDirs[i], *this, raclRes[i], ulFacet)) {
+                    raulFacetInd[i] = ulFacet;
+                }
+            }
+        },
+        1000);
+}
+
 //----------------------------------------------------------------------------
 
 MeshPointGrid::MeshPointGrid(const MeshKernel& rclM)
@@ -1028,15 +1111,15 @@ MeshPointGrid::MeshPointGrid(const MeshKernel& rclM, float fGridLen)
             std::max<unsigned long>(static_cast<unsigned long>(clBBMesh.LengthZ() / fGridLen), 1));
 }
 
-void MeshPointGrid::AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon)
+void MeshPointGrid::GetPointGrids(const MeshPoint& rclPt,
+                                  std::vector<unsigned long>& raulGrids) const
 {
-    (void)fEpsilon;
     unsigned long ulX {};
     unsigned long ulY {};
     unsigned long ulZ {};
     Pos(Base::Vector3f(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
     if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
+        raulGrids.push_back(GetIndexToPosition(ulX, ulY, ulZ));
     }
 }
 
@@ -1093,13 +1176,10 @@ void MeshPointGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-
-    MeshPointIterator cPIter(*_pclMesh);
-
-    unsigned long i = 0;
-    for (cPIter.Init(); cPIter.More(); cPIter.Next()) {
-        AddPoint(*cPIter, i++);
-    }
+    const MeshPointArray& rPoints = _pclMesh->GetPoints();
+    FillGrid(_ulCtElements, [&](ElementIndex index, std::vector<unsigned long>& grids) {
+        GetPointGrids(rPoints[index], grids);
+    });
 }
 
 void MeshPointGrid::Pos(const Base::Vector3f& rclPoint,
@@ -1164,9 +1244,8 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // Determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        MeshGrid::GridElements elements = _rclGrid.GetGridElements(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), elements.begin(), elements.end());
         _bValidRay = true;
     }
     else {  // Start point outside
@@ -1181,9 +1260,8 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(raulElements.end(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+            MeshGrid::GridElements elements = _rclGrid.GetGridElements(_ulX, _ulY, _ulZ);
+            raulElements.insert(raulElements.end(), elements.begin(), elements.end());
             _bValidRay = true;
         }
     }
@@ -1247,9 +1325,8 @@ bool MeshGridIterator::NextOnRay(std::vector<ElementIndex>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        MeshGrid::GridElements elements = _rclGrid.GetGridElements(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), elements.begin(), elements.end());
     }
     else {
         _bValidRay = false;  // Beam leaked
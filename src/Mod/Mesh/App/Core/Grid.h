@@ -23,7 +23,9 @@
 #ifndef MESH_GRID_H
 #define MESH_GRID_H
 
+#include <functional>
 #include <set>
+#include <vector>
 
 #include <Base/BoundBox.h>
 
@@ -68,6 +70,36 @@ protected:
     //@}
 
 public:
+    /** Range of the sorted element indices stored in a grid element. */
+    class GridElements
+    {
+    public:
+        GridElements(const ElementIndex* first, const ElementIndex* last)
+            : first(first)
+            , last(last)
+        {}
+        const ElementIndex* begin() const
+        {
+            return first;
+        }
+        const ElementIndex* end() const
+        {
+            return last;
+        }
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(last - first);
+        }
+        bool empty() const
+        {
+            return first == last;
+        }
+
+    private:
+        const ElementIndex* first;
+        const ElementIndex* last;
+    };
+
     /// Destruction
     virtual ~MeshGrid() = default;
 
@@ -109,6 +141,9 @@ public:
                               std::set<ElementIndex>& raclInd) const;
     unsigned long GetElements(const Base::Vector3f& rclPoint,
                               std::vector<ElementIndex>& aulFacets) const;
+    /** Returns the range of the element indices in the given grid. */
+    inline GridElements
+    GetGridElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const;
     //@}
 
     /** Returns the lengths of the grid elements in x,y and z direction. */
@@ -151,7 +186,7 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return static_cast<unsigned long>(_aulGrid[ulX][ulY][ulZ].size());
+        return static_cast<unsigned long>(GetGridElements(ulX, ulY, ulZ).size());
     }
     /** Validates the grid structure and rebuilds it if needed. Must be implemented in sub-classes.
      */
@@ -192,11 +227,18 @@ protected:
     virtual void RebuildGrid() = 0;
     /** Returns the number of stored elements. Must be implemented in sub-classes. */
     virtual unsigned long HasElements() const = 0;
+    /** Collects the indices (see GetIndexToPosition()) of the grid elements an element lies in. */
+    using GridIndexFunction = std::function<void(ElementIndex, std::vector<unsigned long>&)>;
+    /** Fills the initialized grid structure with the elements 0 to \a ulCtElements - 1. The
+     * elements are counted per grid element in a first pass and stored in a second pass, both run
+     * concurrently, so \a gridIndices must be thread-safe. */
+    void FillGrid(unsigned long ulCtElements, const GridIndexFunction& gridIndices);
 
 protected:
     // NOLINTBEGIN
-    std::vector<std::vector<std::vector<std::set<ElementIndex>>>>
-        _aulGrid;                /**< Grid data structure. */
+    std::vector<std::size_t> _aulGridOffsets; /**< Offsets of the grid elements in
+                                                 _aulGridElements, one entry more than grids. */
+    std::vector<ElementIndex> _aulGridElements; /**< Element indices of all grid elements. */
     const MeshKernel* _pclMesh;  /**< The mesh kernel. */
     unsigned long _ulCtElements; /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;   /**< Number of grid elements in z. */
@@ -264,6 +306,18 @@ public:
                                   const Base::Vector3f& rclPt,
                                   ElementIndex& rulFacetInd,
                                   float& rfMinDist) const;
+    /** Searches concurrently for the nearest facet of each point within the maximum search area.
+     * If no facet is found the index is set to ELEMENT_INDEX_MAX. */
+    void SearchNearestFromPoints(const std::vector<Base::Vector3f>& raclPts,
+                                 std::vector<ElementIndex>& raulFacetInd,
+                                 float fMaxSearchArea = FLOAT_MAX) const;
+    /** Searches concurrently for the nearest facet hit by each ray (\a raclPts[i], \a
+     * raclDirs[i]). \a raclRes holds the intersection points. If a ray doesn't hit any facet the
+     * index is set to ELEMENT_INDEX_MAX. */
+    void SearchNearestOnRays(const std::vector<Base::Vector3f>& raclPts,
+                             const std::vector<Base::Vector3f>& raclDirs,
+                             std::vector<ElementIndex>& raulFacetInd,
+                             std::vector<Base::Vector3f>& raclRes) const;
     //@}
 
     /** Validates the grid structure and rebuilds it if needed. */
@@ -284,11 +338,9 @@ protected:
                              unsigned long& rulX,
                              unsigned long& rulY,
                              unsigned long& rulZ) const;
-    /** Adds a new facet element to the grid structure. \a rclFacet is the geometric facet and \a
-     * ulFacetIndex the corresponding index in the mesh kernel. The facet is added to each grid
-     * element that intersects the facet. */
-    inline void
-    AddFacet(const MeshGeomFacet& rclFacet, ElementIndex ulFacetIndex, float fEpsilon = 0.0F);
+    /** Collects the indices of the grid elements that intersect the facet \a rclFacet. */
+    inline void GetFacetGrids(const MeshGeomFacet& rclFacet,
+                              std::vector<unsigned long>& raulGrids) const;
     /** Returns the number of stored elements. */
     unsigned long HasElements() const override
     {
@@ -336,9 +388,8 @@ public:
     bool Verify() const override;
 
 protected:
-    /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
-     * ulPtIndex the corresponding index in the mesh kernel. */
-    void AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon = 0.0F);
+    /** Collects the index of the grid element the point \a rclPt lies in. */
+    void GetPointGrids(const MeshPoint& rclPt, std::vector<unsigned long>& raulGrids) const;
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(const Base::Vector3f& rclPoint,
              unsigned long& rulX,
@@ -370,9 +421,8 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<ElementIndex>& raulElements) const
     {
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        MeshGrid::GridElements elements = _rclGrid.GetGridElements(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), elements.begin(), elements.end());
     }
     /** Returns the number of elements in the current grid. */
     unsigned long GetCtElements() const
@@ -485,6 +535,14 @@ MeshGrid::GetBoundBox(unsigned long ulX, unsigned long ulY, unsigned long ulZ) c
     return Base::BoundBox3f(fX, fY, fZ, fX + _fGridLenX, fY + _fGridLenY, fZ + _fGridLenZ);
 }
 
+inline MeshGrid::GridElements
+MeshGrid::GetGridElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+{
+    std::size_t index = (ulZ * _ulCtGridsY + ulY) * _ulCtGridsX + ulX;
+    const ElementIndex* data = _aulGridElements.data();
+    return {data + _aulGridOffsets[index], data + _aulGridOffsets[index + 1]};
+}
+
 inline Base::BoundBox3f MeshGrid::GetBoundBox() const
 {
     return Base::BoundBox3f(_fMinX,
@@ -560,9 +618,8 @@ inline void MeshFacetGrid::PosWithCheck(const Base::Vector3f& rclPoint,
     assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
 }
 
-inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
-                                    ElementIndex ulFacetIndex,
-                                    float /*fEpsilon*/)
+inline void MeshFacetGrid::GetFacetGrids(const MeshGeomFacet& rclFacet,
+                                         std::vector<unsigned long>& raulGrids) const
 {
     unsigned long ulX {};
     unsigned long ulY {};
@@ -604,14 +661,14 @@ inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
             for (ulY = ulY1; ulY <= ulY2; ulY++) {
                 for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                     if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                        _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                        raulGrids.push_back(GetIndexToPosition(ulX, ulY, ulZ));
                     }
                 }
             }
         }
     }
     else {
-        _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+        raulGrids.push_back(GetIndexToPosition(ulX1, ulY1, ulZ1));
     }
 }
 
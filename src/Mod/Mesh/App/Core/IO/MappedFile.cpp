@@ -0,0 +1,190 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#if defined(FC_OS_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#endif
+
+#include <Base/FileInfo.h>
+
+#include "MappedFile.h"
+
+
+using namespace MeshCore;
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+#if defined(FC_OS_WIN32)
+bool MappedFile::open(const Base::FileInfo& fi)
+{
+    close();
+
+    HANDLE file = CreateFileW(fi.toStdWString().c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size {};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    _file = file;
+    _mapping = mapping;
+    _data = static_cast<const char*>(data);
+    _size = static_cast<std::size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (_data) {
+        UnmapViewOfFile(_data);
+    }
+    if (_mapping) {
+        CloseHandle(_mapping);
+    }
+    if (_file) {
+        CloseHandle(_file);
+    }
+    _data = nullptr;
+    _mapping = nullptr;
+    _file = nullptr;
+    _size = 0;
+}
+#else
+bool MappedFile::open(const Base::FileInfo& fi)
+{
+    close();
+
+    int fd = ::open(fi.filePath().c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after closing the file
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+#if defined(POSIX_MADV_SEQUENTIAL)
+    posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+#endif
+
+    _data = static_cast<const char*>(data);
+    _size = size;
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (_data) {
+        munmap(const_cast<char*>(_data), _size);  // NOLINT
+    }
+    _data = nullptr;
+    _size = 0;
+}
+#endif
+
+// ----------------------------------------------------------------------------
+
+MemoryStreamBuf::MemoryStreamBuf(const char* data, std::size_t size)
+{
+    // the get area is never written to
+    char* begin = const_cast<char*>(data);  // NOLINT
+    setg(begin, begin, begin + size);
+}
+
+void MemoryStreamBuf::consume(std::size_t count)
+{
+    setg(eback(), gptr() + std::min(count, available()), egptr());
+}
+
+MemoryStreamBuf::pos_type
+MemoryStreamBuf::seekoff(off_type off, std::ios_base::seekdir way, std::ios_base::openmode which)
+{
+    if ((which & std::ios_base::in) == 0) {
+        return pos_type(off_type(-1));
+    }
+
+    off_type base {};
+    if (way == std::ios_base::cur) {
+        base = gptr() - eback();
+    }
+    else if (way == std::ios_base::end) {
+        base = egptr() - eback();
+    }
+
+    off_type pos = base + off;
+    if (pos < 0 || pos > egptr() - eback()) {
+        return pos_type(off_type(-1));
+    }
+
+    setg(eback(), eback() + pos, egptr());
+    return pos_type(pos);
+}
+
+MemoryStreamBuf::pos_type MemoryStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
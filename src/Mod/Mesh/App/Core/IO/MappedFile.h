@@ -0,0 +1,110 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#ifndef MESH_IO_MAPPED_FILE_H
+#define MESH_IO_MAPPED_FILE_H
+
+#include <cstddef>
+#include <streambuf>
+#include <FCConfig.h>
+#include <Mod/Mesh/MeshGlobal.h>
+
+namespace Base
+{
+class FileInfo;
+}
+
+namespace MeshCore
+{
+
+/** Read-only memory mapping of a whole file. */
+class MeshExport MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /** Maps the file \a fi into memory. Returns false if the file is empty or
+     * cannot be mapped, the caller should read it through a stream then.
+     */
+    bool open(const Base::FileInfo& fi);
+    void close();
+    bool isOpen() const
+    {
+        return _data != nullptr;
+    }
+    const char* data() const
+    {
+        return _data;
+    }
+    std::size_t size() const
+    {
+        return _size;
+    }
+
+private:
+    const char* _data = nullptr;
+    std::size_t _size = 0;
+#ifdef FC_OS_WIN32
+    void* _file = nullptr;
+    void* _mapping = nullptr;
+#endif
+};
+
+/** Stream buffer that reads from a block of memory without copying it.
+ * The readers of MeshInput access the data of this buffer directly instead
+ * of going through the stream functions.
+ */
+class MeshExport MemoryStreamBuf: public std::streambuf
+{
+public:
+    MemoryStreamBuf(const char* data, std::size_t size);
+
+    /// Returns the data that hasn't been read yet
+    const char* current() const
+    {
+        return gptr();
+    }
+    /// Returns the number of bytes that haven't been read yet
+    std::size_t available() const
+    {
+        return static_cast<std::size_t>(egptr() - gptr());
+    }
+    /// Marks \a count bytes as read
+    void consume(std::size_t count);
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir way, std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_IO_MAPPED_FILE_H
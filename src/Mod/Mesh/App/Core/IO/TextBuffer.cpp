@@ -0,0 +1,145 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <locale>
+#include <sstream>
+#endif
+
+#include "TextBuffer.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// Scaling a float by a power of ten up to 10^10 is exact in double precision, so rounding the
+// product gives the same digits as the stream functions that round the exact binary value.
+const double powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10};
+}  // namespace
+
+void TextBuffer::appendInteger(long long value)
+{
+    char buf[24];
+    auto res = std::to_chars(std::begin(buf), std::end(buf), value);
+    text.append(buf, res.ptr);
+}
+
+void TextBuffer::appendInteger(unsigned long long value)
+{
+    char buf[24];
+    auto res = std::to_chars(std::begin(buf), std::end(buf), value);
+    text.append(buf, res.ptr);
+}
+
+void TextBuffer::appendStream(float value)
+{
+    std::ostringstream str;
+    str.imbue(std::locale::classic());
+    if (fixed) {
+        str.precision(6);
+        str.setf(std::ios::fixed | std::ios::showpoint);
+    }
+    str << value;
+    text.append(str.str());
+}
+
+void TextBuffer::appendFixed(float value)
+{
+    double abs = std::fabs(double(value));
+    if (!(abs < 1e12)) {
+        appendStream(value);  // inf, nan or too big for the integer conversion
+        return;
+    }
+
+    auto digits = static_cast<std::uint64_t>(std::nearbyint(abs * 1e6));
+    if (std::signbit(value)) {
+        text.push_back('-');
+    }
+    appendInteger(static_cast<unsigned long long>(digits / 1000000));
+
+    char frac[7] = {'.', '0', '0', '0', '0', '0', '0'};
+    std::uint64_t rest = digits % 1000000;
+    for (int i = 6; i > 0; i--) {
+        frac[i] = static_cast<char>('0' + rest % 10);
+        rest /= 10;
+    }
+    text.append(frac, sizeof(frac));
+}
+
+void TextBuffer::appendGeneral(float value)
+{
+    double abs = std::fabs(double(value));
+    if (abs == 0.0) {
+        text.append(std::signbit(value) ? "-0" : "0");
+        return;
+    }
+    if (!(abs >= 1e-5 && abs < 1e6)) {
+        appendStream(value);  // scientific notation, inf or nan
+        return;
+    }
+
+    // decimal exponent of the value, the product is exact and must not be rounded here
+    int exp = 5;
+    while (exp > -5 && abs * powersOfTen[5 - exp] < 100000.0) {
+        exp--;
+    }
+    int decimals = 5 - exp;
+    auto digits = static_cast<std::uint64_t>(std::nearbyint(abs * powersOfTen[decimals]));
+    if (digits >= 1000000) {
+        // rounded up to the next power of ten
+        exp++;
+        decimals--;
+        digits /= 10;
+    }
+    if (exp < -4 || exp > 5) {
+        appendStream(value);
+        return;
+    }
+
+    if (std::signbit(value)) {
+        text.push_back('-');
+    }
+
+    std::uint64_t scale = static_cast<std::uint64_t>(powersOfTen[decimals]);
+    appendInteger(static_cast<unsigned long long>(digits / scale));
+    std::uint64_t rest = digits % scale;
+    if (rest != 0) {
+        // remove trailing zeros
+        while (rest % 10 == 0) {
+            rest /= 10;
+            decimals--;
+        }
+        char frac[12];
+        frac[0] = '.';
+        for (int i = decimals; i > 0; i--) {
+            frac[i] = static_cast<char>('0' + rest % 10);
+            rest /= 10;
+        }
+        text.append(frac, decimals + 1);
+    }
+}
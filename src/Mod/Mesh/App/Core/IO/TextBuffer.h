@@ -0,0 +1,164 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#ifndef MESH_IO_TEXT_BUFFER_H
+#define MESH_IO_TEXT_BUFFER_H
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <Base/Sequencer.h>
+#include <Mod/Mesh/App/Core/Functional.h>
+#include <Mod/Mesh/MeshGlobal.h>
+
+namespace MeshCore
+{
+
+/** Text buffer to format the numbers of a mesh file.
+ * The output is the same as of a std::ostream with the classic locale and
+ * precision 6, either in the default or in fixed notation. The common numbers
+ * are converted without the overhead of the stream functions, so that several
+ * threads can format parts of a file concurrently.
+ */
+class MeshExport TextBuffer
+{
+public:
+    TextBuffer() = default;
+
+    /// Uses fixed notation for floating point numbers like std::fixed
+    void setFixed(bool on)
+    {
+        fixed = on;
+    }
+    void clear()
+    {
+        text.clear();
+    }
+    const char* data() const
+    {
+        return text.data();
+    }
+    std::size_t size() const
+    {
+        return text.size();
+    }
+
+    TextBuffer& operator<<(const char* str)
+    {
+        text.append(str);
+        return *this;
+    }
+    TextBuffer& operator<<(const std::string& str)
+    {
+        text.append(str);
+        return *this;
+    }
+    TextBuffer& operator<<(char ch)
+    {
+        text.push_back(ch);
+        return *this;
+    }
+    TextBuffer& operator<<(float value)
+    {
+        if (fixed) {
+            appendFixed(value);
+        }
+        else {
+            appendGeneral(value);
+        }
+        return *this;
+    }
+    template<typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+    TextBuffer& operator<<(T value)
+    {
+        if constexpr (std::is_signed_v<T>) {
+            appendInteger(static_cast<long long>(value));
+        }
+        else {
+            appendInteger(static_cast<unsigned long long>(value));
+        }
+        return *this;
+    }
+
+private:
+    void appendFixed(float value);
+    void appendGeneral(float value);
+    void appendInteger(long long value);
+    void appendInteger(unsigned long long value);
+    void appendStream(float value);
+
+private:
+    std::string text;
+    bool fixed = false;
+};
+
+/** Formats \a count elements in chunks in parallel and writes them to \a out
+ * in their original order. \a func(buffer, begin, end) must format the
+ * elements [begin, end) into the buffer. If given \a seq advances by one
+ * step per element.
+ */
+template<class Func>
+void writeTextChunks(std::ostream& out,
+                     std::size_t count,
+                     bool fixed,
+                     Func func,
+                     Base::SequencerLauncher* seq = nullptr)
+{
+    const std::size_t chunkSize = 16384;
+    std::size_t threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<TextBuffer> buffers(threads);
+    for (auto& buffer : buffers) {
+        buffer.setFixed(fixed);
+    }
+
+    for (std::size_t start = 0; start < count; start += threads * chunkSize) {
+        std::size_t numChunks = std::min(threads, (count - start + chunkSize - 1) / chunkSize);
+        parallel_for(
+            numChunks,
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    std::size_t first = start + i * chunkSize;
+                    buffers[i].clear();
+                    func(buffers[i], first, std::min(first + chunkSize, count));
+                }
+            },
+            1);
+
+        for (std::size_t i = 0; i < numChunks; i++) {
+            out.write(buffers[i].data(), static_cast<std::streamsize>(buffers[i].size()));
+        }
+        std::size_t end = seq ? std::min(start + threads * chunkSize, count) : start;
+        for (std::size_t i = start; i < end; i++) {
+            seq->next(true);  // allow to cancel
+        }
+    }
+}
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_IO_TEXT_BUFFER_H
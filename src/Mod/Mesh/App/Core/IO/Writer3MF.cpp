@@ -30,6 +30,7 @@
 #include "Core/MeshKernel.h"
 #include <Base/Tools.h>
 
+#include "TextBuffer.h"
 #include "Writer3MF.h"
 
 
@@ -126,19 +127,26 @@ bool Writer3MF::SaveObject(std::ostream& str, int id, const MeshKernel& mesh) co
 
     // vertices
     str << Base::blanks(4) << "<vertices>\n";
-    std::size_t index = 0;
-    for (auto it = rPoints.begin(); it != rPoints.end(); ++it, ++index) {
-        str << Base::blanks(5) << "<vertex x=\"" << it->x << "\" y=\"" << it->y << "\" z=\""
-            << it->z << "\" />\n";
-    }
+    auto writePoints = [&rPoints](TextBuffer& buf, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshPoint& pnt = rPoints[i];
+            buf << "     <vertex x=\"" << pnt.x << "\" y=\"" << pnt.y << "\" z=\"" << pnt.z
+                << "\" />\n";
+        }
+    };
+    writeTextChunks(str, rPoints.size(), false, writePoints);
     str << Base::blanks(4) << "</vertices>\n";
 
     // facet indices
     str << Base::blanks(4) << "<triangles>\n";
-    for (const auto& it : rFacets) {
-        str << Base::blanks(5) << "<triangle v1=\"" << it._aulPoints[0] << "\" v2=\""
-            << it._aulPoints[1] << "\" v3=\"" << it._aulPoints[2] << "\" />\n";
-    }
+    auto writeFacets = [&rFacets](TextBuffer& buf, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& facet = rFacets[i];
+            buf << "     <triangle v1=\"" << facet._aulPoints[0] << "\" v2=\""
+                << facet._aulPoints[1] << "\" v3=\"" << facet._aulPoints[2] << "\" />\n";
+        }
+    };
+    writeTextChunks(str, rFacets.size(), false, writeFacets);
     str << Base::blanks(4) << "</triangles>\n";
 
     str << Base::blanks(3) << "</mesh>\n";
@@ -27,6 +27,7 @@
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
 
+#include "TextBuffer.h"
 #include "WriterOBJ.h"
 
 
@@ -120,51 +121,49 @@ bool WriterOBJ::Save(std::ostream& out)
     out.setf(std::ios::fixed | std::ios::showpoint);
 
     // vertices
-    Base::Vector3f pt;
-    std::size_t index = 0;
-    for (MeshPointArray::_TConstIterator it = rPoints.begin(); it != rPoints.end(); ++it, ++index) {
-        if (this->apply_transform) {
-            pt = this->_transform * *it;
-        }
-        else {
-            pt.Set(it->x, it->y, it->z);
-        }
-
-        if (exportColorPerVertex) {
-            App::Color c;
-            if (_material->binding == MeshIO::PER_VERTEX) {
-                c = _material->diffuseColor[index];
+    auto writePoints = [&](TextBuffer& str, std::size_t begin, std::size_t end) {
+        Base::Vector3f pt;
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshPoint& it = rPoints[index];
+            if (this->apply_transform) {
+                pt = this->_transform * it;
             }
             else {
-                c = _material->diffuseColor.front();
+                pt.Set(it.x, it.y, it.z);
             }
 
-            int r = static_cast<int>(c.r * 255.0f);
-            int g = static_cast<int>(c.g * 255.0f);
-            int b = static_cast<int>(c.b * 255.0f);
+            if (exportColorPerVertex) {
+                App::Color c;
+                if (_material->binding == MeshIO::PER_VERTEX) {
+                    c = _material->diffuseColor[index];
+                }
+                else {
+                    c = _material->diffuseColor.front();
+                }
 
-            out << "v " << pt.x << " " << pt.y << " " << pt.z << " " << r << " " << g << " " << b
-                << '\n';
-        }
-        else {
-            out << "v " << pt.x << " " << pt.y << " " << pt.z << '\n';
+                int r = static_cast<int>(c.r * 255.0f);
+                int g = static_cast<int>(c.g * 255.0f);
+                int b = static_cast<int>(c.b * 255.0f);
+
+                str << "v " << pt.x << " " << pt.y << " " << pt.z << " " << r << " " << g << " "
+                    << b << '\n';
+            }
+            else {
+                str << "v " << pt.x << " " << pt.y << " " << pt.z << '\n';
+            }
         }
-        seq.next(true);  // allow to cancel
-    }
+    };
+    writeTextChunks(out, rPoints.size(), true, writePoints, &seq);
+
     // Export normals
-    MeshFacetIterator clIter(_kernel), clEnd(_kernel);
-    const MeshGeomFacet* pclFacet {};
-
-    clIter.Begin();
-    clEnd.End();
-
-    while (clIter < clEnd) {
-        pclFacet = &(*clIter);
-        out << "vn " << pclFacet->GetNormal().x << " " << pclFacet->GetNormal().y << " "
-            << pclFacet->GetNormal().z << '\n';
-        ++clIter;
-        seq.next(true);  // allow to cancel
-    }
+    auto writeNormals = [this](TextBuffer& str, std::size_t begin, std::size_t end) {
+        MeshFacetIterator clIter(_kernel);
+        for (clIter.Set(begin); clIter.Position() < end; ++clIter) {
+            Base::Vector3f normal = clIter->GetNormal();
+            str << "vn " << normal.x << " " << normal.y << " " << normal.z << '\n';
+        }
+    };
+    writeTextChunks(out, rFacets.size(), true, writeNormals, &seq);
 
     if (_groups.empty()) {
         if (exportColorPerFace) {
@@ -198,14 +197,15 @@ bool WriterOBJ::Save(std::ostream& out)
         }
         else {
             // facet indices (no texture and normal indices)
-            std::size_t faceIdx = 1;
-            for (const auto& it : rFacets) {
-                out << "f " << it._aulPoints[0] + 1 << "//" << faceIdx << " "
-                    << it._aulPoints[1] + 1 << "//" << faceIdx << " " << it._aulPoints[2] + 1
-                    << "//" << faceIdx << '\n';
-                seq.next(true);  // allow to cancel
-                faceIdx++;
-            }
+            auto writeFacets = [&rFacets](TextBuffer& str, std::size_t begin, std::size_t end) {
+                for (std::size_t faceIdx = begin + 1; faceIdx <= end; faceIdx++) {
+                    const MeshFacet& it = rFacets[faceIdx - 1];
+                    str << "f " << it._aulPoints[0] + 1 << "//" << faceIdx << " "
+                        << it._aulPoints[1] + 1 << "//" << faceIdx << " " << it._aulPoints[2] + 1
+                        << "//" << faceIdx << '\n';
+                }
+            };
+            writeTextChunks(out, rFacets.size(), true, writeFacets, &seq);
         }
     }
     else {
@@ -24,7 +24,9 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string_view>
@@ -36,8 +38,10 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
 
+#include "IO/MappedFile.h"
 #include "IO/Reader3MF.h"
 #include "IO/ReaderOBJ.h"
+#include "IO/TextBuffer.h"
 #include "IO/Writer3MF.h"
 #include "IO/WriterInventor.h"
 #include "IO/WriterOBJ.h"
@@ -49,6 +53,7 @@
 #include <Base/Reader.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/Swap.h>
 #include <Base/Tools.h>
 #include <Base/Writer.h>
 #include <zipios++/gzipoutputstream.h>
@@ -57,6 +62,7 @@
 #include "Builder.h"
 #include "Definitions.h"
 #include "Degeneration.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshIO.h"
 #include "MeshKernel.h"
@@ -200,6 +206,14 @@ bool MeshInput::LoadAny(const char* FileName)
         throw Base::FileException("No permission on the file", FileName);
     }
 
+    // binary STL and PLY files are parsed directly from the mapped file
+    MappedFile mapping;
+    if (fi.hasExtension({"stl", "ast", "ply"}) && mapping.open(fi)) {
+        MemoryStreamBuf buf(mapping.data(), mapping.size());
+        std::istream str(&buf);
+        return fi.hasExtension("ply") ? LoadPLY(str) : LoadSTL(str);
+    }
+
     Base::ifstream str(fi, std::ios::in | std::ios::binary);
 
     if (fi.hasExtension("bms")) {
@@ -653,6 +667,165 @@ struct Property
 using namespace Ply;
 }  // namespace MeshCore
 
+namespace
+{
+std::size_t plySize(Ply::Number number)
+{
+    switch (number) {
+        case int8:
+        case uint8:
+            return 1;
+        case int16:
+        case uint16:
+            return 2;
+        case int32:
+        case uint32:
+        case float32:
+            return 4;
+        case float64:
+            return 8;
+    }
+    return 0;
+}
+
+template<typename T>
+T plyRead(const char* data, bool swap)
+{
+    T value {};
+    std::memcpy(&value, data, sizeof(T));
+    if (swap) {
+        Base::SwapEndian<T>(value);
+    }
+    return value;
+}
+
+float plyValue(const char* data, Ply::Number number, bool swap)
+{
+    switch (number) {
+        case int8:
+            return static_cast<float>(plyRead<int8_t>(data, swap));
+        case uint8:
+            return static_cast<float>(plyRead<uint8_t>(data, swap));
+        case int16:
+            return static_cast<float>(plyRead<int16_t>(data, swap));
+        case uint16:
+            return static_cast<float>(plyRead<uint16_t>(data, swap));
+        case int32:
+            return static_cast<float>(plyRead<int32_t>(data, swap));
+        case uint32:
+            return static_cast<float>(plyRead<uint32_t>(data, swap));
+        case float32:
+            return plyRead<float>(data, swap);
+        case float64:
+            return static_cast<float>(plyRead<double>(data, swap));
+    }
+    return 0.0F;
+}
+
+/** Reads the binary vertices and faces of a PLY file in parallel from memory.
+ * Returns false if the layout isn't supported, nothing is read then.
+ */
+bool readBinaryPLY(MemoryStreamBuf& buf,
+                   bool swap,
+                   const std::vector<std::pair<std::string, Ply::Number>>& vertex_props,
+                   std::size_t v_count,
+                   const std::vector<Ply::Number>& face_props,
+                   std::size_t f_count,
+                   MeshPointArray& meshPoints,
+                   MeshFacetArray& meshFacets,
+                   std::vector<App::Color>* colors)
+{
+    std::size_t vertexSize = 0;
+    std::map<std::string, std::pair<std::size_t, Ply::Number>> vertexLayout;
+    for (const auto& it : vertex_props) {
+        vertexLayout[it.first] = std::make_pair(vertexSize, it.second);
+        vertexSize += plySize(it.second);
+    }
+
+    // a face must be a triangle with a uchar count and uint32 indices
+    std::size_t faceSize = 1 + 3 * sizeof(uint32_t);
+    for (auto it : face_props) {
+        if (it == float32 || it == float64) {
+            return false;  // handled as lists
+        }
+        faceSize += plySize(it);
+    }
+
+    if (vertexSize == 0 || v_count > buf.available() / vertexSize
+        || f_count > (buf.available() - v_count * vertexSize) / faceSize) {
+        return false;
+    }
+
+    const char* vertexData = buf.current();
+    const char* faceData = vertexData + v_count * vertexSize;
+
+    // check the faces first as there is no fallback after filling the arrays
+    std::atomic<bool> triangles {true};
+    parallel_for(f_count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end && triangles; i++) {
+            if (faceData[i * faceSize] != 3) {
+                triangles = false;
+            }
+        }
+    });
+    if (!triangles) {
+        return false;
+    }
+
+    auto x = vertexLayout["x"];
+    auto y = vertexLayout["y"];
+    auto z = vertexLayout["z"];
+    meshPoints.resize(v_count);
+    parallel_for(v_count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const char* vertex = vertexData + i * vertexSize;
+            meshPoints[i].Set(plyValue(vertex + x.first, x.second, swap),
+                              plyValue(vertex + y.first, y.second, swap),
+                              plyValue(vertex + z.first, z.second, swap));
+        }
+    });
+
+    if (colors) {
+        auto r = vertexLayout["red"];
+        auto g = vertexLayout["green"];
+        auto b = vertexLayout["blue"];
+        colors->resize(v_count);
+        parallel_for(v_count, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                const char* vertex = vertexData + i * vertexSize;
+                (*colors)[i].set(plyValue(vertex + r.first, r.second, swap) / 255.0F,
+                                 plyValue(vertex + g.first, g.second, swap) / 255.0F,
+                                 plyValue(vertex + b.first, b.second, swap) / 255.0F);
+            }
+        });
+    }
+
+    // faces with invalid indices are marked and removed afterwards
+    meshFacets.resize(f_count);
+    parallel_for(f_count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const char* face = faceData + i * faceSize + 1;
+            MeshFacet& facet = meshFacets[i];
+            for (int j = 0; j < 3; j++) {
+                uint32_t index = plyRead<uint32_t>(face + j * sizeof(uint32_t), swap);
+                facet._aulPoints[j] = index < v_count ? index : POINT_INDEX_MAX;
+            }
+        }
+    });
+    meshFacets.erase(std::remove_if(meshFacets.begin(),
+                                    meshFacets.end(),
+                                    [](const MeshFacet& facet) {
+                                        return facet._aulPoints[0] == POINT_INDEX_MAX
+                                            || facet._aulPoints[1] == POINT_INDEX_MAX
+                                            || facet._aulPoints[2] == POINT_INDEX_MAX;
+                                    }),
+                     meshFacets.end());
+
+    buf.consume(v_count * vertexSize + f_count * faceSize);
+    return true;
+}
+}  // namespace
+
 bool MeshInput::LoadPLY(std::istream& inp)
 {
     // http://local.wasp.uwa.edu.au/~pbourke/dataformats/ply/
@@ -993,6 +1166,22 @@ bool MeshInput::LoadPLY(std::istream& inp)
             }
         }
     }
+    // binary data of a mapped file
+    else if (auto mem = dynamic_cast<MemoryStreamBuf*>(buf);
+             mem
+             && readBinaryPLY(*mem,
+                              format == binary_big_endian,
+                              vertex_props,
+                              v_count,
+                              face_props,
+                              f_count,
+                              meshPoints,
+                              meshFacets,
+                              _material && rgb_value == MeshIO::PER_VERTEX
+                                  ? &_material->diffuseColor
+                                  : nullptr)) {
+        // everything is read
+    }
     // binary
     else {
         Base::InputStream is(inp);
@@ -1275,8 +1464,6 @@ bool MeshInput::LoadAsciiSTL(std::istream& rstrIn)
 bool MeshInput::LoadBinarySTL(std::istream& rstrIn)
 {
     char szInfo[80];
-    Base::Vector3f clVects[4];
-    uint16_t usAtt = 0;
     uint32_t ulCt = 0;
 
     if (!rstrIn || rstrIn.bad()) {
@@ -1309,25 +1496,37 @@ bool MeshInput::LoadBinarySTL(std::istream& rstrIn)
         return false;  // not a valid STL file
     }
 
-#if 0
-    MeshBuilder builder(this->_rclMesh);
-#else
-    MeshFastBuilder builder(this->_rclMesh);
-#endif
-    builder.Initialize(ulCt);
-
-    for (uint32_t i = 0; i < ulCt; i++) {
-        // read normal, points
-        rstrIn.read((char*)&clVects, sizeof(clVects));
+    // a record consists of the normal, the three points and 2 bytes attribute
+    const std::size_t recordSize = 50;
+    const std::size_t pointOffset = 3 * sizeof(float);
+    MeshSoupBuilder builder(this->_rclMesh);
+    if (auto mem = dynamic_cast<MemoryStreamBuf*>(buf)) {
+        builder.Build(mem->current() + pointOffset, ulCt, recordSize);
+        mem->consume(ulCt * recordSize);
+        return true;
+    }
 
-        std::swap(clVects[0], clVects[3]);
-        builder.AddFacet(clVects);
+    // other streams are read in chunks of records of which only the points are kept
+    const std::size_t pointSize = 9 * sizeof(float);
+    const std::size_t chunkSize = 4096;
+    std::vector<char> points(ulCt * pointSize);
+    std::vector<char> records(chunkSize * recordSize);
+    for (std::size_t done = 0; done < ulCt;) {
+        std::size_t num = std::min<std::size_t>(chunkSize, ulCt - done);
+        auto bytes = static_cast<std::streamsize>(num * recordSize);
+        rstrIn.read(records.data(), bytes);
+        if (rstrIn.gcount() != bytes) {
+            return false;  // truncated file
+        }
 
-        // overread 2 bytes attribute
-        rstrIn.read((char*)&usAtt, sizeof(usAtt));
+        for (std::size_t i = 0; i < num; i++) {
+            std::memcpy(points.data() + (done + i) * pointSize,
+                        records.data() + i * recordSize + pointOffset,
+                        pointSize);
+        }
+        done += num;
     }
-
-    builder.Finish();
+    builder.Build(points.data(), ulCt, pointSize);
 
     return true;
 }
@@ -2053,16 +2252,10 @@ bool MeshOutput::SaveFormat(std::ostream& str, MeshIO::Format fmt) const
 /** Saves the mesh object into an ASCII file. */
 bool MeshOutput::SaveAsciiSTL(std::ostream& rstrOut) const
 {
-    MeshFacetIterator clIter(_rclMesh), clEnd(_rclMesh);
-    clIter.Transform(this->_transform);
-    const MeshGeomFacet* pclFacet {};
-
     if (!rstrOut || rstrOut.bad() || _rclMesh.CountFacets() == 0) {
         return false;
     }
 
-    rstrOut.precision(6);
-    rstrOut.setf(std::ios::fixed | std::ios::showpoint);
     Base::SequencerLauncher seq("saving...", _rclMesh.CountFacets() + 1);
 
     if (this->objectName.empty()) {
@@ -2072,27 +2265,27 @@ bool MeshOutput::SaveAsciiSTL(std::ostream& rstrOut) const
         rstrOut << "solid " << this->objectName << '\n';
     }
 
-    clIter.Begin();
-    clEnd.End();
-    while (clIter < clEnd) {
-        pclFacet = &(*clIter);
-
-        // normal
-        rstrOut << "  facet normal " << pclFacet->GetNormal().x << " " << pclFacet->GetNormal().y
-                << " " << pclFacet->GetNormal().z << '\n';
-        rstrOut << "    outer loop\n";
+    auto writeFacets = [this](TextBuffer& str, std::size_t begin, std::size_t end) {
+        MeshFacetIterator clIter(_rclMesh);
+        clIter.Transform(this->_transform);
+        for (clIter.Set(begin); clIter.Position() < end; ++clIter) {
+            const MeshGeomFacet& facet = *clIter;
 
-        // vertices
-        for (const auto& pnt : pclFacet->_aclPoints) {
-            rstrOut << "      vertex " << pnt.x << " " << pnt.y << " " << pnt.z << '\n';
-        }
+            // normal
+            Base::Vector3f normal = facet.GetNormal();
+            str << "  facet normal " << normal.x << " " << normal.y << " " << normal.z << '\n';
+            str << "    outer loop\n";
 
-        rstrOut << "    endloop\n";
-        rstrOut << "  endfacet\n";
+            // vertices
+            for (const auto& pnt : facet._aclPoints) {
+                str << "      vertex " << pnt.x << " " << pnt.y << " " << pnt.z << '\n';
+            }
 
-        ++clIter;
-        seq.next(true);  // allow to cancel
-    }
+            str << "    endloop\n";
+            str << "  endfacet\n";
+        }
+    };
+    writeTextChunks(rstrOut, _rclMesh.CountFacets(), true, writeFacets, &seq);
 
     rstrOut << "endsolid Mesh\n";
 
@@ -2509,48 +2702,38 @@ bool MeshOutput::SaveAsciiPLY(std::ostream& out) const
         << "property list uchar int vertex_index\n"
         << "end_header\n";
 
-    out.precision(6);
-    out.setf(std::ios::fixed | std::ios::showpoint);
-    if (saveVertexColor) {
-        for (std::size_t i = 0; i < v_count; i++) {
+    auto writePoints = [&](TextBuffer& str, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
             const MeshPoint& p = rPoints[i];
             if (this->apply_transform) {
                 Base::Vector3f pt = this->_transform * p;
-                out << pt.x << " " << pt.y << " " << pt.z;
+                str << pt.x << " " << pt.y << " " << pt.z;
             }
             else {
-                out << p.x << " " << p.y << " " << p.z;
+                str << p.x << " " << p.y << " " << p.z;
             }
 
-            const App::Color& c = _material->diffuseColor[i];
-            int r = (int)(255.0f * c.r);
-            int g = (int)(255.0f * c.g);
-            int b = (int)(255.0f * c.b);
-            out << " " << r << " " << g << " " << b << '\n';
-        }
-    }
-    else {
-        for (std::size_t i = 0; i < v_count; i++) {
-            const MeshPoint& p = rPoints[i];
-            if (this->apply_transform) {
-                Base::Vector3f pt = this->_transform * p;
-                out << pt.x << " " << pt.y << " " << pt.z << '\n';
-            }
-            else {
-                out << p.x << " " << p.y << " " << p.z << '\n';
+            if (saveVertexColor) {
+                const App::Color& c = _material->diffuseColor[i];
+                int r = (int)(255.0f * c.r);
+                int g = (int)(255.0f * c.g);
+                int b = (int)(255.0f * c.b);
+                str << " " << r << " " << g << " " << b;
             }
+            str << '\n';
         }
-    }
+    };
+    writeTextChunks(out, v_count, true, writePoints);
 
-    unsigned int n = 3;
-    int f1 {}, f2 {}, f3 {};
-    for (std::size_t i = 0; i < f_count; i++) {
-        const MeshFacet& f = rFacets[i];
-        f1 = (int)f._aulPoints[0];
-        f2 = (int)f._aulPoints[1];
-        f3 = (int)f._aulPoints[2];
-        out << n << " " << f1 << " " << f2 << " " << f3 << '\n';
-    }
+    auto writeFacets = [&rFacets](TextBuffer& str, std::size_t begin, std::size_t end) {
+        unsigned int n = 3;
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& f = rFacets[i];
+            str << n << " " << (int)f._aulPoints[0] << " " << (int)f._aulPoints[1] << " "
+                << (int)f._aulPoints[2] << '\n';
+        }
+    };
+    writeTextChunks(out, f_count, true, writeFacets);
 
     return true;
 }
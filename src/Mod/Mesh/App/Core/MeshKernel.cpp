@@ -36,6 +36,7 @@
 #include "Algorithm.h"
 #include "Builder.h"
 #include "Evaluation.h"
+#include "GeometryView.h"
 #include "Iterator.h"
 #include "MeshIO.h"
 #include "MeshKernel.h"
@@ -919,6 +920,57 @@ void MeshKernel::Write(std::ostream& rclOut) const
     str << _clBoundBox.MinZ << _clBoundBox.MaxZ;
 }
 
+void MeshKernel::WriteCompact(std::ostream& rclOut) const
+{
+    if (!rclOut || rclOut.bad()) {
+        return;
+    }
+
+    Base::OutputStream str(rclOut);
+
+    // Same header as Write() but without the info block
+    str << static_cast<uint32_t>(0xA0B0C0D0);
+    str << static_cast<uint32_t>(0x020000);
+    str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
+
+    // MeshPoint and MeshFacet have further members, so copy the data chunk-wise
+    const std::size_t chunk = 8192;
+    std::vector<float> coords;
+    coords.reserve(3 * chunk);
+    for (std::size_t i = 0; i < _aclPointArray.size(); i += chunk) {
+        std::size_t end = std::min(i + chunk, _aclPointArray.size());
+        coords.clear();
+        for (std::size_t j = i; j < end; j++) {
+            const MeshPoint& pt = _aclPointArray[j];
+            coords.push_back(pt.x);
+            coords.push_back(pt.y);
+            coords.push_back(pt.z);
+        }
+        str.write(coords.data(), coords.size());
+    }
+
+    std::vector<uint32_t> indices;
+    indices.reserve(6 * chunk);
+    for (std::size_t i = 0; i < _aclFacetArray.size(); i += chunk) {
+        std::size_t end = std::min(i + chunk, _aclFacetArray.size());
+        indices.clear();
+        for (std::size_t j = i; j < end; j++) {
+            const MeshFacet& face = _aclFacetArray[j];
+            for (PointIndex p : face._aulPoints) {
+                indices.push_back(static_cast<uint32_t>(p));
+            }
+            for (FacetIndex n : face._aulNeighbours) {
+                indices.push_back(static_cast<uint32_t>(n));
+            }
+        }
+        str.write(indices.data(), indices.size());
+    }
+
+    str << _clBoundBox.MinX << _clBoundBox.MaxX;
+    str << _clBoundBox.MinY << _clBoundBox.MaxY;
+    str << _clBoundBox.MinZ << _clBoundBox.MaxZ;
+}
+
 void MeshKernel::Read(std::istream& rclIn)
 {
     if (!rclIn || rclIn.bad()) {
@@ -939,15 +991,21 @@ void MeshKernel::Read(std::istream& rclIn)
 
     // is it the new or old format?
     bool new_format = false;
-    if (magic == 0xA0B0C0D0 && version == 0x010000) {
+    bool compact_format = false;
+    if (magic == 0xA0B0C0D0 && (version == 0x010000 || version == 0x020000)) {
         new_format = true;
+        compact_format = (version == 0x020000);
     }
-    else if (swap_magic == 0xA0B0C0D0 && swap_version == 0x010000) {
+    else if (swap_magic == 0xA0B0C0D0 && (swap_version == 0x010000 || swap_version == 0x020000)) {
         new_format = true;
+        compact_format = (swap_version == 0x020000);
         str.setByteOrder(Base::Stream::BigEndian);
     }
 
-    if (new_format) {
+    if (compact_format) {
+        ReadCompact(str);
+    }
+    else if (new_format) {
         char szInfo[256];
         rclIn.read(szInfo, 256);
 
@@ -1102,6 +1160,66 @@ void MeshKernel::Read(std::istream& rclIn)
     }
 }
 
+void MeshKernel::ReadCompact(Base::InputStream& str)
+{
+    uint32_t uCtPts = 0, uCtFts = 0;
+    str >> uCtPts >> uCtFts;
+    const uint32_t open_edge = 0xffffffff;  // value to mark an open edge
+
+    try {
+        const std::size_t chunk = 8192;
+        MeshPointArray pointArray;
+        pointArray.resize(uCtPts);
+        std::vector<float> coords(3 * chunk);
+        for (std::size_t i = 0; i < pointArray.size(); i += chunk) {
+            std::size_t count = std::min<std::size_t>(chunk, pointArray.size() - i);
+            str.read(coords.data(), 3 * count);
+            if (!str) {
+                throw Base::BadFormatError("Reading from stream failed");
+            }
+            for (std::size_t j = 0; j < count; j++) {
+                pointArray[i + j].Set(coords[3 * j], coords[3 * j + 1], coords[3 * j + 2]);
+            }
+        }
+
+        MeshFacetArray facetArray;
+        facetArray.resize(uCtFts);
+        std::vector<uint32_t> indices(6 * chunk);
+        for (std::size_t i = 0; i < facetArray.size(); i += chunk) {
+            std::size_t count = std::min<std::size_t>(chunk, facetArray.size() - i);
+            str.read(indices.data(), 6 * count);
+            if (!str) {
+                throw Base::BadFormatError("Reading from stream failed");
+            }
+            for (std::size_t j = 0; j < count; j++) {
+                MeshFacet& face = facetArray[i + j];
+                const uint32_t* v = &indices[6 * j];
+                for (int k = 0; k < 3; k++) {
+                    // make sure to have valid indices
+                    if (v[k] >= uCtPts) {
+                        throw Base::BadFormatError("Invalid data structure");
+                    }
+                    if (v[k + 3] >= uCtFts && v[k + 3] < open_edge) {
+                        throw Base::BadFormatError("Invalid data structure");
+                    }
+                    face._aulPoints[k] = v[k];
+                    face._aulNeighbours[k] = v[k + 3] < open_edge ? v[k + 3] : FACET_INDEX_MAX;
+                }
+            }
+        }
+
+        str >> _clBoundBox.MinX >> _clBoundBox.MaxX;
+        str >> _clBoundBox.MinY >> _clBoundBox.MaxY;
+        str >> _clBoundBox.MinZ >> _clBoundBox.MaxZ;
+
+        _aclPointArray.swap(pointArray);
+        _aclFacetArray.swap(facetArray);
+    }
+    catch (std::length_error&) {
+        throw Base::BadFormatError("Reading from stream failed");
+    }
+}
+
 void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 {
     this->Transform(rclMat);
@@ -1109,15 +1227,7 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
-    MeshPointArray::_TIterator clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
-    Base::Matrix4D clMatrix(rclMat);
-
-    _clBoundBox.SetVoid();
-    while (clPIter < clPEIter) {
-        *clPIter *= clMatrix;
-        _clBoundBox.Add(*clPIter);
-        clPIter++;
-    }
+    _clBoundBox = MeshGeometryView::TransformPoints(_aclPointArray, rclMat);
 }
 
 void MeshKernel::Smooth(int iterations, float stepsize)
@@ -1128,10 +1238,7 @@ void MeshKernel::Smooth(int iterations, float stepsize)
 
 void MeshKernel::RecalcBoundBox() const
 {
-    _clBoundBox.SetVoid();
-    for (const auto& pI : _aclPointArray) {
-        _clBoundBox.Add(pI);
-    }
+    _clBoundBox = MeshGeometryView::GetBoundBox(_aclPointArray);
 }
 
 std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
@@ -1140,11 +1247,15 @@ std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
 
     normals.resize(CountPoints());
 
+    // the facet normals are computed in parallel, only the sums are sequential
+    std::vector<Base::Vector3f> facetNormals;
+    MeshGeometryView(*this).GetFacetNormals(facetNormals, false);
+
     PointIndex p1 {}, p2 {}, p3 {};
     unsigned int ct = CountFacets();
     for (unsigned int pFIter = 0; pFIter < ct; pFIter++) {
         GetFacetPoints(pFIter, p1, p2, p3);
-        Base::Vector3f Norm = (GetPoint(p2) - GetPoint(p1)) % (GetPoint(p3) - GetPoint(p1));
+        const Base::Vector3f& Norm = facetNormals[pFIter];
 
         normals[p1] += Norm;
         normals[p2] += Norm;
@@ -1177,10 +1288,12 @@ std::vector<Base::Vector3f> MeshKernel::GetFacetNormals(const std::vector<FacetI
 // Evaluation
 float MeshKernel::GetSurface() const
 {
+    std::vector<float> areas;
+    MeshGeometryView(*this).GetFacetAreas(areas);
+
     float fSurface = 0.0;
-    MeshFacetIterator cIter(*this);
-    for (cIter.Init(); cIter.More(); cIter.Next()) {
-        fSurface += cIter->Area();
+    for (float area : areas) {
+        fSurface += area;
     }
 
     return fSurface;
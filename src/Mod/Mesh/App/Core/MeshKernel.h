@@ -34,6 +34,7 @@
 
 namespace Base
 {
+class InputStream;
 class Polygon2d;
 class ViewProjMethod;
 }  // namespace Base
@@ -79,6 +80,9 @@ public:
     //@{
     /// Binary streaming of data
     void Write(std::ostream& rclOut) const;
+    /// Binary streaming of data with points and facets written as contiguous blocks
+    void WriteCompact(std::ostream& rclOut) const;
+    /// Reads the data written by Write() or WriteCompact()
     void Read(std::istream& rclIn);
     //@}
 
@@ -482,6 +486,9 @@ protected:
     inline Base::Vector3f GetGravityPoint(const MeshFacet& rclFacet) const;
 
 private:
+    /** Reads the data blocks written by WriteCompact() after the header. */
+    void ReadCompact(Base::InputStream& str);
+
     MeshPointArray _aclPointArray;        /**< Holds the array of geometric points. */
     MeshFacetArray _aclFacetArray;        /**< Holds the array of facets. */
     mutable Base::BoundBox3f _clBoundBox; /**< The current calculated bounding box. */
@@ -23,17 +23,23 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <ios>
+#include <limits>
+#include <mutex>
 #endif
 
 #include <Base/Builder3D.h>
 #include <Base/Sequencer.h>
 
 #include "Algorithm.h"
+#include "BVH.h"
 #include "Builder.h"
 #include "Definitions.h"
 #include "Elements.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "SetOperations.h"
@@ -44,6 +50,56 @@
 using namespace Base;
 using namespace MeshCore;
 
+namespace
+{
+// the cut line of two facets
+struct CutSegment
+{
+    FacetIndex facet0;
+    FacetIndex facet1;
+    MeshPoint p0;
+    MeshPoint p1;
+};
+
+/**
+ * Returns true if all corners of \a facet2 lie strictly on one side of the plane of \a facet1.
+ * The sign of an orientation determinant is only trusted if it exceeds the bound of the rounding
+ * errors, so touching and coplanar facets are always left to the intersection test.
+ */
+bool IsOnOneSide(const MeshGeomFacet& facet1, const MeshGeomFacet& facet2)
+{
+    // error bound of the orientation determinant in double precision of float coordinates
+    const double errorBound = 8.0 * std::numeric_limits<double>::epsilon();
+
+    Vector3d base = toVector<double>(facet1._aclPoints[0]);
+    Vector3d dir1 = toVector<double>(facet1._aclPoints[1]) - base;
+    Vector3d dir2 = toVector<double>(facet1._aclPoints[2]) - base;
+    Vector3d normal = dir1 % dir2;
+    Vector3d normalAbs(std::fabs(dir1.y * dir2.z) + std::fabs(dir1.z * dir2.y),
+                       std::fabs(dir1.z * dir2.x) + std::fabs(dir1.x * dir2.z),
+                       std::fabs(dir1.x * dir2.y) + std::fabs(dir1.y * dir2.x));
+
+    int side = 0;
+    for (const auto& pnt : facet2._aclPoints) {
+        Vector3d dir = toVector<double>(pnt) - base;
+        double det = normal * dir;
+        double permanent = normalAbs.x * std::fabs(dir.x) + normalAbs.y * std::fabs(dir.y)
+            + normalAbs.z * std::fabs(dir.z);
+        if (std::fabs(det) <= errorBound * permanent) {
+            return false;
+        }
+
+        int sign = det > 0.0 ? 1 : -1;
+        if (side != 0 && sign != side) {
+            return false;
+        }
+        side = sign;
+    }
+
+    return true;
+}
+}  // namespace
+
 
 SetOperations::SetOperations(const MeshKernel& cutMesh1,
                              const MeshKernel& cutMesh2,
@@ -174,120 +230,99 @@ void SetOperations::Do()
 void SetOperations::Cut(std::set<FacetIndex>& facetsCuttingEdge0,
                         std::set<FacetIndex>& facetsCuttingEdge1)
 {
-    MeshFacetGrid grid1(_cutMesh0, 20);
-    MeshFacetGrid grid2(_cutMesh1, 20);
-
-    unsigned long ctGx1 {}, ctGy1 {}, ctGz1 {};
-    grid1.GetCtGrids(ctGx1, ctGy1, ctGz1);
-
-    for (auto gx1 = 0UL; gx1 < ctGx1; gx1++) {
-        for (auto gy1 = 0UL; gy1 < ctGy1; gy1++) {
-            for (auto gz1 = 0UL; gz1 < ctGz1; gz1++) {
-                if (grid1.GetCtElements(gx1, gy1, gz1) > 0) {
-                    std::vector<FacetIndex> vecFacets2;
-                    grid2.Inside(grid1.GetBoundBox(gx1, gy1, gz1), vecFacets2);
-
-                    if (!vecFacets2.empty()) {
-                        std::set<FacetIndex> vecFacets1;
-                        grid1.GetElements(gx1, gy1, gz1, vecFacets1);
-
-                        std::set<FacetIndex>::iterator it1;
-                        for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1) {
-                            FacetIndex fidx1 = *it1;
-                            MeshGeomFacet f1 = _cutMesh0.GetFacet(*it1);
-
-                            std::vector<FacetIndex>::iterator it2;
-                            for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2) {
-                                FacetIndex fidx2 = *it2;
-                                MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
-
-                                MeshPoint p0, p1;
-
-                                int isect = f1.IntersectWithFacet(f2, p0, p1);
-                                if (isect > 0) {
-                                    // optimize cut line if distance to nearest point is too small
-                                    float minDist1 = _minDistanceToPoint,
-                                          minDist2 = _minDistanceToPoint;
-                                    MeshPoint np0 = p0, np1 = p1;
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f1._aclPoints[i] - p0).Length();
-                                        float d2 = (f1._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f1._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            p1 = f1._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    // optimize cut line if distance to nearest point is too small
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f2._aclPoints[i] - p0).Length();
-                                        float d2 = (f2._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f2._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            np1 = f2._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    MeshPoint mp0 = np0;
-                                    MeshPoint mp1 = np1;
-
-                                    if (mp0 != mp1) {
-                                        facetsCuttingEdge0.insert(fidx1);
-                                        facetsCuttingEdge1.insert(fidx2);
-
-                                        _cutPoints.insert(mp0);
-                                        _cutPoints.insert(mp1);
-
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit0 =
-                                            _cutPoints.insert(mp0);
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit1 =
-                                            _cutPoints.insert(mp1);
-
-                                        _edges[Edge(mp0, mp1)] = EdgeInfo();
-
-                                        _facet2points[0][fidx1].push_back(pit0.first);
-                                        _facet2points[0][fidx1].push_back(pit1.first);
-                                        _facet2points[1][fidx2].push_back(pit0.first);
-                                        _facet2points[1][fidx2].push_back(pit1.first);
-                                    }
-                                    else {
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit =
-                                            _cutPoints.insert(mp0);
-
-                                        // do not insert a facet when only one corner point cuts the
-                                        // edge if (!((mp0 == f1._aclPoints[0]) || (mp0 ==
-                                        // f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge0.insert(fidx1);
-                                            _facet2points[0][fidx1].push_back(pit.first);
-                                        }
-
-                                        // if (!((mp0 == f2._aclPoints[0]) || (mp0 ==
-                                        // f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge1.insert(fidx2);
-                                            _facet2points[1][fidx2].push_back(pit.first);
-                                        }
-                                    }
-
-                                }  // if (f1.IntersectWithFacet(f2, p0, p1))
-                            }  // for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2)
-                        }  // for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1)
-                    }  // if (vecFacets2.size() > 0)
-                }  // if (grid1.GetCtElements(gx1, gy1, gz1) > 0)
-            }  // for (gz1 = 0; gz1 < ctGz1; gz1++)
-        }  // for (gy1 = 0; gy1 < ctGy1; gy1++)
-    }  // for (gx1 = 0; gx1 < ctGx1; gx1++)
+    // The facets of the second mesh are searched in a bounding volume hierarchy. Unlike a grid it
+    // adapts to facets of very different size and each pair of facets is tested only once.
+    MeshFacetBVH bvh(_cutMesh1);
+    std::vector<CutSegment> segments;
+    std::mutex mutex;
+
+    parallel_for(
+        _cutMesh0.CountFacets(),
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<CutSegment> local;
+            for (FacetIndex fidx1 = begin; fidx1 < end; fidx1++) {
+                MeshGeomFacet f1 = _cutMesh0.GetFacet(fidx1);
+                bvh.Search(f1.GetBoundBox(), [&](FacetIndex fidx2) {
+                    MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
+                    if (IsOnOneSide(f1, f2) || IsOnOneSide(f2, f1)) {
+                        return;
+                    }
+
+                    MeshPoint p0, p1;
+                    int isect = f1.IntersectWithFacet(f2, p0, p1);
+                    if (isect > 0) {
+                        // optimize cut line if distance to nearest point is too small
+                        float minDist1 = _minDistanceToPoint, minDist2 = _minDistanceToPoint;
+                        MeshPoint np0 = p0, np1 = p1;
+                        for (const MeshGeomFacet* facet : {&f1, &f2}) {
+                            for (const auto& pnt : facet->_aclPoints) {
+                                float d1 = (pnt - p0).Length();
+                                float d2 = (pnt - p1).Length();
+                                if (d1 < minDist1) {
+                                    minDist1 = d1;
+                                    np0 = pnt;
+                                }
+                                if (d2 < minDist2) {
+                                    minDist2 = d2;
+                                    np1 = pnt;
+                                }
+                            }
+                        }
+
+                        local.push_back({fidx1, fidx2, np0, np1});
+                    }
+                });
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            segments.insert(segments.end(), local.begin(), local.end());
+        },
+        1000);
+
+    // keep the order of the cut points independent of the scheduling of the threads
+    std::sort(segments.begin(), segments.end(), [](const CutSegment& s1, const CutSegment& s2) {
+        return std::make_pair(s1.facet0, s1.facet1) < std::make_pair(s2.facet0, s2.facet1);
+    });
+
+    for (const auto& it : segments) {
+        FacetIndex fidx1 = it.facet0;
+        FacetIndex fidx2 = it.facet1;
+        const MeshPoint& mp0 = it.p0;
+        const MeshPoint& mp1 = it.p1;
+
+        if (mp0 != mp1) {
+            facetsCuttingEdge0.insert(fidx1);
+            facetsCuttingEdge1.insert(fidx2);
+
+            std::pair<std::set<MeshPoint>::iterator, bool> pit0 = _cutPoints.insert(mp0);
+            std::pair<std::set<MeshPoint>::iterator, bool> pit1 = _cutPoints.insert(mp1);
+
+            _edges[Edge(mp0, mp1)] = EdgeInfo();
+
+            _facet2points[0][fidx1].push_back(pit0.first);
+            _facet2points[0][fidx1].push_back(pit1.first);
+            _facet2points[1][fidx2].push_back(pit0.first);
+            _facet2points[1][fidx2].push_back(pit1.first);
+        }
+        else {
+            std::pair<std::set<MeshPoint>::iterator, bool> pit = _cutPoints.insert(mp0);
+
+            // do not insert a facet when only one corner point cuts the edge
+            // if (!((mp0 == f1._aclPoints[0]) || (mp0 == f1._aclPoints[1]) || (mp0 ==
+            // f1._aclPoints[2])))
+            {
+                facetsCuttingEdge0.insert(fidx1);
+                _facet2points[0][fidx1].push_back(pit.first);
+            }
+
+            // if (!((mp0 == f2._aclPoints[0]) || (mp0 == f2._aclPoints[1]) || (mp0 ==
+            // f2._aclPoints[2])))
+            {
+                facetsCuttingEdge1.insert(fidx2);
+                _facet2points[1][fidx2].push_back(pit.first);
+            }
+        }
+    }
 }
 
 void SetOperations::TriangulateMesh(const MeshKernel& cutMesh, int side)
@@ -379,7 +379,12 @@ void MeshObject::Save(Base::Writer& /*writer*/) const
 
 void MeshObject::SaveDocFile(Base::Writer& writer) const
 {
-    _kernel.Write(writer.Stream());
+    if (writer.getMode("BinaryMesh")) {
+        _kernel.WriteCompact(writer.Stream());
+    }
+    else {
+        _kernel.Write(writer.Stream());
+    }
 }
 
 void MeshObject::Restore(Base::XMLReader& /*reader*/)
@@ -744,61 +744,94 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
-    _meshObject = mesh;
+    discardDeferred();
+    setMeshObject(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
-    *_meshObject = mesh;
+    discardDeferred();
+    if (_meshObject.getRefCount() > 1) {
+        setMeshObject(new MeshObject(mesh));
+    }
+    else {
+        *_meshObject = mesh;
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    discardDeferred();
+    detachMesh();
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
+    restoreDeferred();
     aboutToSetValue();
+    detachMesh();
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
+    restoreDeferred();
     aboutToSetValue();
+    detachMesh();
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
+void PropertyMeshKernel::detachMesh()
+{
+    if (_meshObject.getRefCount() > 1) {
+        setMeshObject(new MeshObject(*_meshObject));
+    }
+}
+
+void PropertyMeshKernel::setMeshObject(MeshObject* mesh)
+{
+    _meshObject = mesh;
+    if (meshPyObject) {
+        // let the Python wrapper refer to the current mesh
+        meshPyObject->setTwinPointer(mesh);
+    }
+}
+
 const MeshObject& PropertyMeshKernel::getValue() const
 {
+    restoreDeferred();
     return *_meshObject;
 }
 
 const MeshObject* PropertyMeshKernel::getValuePtr() const
 {
+    restoreDeferred();
     return static_cast<MeshObject*>(_meshObject);
 }
 
 const Data::ComplexGeoData* PropertyMeshKernel::getComplexData() const
 {
+    restoreDeferred();
     return static_cast<MeshObject*>(_meshObject);
 }
 
 Base::BoundBox3d PropertyMeshKernel::getBoundingBox() const
 {
+    restoreDeferred();
     return _meshObject->getBoundBox();
 }
 
 unsigned int PropertyMeshKernel::getMemSize() const
 {
-    unsigned int size = 0;
+    unsigned int size = getDeferredSize();
     size += _meshObject->getMemSize();
 
     return size;
@@ -806,7 +839,9 @@ unsigned int PropertyMeshKernel::getMemSize() const
 
 MeshObject* PropertyMeshKernel::startEditing()
 {
+    restoreDeferred();
     aboutToSetValue();
+    detachMesh();
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -817,7 +852,9 @@ void PropertyMeshKernel::finishEditing()
 
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    restoreDeferred();
     aboutToSetValue();
+    detachMesh();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -825,7 +862,9 @@ void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
+    restoreDeferred();
     aboutToSetValue();
+    detachMesh();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -835,16 +874,22 @@ void PropertyMeshKernel::setPointIndices(
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
-    _meshObject->setTransform(rclTrf);
+    restoreDeferred();
+    if (_meshObject->getTransform() != rclTrf) {
+        detachMesh();
+        _meshObject->setTransform(rclTrf);
+    }
 }
 
 Base::Matrix4D PropertyMeshKernel::getTransform() const
 {
+    restoreDeferred();
     return _meshObject->getTransform();
 }
 
 PyObject* PropertyMeshKernel::getPyObject()
 {
+    restoreDeferred();
     if (!meshPyObject) {
         meshPyObject = new MeshPy(
             &*_meshObject);  // Lgtm[cpp/resource-not-released-in-destructor] ** Not destroyed in
@@ -882,6 +927,7 @@ void PropertyMeshKernel::setPyObject(PyObject* value)
 
 void PropertyMeshKernel::Save(Base::Writer& writer) const
 {
+    restoreDeferred();
     if (writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Mesh>" << std::endl;
         MeshCore::MeshOutput saver(_meshObject->getKernel());
@@ -910,6 +956,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detachMesh();
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -921,29 +968,46 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
 
 void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 {
-    _meshObject->save(writer.Stream());
+    restoreDeferred();
+    _meshObject->SaveDocFile(writer);
 }
 
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->load(reader);
     hasSetValue();
 }
 
+bool PropertyMeshKernel::deferDocFile(const std::shared_ptr<Base::DeferredFile>& file)
+{
+    return setDeferredFile(file);
+}
+
+void PropertyMeshKernel::restoreDeferredFile(Base::Reader& reader)
+{
+    _meshObject->load(reader);
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    restoreDeferred();
+    // Note: Reference the same mesh object, all modifying methods call detachMesh()
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    prop->_meshObject = this->_meshObject;
     return prop;
 }
 
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
-    // Note: Copy the content, do NOT reference the same mesh object
-    aboutToSetValue();
+    // Note: Reference the same mesh object, all modifying methods call detachMesh()
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
-    *(this->_meshObject) = *(prop._meshObject);
+    prop.restoreDeferred();
+    aboutToSetValue();
+    discardDeferred();
+    if (&*_meshObject != &*prop._meshObject) {
+        setMeshObject(prop._meshObject);
+    }
     hasSetValue();
 }
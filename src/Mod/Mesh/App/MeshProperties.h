@@ -315,11 +315,23 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool deferDocFile(const std::shared_ptr<Base::DeferredFile>& file) override;
 
+    /** The copy shares the mesh object with this property until one of them
+     * gets modified (copy-on-write). This keeps the Undo/Redo stacks small.
+     */
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     //@}
 
+protected:
+    void restoreDeferredFile(Base::Reader& reader) override;
+
+private:
+    /// Makes a private copy of the mesh object if it is shared with a copy
+    void detachMesh();
+    void setMeshObject(MeshObject* mesh);
+
 private:
     Base::Reference<MeshObject> _meshObject;
     MeshPy* meshPyObject {nullptr};
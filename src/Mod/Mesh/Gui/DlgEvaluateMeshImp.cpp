@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <optional>
 #include <QDockWidget>
 #include <QMessageBox>
 #include <QPointer>
@@ -82,11 +83,55 @@ public:
         ui.repairFoldsButton->setVisible(on);
     }
 
+    std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>
+    nonManifoldEdges(const MeshKernel& rMesh) const
+    {
+        if (report) {
+            return report->nonManifoldEdges;
+        }
+        MeshEvalTopology eval(rMesh);
+        eval.Evaluate();
+        return eval.GetIndices();
+    }
+
+    std::vector<Mesh::PointIndex> nonManifoldPoints(const MeshKernel& rMesh) const
+    {
+        if (report) {
+            return report->nonManifoldPoints;
+        }
+        MeshEvalPointManifolds eval(rMesh);
+        eval.Evaluate();
+        return eval.GetIndices();
+    }
+
+    std::vector<Mesh::FacetIndex> invalidNeighbours(const MeshKernel& rMesh) const
+    {
+        if (report) {
+            return report->invalidNeighbours;
+        }
+        MeshEvalNeighbourhood eval(rMesh);
+        return eval.GetIndices();
+    }
+
+    std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>
+    selfIntersections(const MeshKernel& rMesh) const
+    {
+        if (report) {
+            return report->selfIntersections;
+        }
+        MeshEvalSelfIntersection eval(rMesh);
+        std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>> intersection;
+        eval.GetIntersections(intersection);
+        return intersection;
+    }
+
     Ui_DlgEvaluateMesh ui {};
     std::map<std::string, ViewProviderMeshDefects*> vp;
     Mesh::Feature* meshFeature {nullptr};
     QPointer<Gui::View3DInventor> view;
     std::vector<Mesh::FacetIndex> self_intersections;
+    // the results of the combined checks while analyzing all together
+    std::optional<MeshDefectReport> report;
     bool enableFoldsCheck {false};
     bool checkNonManfoldPoints {false};
     bool strictlyDegenerated {true};
@@ -599,18 +644,15 @@ void DlgEvaluateMeshImp::onAnalyzeNonmanifoldsButtonClicked()
         qApp->setOverrideCursor(Qt::WaitCursor);
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
-        MeshEvalTopology f_eval(rMesh);
-        bool ok1 = f_eval.Evaluate();
-        bool ok2 = true;
+        std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>> inds =
+            d->nonManifoldEdges(rMesh);
+        bool ok1 = inds.empty();
         std::vector<Mesh::PointIndex> point_indices;
 
         if (d->checkNonManfoldPoints) {
-            MeshEvalPointManifolds p_eval(rMesh);
-            ok2 = p_eval.Evaluate();
-            if (!ok2) {
-                point_indices = p_eval.GetIndices();
-            }
+            point_indices = d->nonManifoldPoints(rMesh);
         }
+        bool ok2 = point_indices.empty();
 
         if (ok1 && ok2) {
             d->ui.checkNonmanifoldsButton->setText(tr("No non-manifolds"));
@@ -621,14 +663,12 @@ void DlgEvaluateMeshImp::onAnalyzeNonmanifoldsButtonClicked()
         }
         else {
             d->ui.checkNonmanifoldsButton->setText(
-                tr("%1 non-manifolds").arg(f_eval.CountManifolds() + point_indices.size()));
+                tr("%1 non-manifolds").arg(inds.size() + point_indices.size()));
             d->ui.checkNonmanifoldsButton->setChecked(true);
             d->ui.repairNonmanifoldsButton->setEnabled(true);
             d->ui.repairAllTogether->setEnabled(true);
 
             if (!ok1) {
-                const std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>& inds =
-                    f_eval.GetIndices();
                 std::vector<Mesh::FacetIndex> indices;
                 indices.reserve(2 * inds.size());
                 std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>::const_iterator it;
@@ -712,7 +752,7 @@ void DlgEvaluateMeshImp::onAnalyzeIndicesButtonClicked()
         MeshEvalRangeFacet rf(rMesh);
         MeshEvalRangePoint rp(rMesh);
         MeshEvalCorruptedFacets cf(rMesh);
-        MeshEvalNeighbourhood nb(rMesh);
+        std::vector<Mesh::FacetIndex> neighbours;
 
         if (!rf.Evaluate()) {
             d->ui.checkIndicesButton->setText(tr("Invalid face indices"));
@@ -735,12 +775,12 @@ void DlgEvaluateMeshImp::onAnalyzeIndicesButtonClicked()
             d->ui.repairAllTogether->setEnabled(true);
             addViewProvider("MeshGui::ViewProviderMeshIndices", cf.GetIndices());
         }
-        else if (!nb.Evaluate()) {
+        else if (neighbours = d->invalidNeighbours(rMesh), !neighbours.empty()) {
             d->ui.checkIndicesButton->setText(tr("Invalid neighbour indices"));
             d->ui.checkIndicesButton->setChecked(true);
             d->ui.repairIndicesButton->setEnabled(true);
             d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshIndices", nb.GetIndices());
+            addViewProvider("MeshGui::ViewProviderMeshIndices", neighbours);
         }
         else {
             d->ui.checkIndicesButton->setText(tr("No invalid indices"));
@@ -1011,10 +1051,9 @@ void DlgEvaluateMeshImp::onAnalyzeSelfIntersectionButtonClicked()
         qApp->setOverrideCursor(Qt::WaitCursor);
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
-        MeshEvalSelfIntersection eval(rMesh);
         std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>> intersection;
         try {
-            eval.GetIntersections(intersection);
+            intersection = d->selfIntersections(rMesh);
         }
         catch (const Base::AbortException&) {
             Base::Console().Message("The self-intersection analysis was aborted by the user\n");
@@ -1156,6 +1195,20 @@ void DlgEvaluateMeshImp::onRepairFoldsButtonClicked()
 
 void DlgEvaluateMeshImp::onAnalyzeAllTogetherClicked()
 {
+    // the topological checks and the self-intersection check share their work and run at once
+    if (d->meshFeature) {
+        Gui::WaitCursor wc;
+        MeshEvalDefects eval(d->meshFeature->Mesh.getValue().getKernel());
+        try {
+            eval.Evaluate();
+        }
+        catch (const Base::AbortException&) {
+            Base::Console().Message("The mesh analysis was aborted by the user\n");
+            return;
+        }
+        d->report = eval.GetReport();
+    }
+
     onAnalyzeOrientationButtonClicked();
     onAnalyzeDuplicatedFacesButtonClicked();
     onAnalyzeDuplicatedPointsButtonClicked();
@@ -1166,6 +1219,7 @@ void DlgEvaluateMeshImp::onAnalyzeAllTogetherClicked()
     if (d->enableFoldsCheck) {
         onAnalyzeFoldsButtonClicked();
     }
+    d->report.reset();
 }
 
 void DlgEvaluateMeshImp::onRepairAllTogetherClicked()
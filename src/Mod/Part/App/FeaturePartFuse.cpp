@@ -73,6 +73,9 @@ MultiFuse::MultiFuse()
     History.setSize(0);
 
     ADD_PROPERTY_TYPE(Refine,(0),"Boolean",(App::PropertyType)(App::Prop_None),"Refine shape (clean up redundant edges) after this boolean operation");
+    ADD_PROPERTY_TYPE(Hierarchical,(false),"Boolean",(App::PropertyType)(App::Prop_None),
+        "Fuse clusters of nearby shapes in parallel and merge the results pairwise.\n"
+        "Faster for many shapes, but the element names differ from a single fusion.");
 
     //init Refine property
     Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter()
@@ -88,6 +91,43 @@ short MultiFuse::mustExecute() const
     return 0;
 }
 
+TopoShape MultiFuse::fuseHierarchical(const std::vector<TopoShape>& shapes,
+                                      std::vector<ShapeHistory>& history)
+{
+    // The intermediate results of the tree and for each of them the indices of the
+    // input shapes that have been fused into it
+    std::vector<TopoShape> nodes(shapes);
+    std::vector<std::vector<std::size_t>> owners(shapes.size());
+    std::vector<bool> hasHistory(shapes.size(), false);
+    for (std::size_t index = 0; index < shapes.size(); ++index) {
+        owners[index].push_back(index);
+    }
+    history.resize(shapes.size());
+
+    auto joinTree = [&](BRepBuilderAPI_MakeShape& mkFuse,
+                        const std::vector<int>& sources,
+                        const TopoShape& result) {
+        std::vector<std::size_t> fused;
+        for (int id : sources) {
+            ShapeHistory hist =
+                buildHistory(mkFuse, TopAbs_FACE, result.getShape(), nodes[id].getShape());
+            for (auto index : owners[id]) {
+                history[index] = hasHistory[index] ? joinHistory(history[index], hist) : hist;
+                hasHistory[index] = true;
+            }
+            fused.insert(fused.end(), owners[id].begin(), owners[id].end());
+            owners[id].clear();
+            nodes[id] = TopoShape();
+        }
+        nodes.push_back(result);
+        owners.push_back(std::move(fused));
+    };
+
+    TopoShape res(0);
+    res.makeElementTreeFuse(shapes, OpCodes::Fuse, 0.0, 16, joinTree);
+    return res;
+}
+
 App::DocumentObjectExecReturn *MultiFuse::execute()
 {
     std::vector<TopoShape> shapes;
@@ -114,34 +154,39 @@ App::DocumentObjectExecReturn *MultiFuse::execute()
     if (shapes.size() >= 2) {
         try {
             std::vector<ShapeHistory> history;
-            BRepAlgoAPI_Fuse mkFuse;
-            TopTools_ListOfShape shapeArguments, shapeTools;
-            const TopoShape& shape = shapes.front();
-            if (shape.isNull()) {
-                throw Base::RuntimeError("Input shape is null");
+            TopoShape res(0);
+            if (this->Hierarchical.getValue()) {
+                res = fuseHierarchical(shapes, history);
             }
-            shapeArguments.Append(shape.getShape());
-
-            for (auto it2 = shapes.begin() + 1; it2 != shapes.end(); ++it2) {
-                if (it2->isNull()) {
+            else {
+                BRepAlgoAPI_Fuse mkFuse;
+                TopTools_ListOfShape shapeArguments, shapeTools;
+                const TopoShape& shape = shapes.front();
+                if (shape.isNull()) {
                     throw Base::RuntimeError("Input shape is null");
                 }
-                shapeTools.Append(it2->getShape());
-            }
+                shapeArguments.Append(shape.getShape());
 
-            mkFuse.SetArguments(shapeArguments);
-            mkFuse.SetTools(shapeTools);
-            mkFuse.Build();
+                for (auto it2 = shapes.begin() + 1; it2 != shapes.end(); ++it2) {
+                    if (it2->isNull()) {
+                        throw Base::RuntimeError("Input shape is null");
+                    }
+                    shapeTools.Append(it2->getShape());
+                }
 
-            if (!mkFuse.IsDone()) {
-                throw Base::RuntimeError("MultiFusion failed");
-            }
+                mkFuse.SetArguments(shapeArguments);
+                mkFuse.SetTools(shapeTools);
+                mkFuse.Build();
 
-            TopoShape res(0);
-            res = res.makeShapeWithElementMap(mkFuse.Shape(), MapperMaker(mkFuse), shapes, OpCodes::Fuse);
-            for (const auto& it2 : shapes) {
-                history.push_back(
-                    buildHistory(mkFuse, TopAbs_FACE, res.getShape(), it2.getShape()));
+                if (!mkFuse.IsDone()) {
+                    throw Base::RuntimeError("MultiFusion failed");
+                }
+
+                res = res.makeShapeWithElementMap(mkFuse.Shape(), MapperMaker(mkFuse), shapes, OpCodes::Fuse);
+                for (const auto& it2 : shapes) {
+                    history.push_back(
+                        buildHistory(mkFuse, TopAbs_FACE, res.getShape(), it2.getShape()));
+                }
             }
             if (res.isNull()) {
                 throw Base::RuntimeError("Resulting shape is null");
@@ -55,6 +55,7 @@ public:
     App::PropertyLinkList Shapes;
     PropertyShapeHistory History;
     App::PropertyBool Refine;
+    App::PropertyBool Hierarchical;
 
     /** @name methods override feature */
     //@{
@@ -67,6 +68,11 @@ public:
         return "PartGui::ViewProviderMultiFuse";
     }
 
+private:
+    /// fuses the shapes by TopoShape::makeElementTreeFuse() and joins the face histories
+    TopoShape fuseHierarchical(const std::vector<TopoShape>& shapes,
+                               std::vector<ShapeHistory>& history);
+
 };
 
 }
@@ -100,6 +100,7 @@
 #include <BOPAlgo_Builder.hxx>
 #include <BOPAlgo_ListOfCheckResult.hxx>
 #include <Bnd_Box.hxx>
+#include <Bnd_OBB.hxx>
 
 // BRep*
 #include <BRep_Builder.hxx>
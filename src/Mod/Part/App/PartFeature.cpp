@@ -74,6 +74,7 @@
 #include "PartFeature.h"
 #include "PartFeaturePy.h"
 #include "PartPyCXX.h"
+#include "TopoShapeOpCache.h"
 #include "TopoShapePy.h"
 #include "Base/Tools.h"
 
@@ -102,6 +103,8 @@ short Feature::mustExecute() const
 
 App::DocumentObjectExecReturn *Feature::recompute()
 {
+    // most results are built without a tag, the operation cache tells them apart by the feature
+    TopoShapeOpCache::OwnerScope owner(getID());
     try {
         return App::GeoFeature::recompute();
     }
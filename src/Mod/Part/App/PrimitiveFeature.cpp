@@ -111,6 +111,14 @@ PyObject* Primitive::getPyObject()
     return Py::new_reference_to(PythonObject);
 }
 
+bool Primitive::canRecomputeConcurrently() const
+{
+    // A primitive builds its shape only from its own properties and does not
+    // assign an element map, so the document string hasher is not involved.
+    // An attachment however reads the shapes of the support objects.
+    return AttachmentSupport.getValues().empty();
+}
+
 void Primitive::Restore(Base::XMLReader &reader)
 {
     Part::Feature::Restore(reader);
@@ -43,6 +43,8 @@ public:
     /// recalculate the feature
     App::DocumentObjectExecReturn *execute() override;
     short mustExecute() const override;
+    /// unattached primitives may be recomputed on a worker thread
+    bool canRecomputeConcurrently() const override;
     PyObject* getPyObject() override;
     //@}
 
@@ -66,6 +66,7 @@ PropertyPartShape::~PropertyPartShape() = default;
 void PropertyPartShape::setValue(const TopoShape& sh)
 {
     aboutToSetValue();
+    discardDeferred();
     _Shape = sh;
     auto obj = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
     if(obj) {
@@ -87,6 +88,7 @@ void PropertyPartShape::setValue(const TopoShape& sh)
 void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 {
     aboutToSetValue();
+    discardDeferred();
     auto obj = dynamic_cast<App::DocumentObject*>(getContainer());
     if(obj)
         _Shape.Tag = obj->getID();
@@ -97,11 +99,13 @@ void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    restoreDeferred();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    restoreDeferred();
     _Shape.initCache(-1);
     // March, 2024 Toponaming project:  There was originally an unused feature to disable
     // elementMapping that has not been kept:
@@ -118,12 +122,21 @@ const TopoShape& PropertyPartShape::getShape() const
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 {
+    restoreDeferred();
     _Shape.initCache(-1);
     return &(this->_Shape);
 }
 
+const void* PropertyPartShape::getSharingKey() const
+{
+    if (isDeferred())
+        return nullptr;
+    return _Shape.getShape().TShape().get();
+}
+
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
+    restoreDeferred();
     Base::BoundBox3d box;
     if (_Shape.getShape().IsNull())
         return box;
@@ -150,16 +163,19 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D &rclTrf)
 {
+    restoreDeferred();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    restoreDeferred();
     return _Shape.getTransform();
 }
 
 void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 {
+    restoreDeferred();
     aboutToSetValue();
     _Shape.transformGeometry(rclTrf);
     hasSetValue();
@@ -167,6 +183,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 
 PyObject *PropertyPartShape::getPyObject()
 {
+    restoreDeferred();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop)
         prop->setConst();
@@ -203,6 +220,7 @@ void PropertyPartShape::setPyObject(PyObject *value)
 
 App::Property *PropertyPartShape::Copy() const
 {
+    restoreDeferred();
     PropertyPartShape *prop = new PropertyPartShape();
 
     // March, 2024 Toponaming project:  There was originally a feature to enable making an element
@@ -221,6 +239,7 @@ void PropertyPartShape::Paste(const App::Property &from)
 {
     auto prop = Base::freecad_dynamic_cast<const PropertyPartShape>(&from);
     if(prop) {
+        prop->restoreDeferred();
         setValue(prop->_Shape);
         _Ver = prop->_Ver;
     }
@@ -228,7 +247,7 @@ void PropertyPartShape::Paste(const App::Property &from)
 
 unsigned int PropertyPartShape::getMemSize () const
 {
-    return _Shape.getMemSize();
+    return getDeferredSize() + _Shape.getMemSize();
 }
 
 void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier> &paths) const
@@ -247,6 +266,7 @@ void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier> &paths) cons
 
 void PropertyPartShape::beforeSave() const
 {
+    restoreDeferred();
     _HasherIndex = 0;
     _SaveHasher = false;
     auto owner = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
@@ -501,7 +521,7 @@ void PropertyPartShape::saveToFile(Base::Writer &writer) const
     fi.deleteFile();
 }
 
-void PropertyPartShape::loadFromFile(Base::Reader &reader)
+TopoDS_Shape PropertyPartShape::loadFromFile(Base::Reader &reader)
 {
     BRep_Builder builder;
     // create a temporary file and copy the content from the zip stream
@@ -541,22 +561,22 @@ void PropertyPartShape::loadFromFile(Base::Reader &reader)
 
     // delete the temp file
     fi.deleteFile();
-    setValue(shape);
+    return shape;
 }
 
-void PropertyPartShape::loadFromStream(Base::Reader &reader)
+TopoDS_Shape PropertyPartShape::loadFromStream(Base::Reader &reader)
 {
+    TopoDS_Shape shape;
     try {
         reader.exceptions(std::istream::failbit | std::istream::badbit);
         BRep_Builder builder;
-        TopoDS_Shape shape;
         BRepTools::Read(shape, reader, builder);
-        setValue(shape);
     }
     catch (const std::exception&) {
         if (!reader.eof())
             Base::Console().Warning("Failed to load BRep file %s\n", reader.getFileName().c_str());
     }
+    return shape;
 }
 
 void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
@@ -585,26 +605,46 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     }
 }
 
-void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
+TopoDS_Shape PropertyPartShape::loadDocFile(Base::Reader &reader)
 {
     Base::FileInfo brep(reader.getFileName());
     if (brep.hasExtension("bin")) {
         TopoShape shape;
         shape.importBinary(reader);
-        setValue(shape);
+        return shape.getShape();
     }
-    else {
-        bool direct = App::GetApplication().GetParameterGroupByPath
-            ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
-        if (!direct) {
-            loadFromFile(reader);
-        }
-        else {
-            auto iostate = reader.exceptions();
-            loadFromStream(reader);
-            reader.exceptions(iostate);
-        }
+
+    bool direct = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+    if (!direct) {
+        return loadFromFile(reader);
     }
+
+    auto iostate = reader.exceptions();
+    TopoDS_Shape shape = loadFromStream(reader);
+    reader.exceptions(iostate);
+    return shape;
+}
+
+void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
+{
+    // keep the hasher set by Restore() for the element map restored next
+    setValue(loadDocFile(reader));
+}
+
+bool PropertyPartShape::deferDocFile(const std::shared_ptr<Base::DeferredFile>& file)
+{
+    return setDeferredFile(file);
+}
+
+void PropertyPartShape::restoreDeferredFile(Base::Reader &reader)
+{
+    // The element map has been restored already, keep it and don't signal
+    // a change as the property only gets the data it was restored with.
+    _Shape.setShape(loadDocFile(reader), false);
+    auto obj = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
+    if (obj && !_Shape.Tag)
+        _Shape.Tag = obj->getID();
 }
 
 // -------------------------------------------------------------------------
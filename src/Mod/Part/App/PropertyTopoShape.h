@@ -90,6 +90,7 @@ public:
 
     void SaveDocFile (Base::Writer &writer) const override;
     void RestoreDocFile(Base::Reader &reader) override;
+    bool deferDocFile(const std::shared_ptr<Base::DeferredFile>& file) override;
 
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
@@ -102,14 +103,21 @@ public:
     std::string getElementMapVersion(bool restored) const override;
     void resetElementMapVersion() {_Ver.clear();}
 
+    /// copies of a shape only share the TShape, so use it as key
+    const void* getSharingKey() const override;
+
     void afterRestore() override;
 
     friend class Feature;
 
+protected:
+    void restoreDeferredFile(Base::Reader &reader) override;
+
 private:
     void saveToFile(Base::Writer &writer) const;
-    void loadFromFile(Base::Reader &reader);
-    void loadFromStream(Base::Reader &reader);
+    TopoDS_Shape loadFromFile(Base::Reader &reader);
+    TopoDS_Shape loadFromStream(Base::Reader &reader);
+    TopoDS_Shape loadDocFile(Base::Reader &reader);
 
 private:
     TopoShape _Shape;
@@ -23,6 +23,7 @@
 #ifndef PART_TOPOSHAPE_H
 #define PART_TOPOSHAPE_H
 
+#include <functional>
 #include <iosfwd>
 #include <list>
 #include <unordered_map>
@@ -1389,6 +1390,45 @@ public:
         return TopoShape(0, Hasher).makeElementFuse({*this, source}, op, tol);
     }
 
+    /** Called by makeElementTreeFuse() for every fusion of the tree
+     *
+     * @param mkShape: the OCCT maker of the fusion
+     * @param sources: the indices of the fused shapes. The input shapes are
+     *                 numbered first, followed by the intermediate results in
+     *                 the order of the calls.
+     * @param result: the fused shape with mapped element names
+     */
+    using TreeFuseCallback = std::function<void(BRepBuilderAPI_MakeShape& mkShape,
+                                                const std::vector<int>& sources,
+                                                const TopoShape& result)>;
+
+    /** Make a fusion of input shapes by a tree reduction
+     *
+     * The shapes are sorted into clusters of nearby shapes by their bounding
+     * boxes. The clusters are fused in parallel and the results are merged
+     * pairwise, again in parallel, until one shape is left. This needs much
+     * less time and memory than a single fusion of many shapes, but the
+     * mapped element names differ from makeElementFuse(). Compounds are
+     * fused as a whole.
+     *
+     * @param sources: the source shapes
+     * @param op: optional string to be encoded into topo naming for indicating
+     *            the operation
+     * @param tol: tolerance for the fusion
+     * @param clusterSize: the maximum number of shapes of a cluster
+     * @param callback: optional callback for each fusion of the tree
+     *
+     * @return The original content of this TopoShape is discarded and replaced
+     *         with the new shape. The function returns the TopoShape itself as
+     *         a self reference so that multiple operations can be carried out
+     *         for the same shape in the same line of code.
+     */
+    TopoShape& makeElementTreeFuse(const std::vector<TopoShape>& sources,
+                                   const char* op = nullptr,
+                                   double tol = 0,
+                                   int clusterSize = 16,
+                                   const TreeFuseCallback& callback = {});
+
     /** Make a boolean cut of this shape with an input shape
      *
      * @param source: the source shape
@@ -2565,6 +2605,7 @@ public:
      */
 
     friend class TopoShapeCache;
+    friend class TopoShapeOpCache;
 
 private:
     // Cache storage
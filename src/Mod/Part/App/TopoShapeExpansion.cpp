@@ -83,6 +83,9 @@
 
 #endif
 
+#include <algorithm>
+#include <numeric>
+
 #if OCC_VERSION_HEX >= 0x070500
 #include <OSD_Parallel.hxx>
 #endif
@@ -93,6 +96,7 @@
 #include "TopoShapeOpCode.h"
 #include "TopoShapeCache.h"
 #include "TopoShapeMapper.h"
+#include "TopoShapeOpCache.h"
 #include "FaceMaker.h"
 #include "Geometry.h"
 #include "BRepOffsetAPI_MakeOffsetFix.h"
@@ -3967,6 +3971,17 @@ TopoShape& TopoShape::makeElementFillet(const TopoShape& shape,
     if (edges.empty()) {
         FC_THROWM(NullShapeException, "Null input shape");
     }
+
+    TopoShapeOpCache::Key key(Part::OpCodes::Fillet, op, *this);
+    key.addShape(shape).addValue(radius1).addValue(radius2);
+    for (auto& e : edges) {
+        key.addShape(e);
+    }
+    auto& cache = TopoShapeOpCache::instance();
+    if (cache.find(key, *this)) {
+        return *this;
+    }
+
     BRepFilletAPI_MakeFillet mkFillet(shape.getShape());
     for (auto& e : edges) {
         if (e.isNull()) {
@@ -3978,7 +3993,9 @@ TopoShape& TopoShape::makeElementFillet(const TopoShape& shape,
         }
         mkFillet.Add(radius1, radius2, TopoDS::Edge(edge));
     }
-    return makeElementShape(mkFillet, shape, op);
+    makeElementShape(mkFillet, shape, op);
+    cache.insert(std::move(key), *this);
+    return *this;
 }
 
 TopoShape& TopoShape::makeElementChamfer(const TopoShape& shape,
@@ -4098,6 +4115,169 @@ TopoShape::makeElementCut(const std::vector<TopoShape>& shapes, const char* op,
     return makeElementBoolean(Part::OpCodes::Cut, shapes, op, tol);
 }
 
+namespace
+{
+// Recursively splits the shapes at the median of the longest axis of their centers, so
+// that neighbouring clusters are also close in space and can be merged pairwise
+void splitClusters(std::vector<int>::iterator begin,
+                   std::vector<int>::iterator end,
+                   const std::vector<Base::Vector3d>& centers,
+                   std::size_t clusterSize,
+                   std::vector<std::vector<int>>& clusters)
+{
+    auto count = static_cast<std::size_t>(std::distance(begin, end));
+    if (count <= clusterSize) {
+        clusters.emplace_back(begin, end);
+        return;
+    }
+
+    Base::BoundBox3d bbox;
+    for (auto it = begin; it != end; ++it) {
+        bbox.Add(centers[*it]);
+    }
+    double length[3] = {bbox.LengthX(), bbox.LengthY(), bbox.LengthZ()};
+    auto axis =
+        static_cast<unsigned short>(std::distance(length, std::max_element(length, length + 3)));
+    auto mid = begin + static_cast<std::ptrdiff_t>(count / 2);
+    std::nth_element(begin, mid, end, [&](int a, int b) {
+        return centers[a][axis] < centers[b][axis];
+    });
+    splitClusters(begin, mid, centers, clusterSize, clusters);
+    splitClusters(mid, end, centers, clusterSize, clusters);
+}
+}  // namespace
+
+TopoShape& TopoShape::makeElementTreeFuse(const std::vector<TopoShape>& shapes,
+                                          const char* op,
+                                          double tol,
+                                          int clusterSize,
+                                          const TreeFuseCallback& callback)
+{
+    if (shapes.empty()) {
+        FC_THROWM(NullShapeException, "Null input shape");
+    }
+    std::vector<Base::Vector3d> centers;
+    centers.reserve(shapes.size());
+    for (const auto& shape : shapes) {
+        if (shape.isNull()) {
+            FC_THROWM(NullShapeException, "Null input shape");
+        }
+        centers.push_back(shape.getBoundBox().GetCenter());
+    }
+    if (shapes.size() == 1) {
+        *this = shapes.front();
+        return *this;
+    }
+
+    std::vector<int> order(shapes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<std::vector<int>> jobs;
+    splitClusters(order.begin(),
+                  order.end(),
+                  centers,
+                  static_cast<std::size_t>(std::max(clusterSize, 2)),
+                  jobs);
+
+    // the input shapes followed by the intermediate results
+    std::vector<TopoShape> nodes(shapes);
+    for (;;) {
+        // The fusions of a level only read the shapes and don't modify them, so they can
+        // run concurrently. The element maps are built afterwards as the string hasher
+        // isn't thread-safe.
+        std::vector<std::unique_ptr<BRepAlgoAPI_Fuse>> makers(jobs.size());
+        std::vector<std::string> errors(jobs.size());
+        auto fuse = [&](int index) {
+            const auto& job = jobs[index];
+            if (job.size() < 2) {
+                return;
+            }
+            try {
+                auto mk = std::make_unique<BRepAlgoAPI_Fuse>();
+                TopTools_ListOfShape shapeArguments, shapeTools;
+                shapeArguments.Append(nodes[job.front()].getShape());
+                for (auto it = job.begin() + 1; it != job.end(); ++it) {
+                    shapeTools.Append(nodes[*it].getShape());
+                }
+                mk->SetArguments(shapeArguments);
+                mk->SetTools(shapeTools);
+                // the inputs may share sub-shapes with the inputs of other clusters
+                mk->SetNonDestructive(Standard_True);
+                mk->SetRunParallel(jobs.size() == 1);
+                if (tol > 0.0) {
+                    mk->SetFuzzyValue(tol);
+                }
+                mk->Build();
+                if (mk->IsDone()) {
+                    makers[index] = std::move(mk);
+                }
+                else {
+                    errors[index] = "Fusion failed";
+                }
+            }
+            catch (const Standard_Failure& e) {
+                errors[index] = e.GetMessageString();
+                if (errors[index].empty()) {
+                    errors[index] = e.DynamicType()->Name();
+                }
+            }
+        };
+        int count = static_cast<int>(jobs.size());
+#if OCC_VERSION_HEX >= 0x070500
+        OSD_Parallel::For(0, count, fuse, count == 1);
+#else
+        for (int index = 0; index < count; ++index) {
+            fuse(index);
+        }
+#endif
+
+        std::vector<int> results;
+        for (std::size_t index = 0; index < jobs.size(); ++index) {
+            const auto& job = jobs[index];
+            if (job.size() < 2) {
+                results.push_back(job.front());
+                continue;
+            }
+            if (!makers[index]) {
+                FC_THROWM(Base::CADKernelError, errors[index]);
+            }
+            std::vector<TopoShape> inputs;
+            inputs.reserve(job.size());
+            for (int id : job) {
+                inputs.push_back(nodes[id]);
+            }
+            TopoShape result(Tag, Hasher);
+            result.makeElementShape(*makers[index], inputs, op);
+            if (callback) {
+                callback(*makers[index], job, result);
+            }
+            makers[index].reset();
+            // release the intermediate results as early as possible
+            for (int id : job) {
+                nodes[id] = TopoShape();
+            }
+            results.push_back(static_cast<int>(nodes.size()));
+            nodes.push_back(std::move(result));
+        }
+
+        if (results.size() == 1) {
+            *this = nodes[results.front()];
+            break;
+        }
+        jobs.clear();
+        for (std::size_t index = 0; index < results.size(); index += 2) {
+            if (index + 1 < results.size()) {
+                jobs.push_back({results[index], results[index + 1]});
+            }
+            else {
+                jobs.push_back({results[index]});
+            }
+        }
+    }
+
+    makeElementShell();
+    return *this;
+}
+
 
 TopoShape& TopoShape::makeElementShape(BRepBuilderAPI_MakeShape& mkShape,
                                        const TopoShape& source,
@@ -4220,8 +4400,18 @@ TopoShape& TopoShape::makeElementPrism(const TopoShape& base, const gp_Vec& vec,
     if (base.isNull()) {
         FC_THROWM(NullShapeException, "Null shape");
     }
+
+    TopoShapeOpCache::Key key(Part::OpCodes::Prism, op, *this);
+    key.addShape(base).addValue(vec.X()).addValue(vec.Y()).addValue(vec.Z());
+    auto& cache = TopoShapeOpCache::instance();
+    if (cache.find(key, *this)) {
+        return *this;
+    }
+
     BRepPrimAPI_MakePrism mkPrism(base.getShape(), vec);
-    return makeElementShape(mkPrism, base, op);
+    makeElementShape(mkPrism, base, op);
+    cache.insert(std::move(key), *this);
+    return *this;
 }
 
 TopoShape& TopoShape::makeElementPrismUntil(const TopoShape& _base,
@@ -4643,6 +4833,14 @@ TopoShape& TopoShape::makeElementRefine(const TopoShape& shape, const char* op,
     if (!op) {
         op = Part::OpCodes::Refine;
     }
+
+    TopoShapeOpCache::Key key(Part::OpCodes::Refine, op, *this);
+    key.addShape(shape);
+    auto& cache = TopoShapeOpCache::instance();
+    if (cache.find(key, *this)) {
+        return *this;
+    }
+
     bool closed = shape.isClosed();
     try {
         MyRefineMaker mkRefine(shape.getShape());
@@ -4653,6 +4851,7 @@ TopoShape& TopoShape::makeElementRefine(const TopoShape& shape, const char* op,
         // For some reason, refine operation may reverse the solid
         fixSolidOrientation();
         if (isClosed() == closed) {
+            cache.insert(std::move(key), *this);
             return *this;
         }
     }
@@ -5684,6 +5883,16 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
         return *this;
     }
 
+    TopoShapeOpCache::Key key(maker, op, *this);
+    key.addValue(tolerance);
+    for (const auto& shape : inputs) {
+        key.addShape(shape);
+    }
+    auto& cache = TopoShapeOpCache::instance();
+    if (cache.find(key, *this)) {
+        return *this;
+    }
+
     std::unique_ptr<BRepAlgoAPI_BooleanOperation> mk;
     if (strcmp(maker, Part::OpCodes::Fuse) == 0) {
         mk.reset(new BRepAlgoAPI_Fuse);
@@ -5746,6 +5955,7 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
     if (buildShell) {
         makeElementShell();
     }
+    cache.insert(std::move(key), *this);
     return *this;
 }
 
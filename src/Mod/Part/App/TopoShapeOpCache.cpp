@@ -0,0 +1,232 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <gp_Trsf.hxx>
+# include <TopLoc_Location.hxx>
+#endif
+
+#include <App/Application.h>
+#include <Base/Parameter.h>
+
+#include "TopoShapeOpCache.h"
+
+
+using namespace Part;
+
+namespace
+{
+// the ID of the feature that is recomputed by the thread
+thread_local long currentOwner = 0;
+}  // namespace
+
+TopoShapeOpCache::OwnerScope::OwnerScope(long owner)
+    : previous(currentOwner)
+{
+    currentOwner = owner;
+}
+
+TopoShapeOpCache::OwnerScope::~OwnerScope()
+{
+    currentOwner = previous;
+}
+
+// ----------------------------------------------------------------------------
+
+TopoShapeOpCache::Key::Key(const char* maker, const char* op, const TopoShape& result)
+    : identified(result.Tag != 0 || currentOwner != 0)
+{
+    data = maker ? maker : "";
+    data += '\0';
+    if (op) {
+        data += op;
+    }
+    data += '\0';
+    append(result.Tag);
+    append(currentOwner);
+    append(static_cast<const App::StringHasher*>(result.Hasher));
+}
+
+TopoShapeOpCache::Key& TopoShapeOpCache::Key::addShape(const TopoShape& input)
+{
+    inputs.push_back(input);
+    const TopoDS_Shape& shape = input.getShape();
+    if (shape.IsNull()) {
+        append(static_cast<const void*>(nullptr));
+        return *this;
+    }
+
+    append(shape.TShape().get());
+    append(static_cast<int>(shape.Orientation()));
+    const gp_Trsf& trsf = shape.Location().Transformation();
+    for (int row = 1; row <= 3; row++) {
+        for (int col = 1; col <= 4; col++) {
+            append(trsf.Value(row, col));
+        }
+    }
+    append(input.Tag);
+    append(static_cast<const App::StringHasher*>(input.Hasher));
+    append(elementMapOf(input));
+    return *this;
+}
+
+TopoShapeOpCache::Key& TopoShapeOpCache::Key::addValue(double value)
+{
+    append(value);
+    return *this;
+}
+
+TopoShapeOpCache::Key& TopoShapeOpCache::Key::addValue(int value)
+{
+    append(value);
+    return *this;
+}
+
+// ----------------------------------------------------------------------------
+
+TopoShapeOpCache::TopoShapeOpCache()
+{
+    hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/OperationCache");
+    hGrp->Attach(this);
+    readSettings();
+}
+
+TopoShapeOpCache::~TopoShapeOpCache()
+{
+    hGrp->Detach(this);
+}
+
+TopoShapeOpCache& TopoShapeOpCache::instance()
+{
+    // never destroyed, the parameter manager may be gone at exit
+    static TopoShapeOpCache* cache = new TopoShapeOpCache;
+    return *cache;
+}
+
+void TopoShapeOpCache::OnChange(Base::Subject<const char*>& /*caller*/, const char* /*reason*/)
+{
+    readSettings();
+}
+
+void TopoShapeOpCache::readSettings()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    enabled = hGrp->GetBool("Enabled", true);
+    memoryLimit = static_cast<std::size_t>(std::max<long>(hGrp->GetInt("MemoryLimit", 256), 0))
+        * 1024 * 1024;
+
+    // drop the least recently used results if the limit was lowered
+    std::size_t limit = enabled ? memoryLimit : 0;
+    while (memSize > limit && !entries.empty()) {
+        memSize -= entries.back().memSize;
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
+
+const void* TopoShapeOpCache::elementMapOf(const TopoShape& shape)
+{
+    return shape.elementMap().get();
+}
+
+bool TopoShapeOpCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return enabled && memoryLimit > 0;
+}
+
+bool TopoShapeOpCache::find(const Key& key, TopoShape& result)
+{
+    if (!key.identified) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!enabled || memoryLimit == 0) {
+        return false;
+    }
+
+    auto it = index.find(key.data);
+    if (it == index.end()) {
+        return false;
+    }
+
+    entries.splice(entries.begin(), entries, it->second);
+    result = it->second->result;
+    return true;
+}
+
+void TopoShapeOpCache::insert(Key&& key, const TopoShape& result)
+{
+    if (!key.identified || !isEnabled() || result.isNull()) {
+        return;
+    }
+
+    // the element map is not part of the memory size of the shape
+    std::size_t size = result.getMemSize() + key.data.size()
+        + result.getElementMapSize(false) * sizeof(Data::MappedElement);
+    for (const auto& input : key.inputs) {
+        size += input.getMemSize();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key.data);
+    if (it != index.end()) {
+        memSize -= it->second->memSize;
+        entries.erase(it->second);
+        index.erase(it);
+    }
+
+    if (size > memoryLimit) {
+        return;
+    }
+
+    entries.push_front({std::move(key.data), std::move(key.inputs), result, size});
+    index[entries.front().key] = entries.begin();
+    memSize += size;
+
+    // drop the least recently used results
+    while (memSize > memoryLimit && !entries.empty()) {
+        memSize -= entries.back().memSize;
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
+
+void TopoShapeOpCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    memSize = 0;
+}
+
+std::size_t TopoShapeOpCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
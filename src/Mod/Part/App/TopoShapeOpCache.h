@@ -0,0 +1,149 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef PART_TOPOSHAPEOPCACHE_H
+#define PART_TOPOSHAPEOPCACHE_H
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Base/Parameter.h>
+#include <Mod/Part/PartGlobal.h>
+
+#include "TopoShape.h"
+
+namespace Part
+{
+
+/** Cache of the results of shape operations
+ *
+ * A result is identified by the operation code, its parameters, the tag and
+ * string hasher of the result, the feature that is recomputed and the identity
+ * of the input shapes, i.e. their TShape, location, orientation, tag and
+ * element map. Most features build their results without a tag, so a result is
+ * only cached if it has a tag or is made during the recompute of a feature,
+ * see OwnerScope. Recomputing a feature whose inputs didn't change, e.g. after
+ * an undo or after editing an unrelated feature, then reuses the shape and
+ * element map of the previous run. The cache holds a copy of the inputs, so
+ * their identity can't be taken over by another shape as long as the result is
+ * cached.
+ *
+ * The least recently used results are dropped when the memory limit is
+ * exceeded, the pinned inputs count against the limit. The settings are read
+ * from the parameter group BaseApp/Preferences/Mod/Part/OperationCache:
+ * Enabled and MemoryLimit in MB.
+ */
+class PartExport TopoShapeOpCache: public ParameterGrp::ObserverType
+{
+public:
+    /// The identity of an operation
+    class PartExport Key
+    {
+    public:
+        /// \a result is the shape the operation is called on, its tag and hasher name the elements
+        Key(const char* maker, const char* op, const TopoShape& result);
+
+        Key& addShape(const TopoShape& input);
+        Key& addValue(double value);
+        Key& addValue(int value);
+
+    private:
+        template<typename T>
+        void append(const T& value)
+        {
+            data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+    private:
+        std::string data;
+        std::vector<TopoShape> inputs;
+        bool identified;
+
+        friend class TopoShapeOpCache;
+    };
+
+    /// Marks the operations of the current thread as made by the feature with the ID \a owner
+    class PartExport OwnerScope
+    {
+    public:
+        explicit OwnerScope(long owner);
+        ~OwnerScope();
+
+        OwnerScope(const OwnerScope&) = delete;
+        OwnerScope(OwnerScope&&) = delete;
+        OwnerScope& operator=(const OwnerScope&) = delete;
+        OwnerScope& operator=(OwnerScope&&) = delete;
+
+    private:
+        long previous;
+    };
+
+    static TopoShapeOpCache& instance();
+
+    bool isEnabled() const;
+    /// update the settings if the parameter group changes
+    void OnChange(Base::Subject<const char*>& caller, const char* reason) override;
+    /// assigns the cached result of \a key to \a result, returns false if there is none
+    bool find(const Key& key, TopoShape& result);
+    void insert(Key&& key, const TopoShape& result);
+    /// removes all results
+    void clear();
+    /// returns the number of cached results
+    std::size_t size() const;
+
+    TopoShapeOpCache(const TopoShapeOpCache&) = delete;
+    TopoShapeOpCache(TopoShapeOpCache&&) = delete;
+    TopoShapeOpCache& operator=(const TopoShapeOpCache&) = delete;
+    TopoShapeOpCache& operator=(TopoShapeOpCache&&) = delete;
+
+private:
+    TopoShapeOpCache();
+    ~TopoShapeOpCache() override;
+
+    void readSettings();
+    static const void* elementMapOf(const TopoShape& shape);
+
+private:
+    struct Entry
+    {
+        std::string key;
+        std::vector<TopoShape> inputs;
+        TopoShape result;
+        std::size_t memSize;
+    };
+
+    /// most recently used first
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    std::size_t memSize = 0;
+    std::size_t memoryLimit = 0;
+    bool enabled = true;
+    ParameterGrp::handle hGrp;
+    mutable std::mutex mutex;
+};
+
+}  // namespace Part
+
+#endif  // PART_TOPOSHAPEOPCACHE_H
@@ -0,0 +1,397 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <iomanip>
+# include <sstream>
+# include <BinTools.hxx>
+# include <Standard_Failure.hxx>
+# include <Standard_Version.hxx>
+# include <TopLoc_Location.hxx>
+# include <TopoDS_Shape.hxx>
+# include <QByteArray>
+# include <QCryptographicHash>
+#endif
+
+#include <App/Application.h>
+#include <Base/Console.h>
+#include <Base/FileInfo.h>
+#include <Base/Parameter.h>
+#include <Base/Stream.h>
+
+#include "TessellationCache.h"
+
+
+FC_LOG_LEVEL_INIT("Part", true, true)
+
+using namespace PartGui;
+
+namespace
+{
+// increase if the layout of the tessellation data changes
+const uint32_t FormatVersion = 1;
+const uint32_t FormatMagic = 0x53544346;  // "FCTS"
+
+template<typename T>
+void writeArray(std::ostream& str, const std::vector<T>& array)
+{
+    uint64_t size = array.size();
+    str.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    str.write(reinterpret_cast<const char*>(array.data()),
+              static_cast<std::streamsize>(size * sizeof(T)));
+}
+
+template<typename T>
+bool readArray(std::istream& str, std::vector<T>& array, uint64_t maxSize)
+{
+    uint64_t size {};
+    if (!str.read(reinterpret_cast<char*>(&size), sizeof(size)) || size > maxSize / sizeof(T)) {
+        return false;
+    }
+    array.resize(static_cast<std::size_t>(size));
+    return static_cast<bool>(str.read(reinterpret_cast<char*>(array.data()),
+                                      static_cast<std::streamsize>(size * sizeof(T))));
+}
+}  // namespace
+
+std::size_t TessellationData::memSize() const
+{
+    return sizeof(TessellationData)
+        + (points.size() + normals.size()) * sizeof(SbVec3f)
+        + (faceIndex.size() + partIndex.size() + lineIndex.size()) * sizeof(int32_t);
+}
+
+bool TessellationData::isValid() const
+{
+    // The normals only exist for the nodes of the faces, which are the first points, and are
+    // indexed by the triangles as well
+    auto numNormals = static_cast<int64_t>(normals.size());
+    auto numPoints = static_cast<int64_t>(points.size());
+    if (numNormals > numPoints || vertexStart < 0 || vertexStart > numPoints
+        || faceIndex.size() % 4 != 0) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < faceIndex.size(); i += 4) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            if (faceIndex[i + j] < 0 || faceIndex[i + j] >= numNormals) {
+                return false;
+            }
+        }
+        if (faceIndex[i + 3] != -1) {
+            return false;
+        }
+    }
+
+    int64_t numTriangles = 0;
+    for (int32_t count : partIndex) {
+        if (count < 0) {
+            return false;
+        }
+        numTriangles += count;
+    }
+    if (numTriangles != static_cast<int64_t>(faceIndex.size() / 4)) {
+        return false;
+    }
+
+    return std::all_of(lineIndex.begin(), lineIndex.end(), [numPoints](int32_t index) {
+        return index == -1 || (index >= 0 && index < numPoints);
+    });
+}
+
+// ----------------------------------------------------------------------------
+
+TessellationCache::TessellationCache()
+{
+    hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/TessellationCache");
+    hGrp->Attach(this);
+    readSettings();
+}
+
+TessellationCache::~TessellationCache()
+{
+    hGrp->Detach(this);
+}
+
+TessellationCache& TessellationCache::instance()
+{
+    // never destroyed, the parameter manager may be gone at exit
+    static TessellationCache* cache = new TessellationCache;
+    return *cache;
+}
+
+void TessellationCache::OnChange(Base::Subject<const char*>& /*caller*/, const char* /*reason*/)
+{
+    readSettings();
+}
+
+void TessellationCache::readSettings()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    enabled = hGrp->GetBool("Enabled", true);
+    diskCache = hGrp->GetBool("DiskCache", false);
+    memoryLimit = static_cast<std::size_t>(std::max<long>(hGrp->GetInt("MemoryLimit", 256), 0))
+        * 1024 * 1024;
+    diskLimit = static_cast<std::size_t>(std::max<long>(hGrp->GetInt("DiskLimit", 1024), 0))
+        * 1024 * 1024;
+    if (directory.empty()) {
+        directory = App::Application::getUserCachePath() + "Tessellation/";
+    }
+
+    // drop the least recently used tessellations if the limit was lowered
+    std::size_t limit = enabled ? memoryLimit : 0;
+    while (memSize > limit && !entries.empty()) {
+        memSize -= entries.back().second->memSize();
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+bool TessellationCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return enabled && (memoryLimit > 0 || diskCache);
+}
+
+std::string TessellationCache::makeKey(const TopoDS_Shape& shape,
+                                       double deflection,
+                                       double angularDeflection,
+                                       bool normalsFromUV)
+{
+#if OCC_VERSION_HEX >= 0x070600
+    if (!isEnabled() || shape.IsNull()) {
+        return {};
+    }
+
+    std::ostringstream str(std::ios::out | std::ios::binary);
+    try {
+        // The triangulation must be left out as it is added by the meshing
+        BinTools::Write(shape.Located(TopLoc_Location()),
+                        str,
+                        Standard_False,
+                        Standard_False,
+                        BinTools_FormatVersion_CURRENT);
+    }
+    catch (const Standard_Failure& e) {
+        FC_LOG("Cannot hash shape: " << e.GetMessageString());
+        return {};
+    }
+
+    std::ostringstream params;
+    params << std::setprecision(17) << deflection << ' ' << angularDeflection << ' '
+           << normalsFromUV << ' ' << OCC_VERSION_HEX << ' ' << FormatVersion;
+
+    std::string data = str.str();
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray::fromRawData(data.data(), static_cast<int>(data.size())));
+    hash.addData(QByteArray::fromStdString(params.str()));
+    return hash.result().toHex().toStdString();
+#else
+    // Older versions always write the triangulation
+    (void)shape;
+    (void)deflection;
+    (void)angularDeflection;
+    (void)normalsFromUV;
+    return {};
+#endif
+}
+
+std::shared_ptr<const TessellationData> TessellationCache::find(const std::string& key)
+{
+    if (key.empty()) {
+        return {};
+    }
+
+    std::shared_ptr<const TessellationData> data;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key);
+        if (it != index.end()) {
+            entries.splice(entries.begin(), entries, it->second);
+            return it->second->second;
+        }
+        if (!diskCache) {
+            return {};
+        }
+    }
+
+    data = readDisk(key);
+    if (data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        insertMemory(key, data);
+    }
+    return data;
+}
+
+void TessellationCache::insert(const std::string& key,
+                               const std::shared_ptr<const TessellationData>& data)
+{
+    if (key.empty() || !data) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    insertMemory(key, data);
+    if (diskCache) {
+        writeDisk(key, *data);
+    }
+}
+
+void TessellationCache::insertMemory(const std::string& key,
+                                     const std::shared_ptr<const TessellationData>& data)
+{
+    auto it = index.find(key);
+    if (it != index.end()) {
+        memSize -= it->second->second->memSize();
+        entries.erase(it->second);
+        index.erase(it);
+    }
+
+    std::size_t size = data->memSize();
+    if (size > memoryLimit) {
+        return;
+    }
+
+    entries.emplace_front(key, data);
+    index[key] = entries.begin();
+    memSize += size;
+
+    // drop the least recently used tessellations
+    while (memSize > memoryLimit && !entries.empty()) {
+        memSize -= entries.back().second->memSize();
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+void TessellationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    memSize = 0;
+
+    Base::FileInfo dir(directory);
+    if (dir.isDir()) {
+        for (const auto& file : dir.getDirectoryContent()) {
+            if (file.hasExtension("tess")) {
+                file.deleteFile();
+            }
+        }
+    }
+    diskSize = 0;
+}
+
+std::string TessellationCache::diskPath(const std::string& key) const
+{
+    return directory + key + ".tess";
+}
+
+std::shared_ptr<const TessellationData> TessellationCache::readDisk(const std::string& key) const
+{
+    Base::FileInfo fi(diskPath(key));
+    if (!fi.isReadable()) {
+        return {};
+    }
+
+    Base::ifstream str(fi, std::ios::in | std::ios::binary);
+    uint64_t maxSize = fi.size();
+    uint32_t magic {};
+    uint32_t version {};
+    auto data = std::make_shared<TessellationData>();
+    str.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    str.read(reinterpret_cast<char*>(&version), sizeof(version));
+    str.read(reinterpret_cast<char*>(&data->vertexStart), sizeof(data->vertexStart));
+    if (!str || magic != FormatMagic || version != FormatVersion
+        || !readArray(str, data->points, maxSize) || !readArray(str, data->normals, maxSize)
+        || !readArray(str, data->faceIndex, maxSize) || !readArray(str, data->partIndex, maxSize)
+        || !readArray(str, data->lineIndex, maxSize) || !data->isValid()) {
+        FC_WARN("Ignore invalid tessellation cache file " << fi.filePath());
+        return {};
+    }
+    return data;
+}
+
+void TessellationCache::writeDisk(const std::string& key, const TessellationData& data)
+{
+    Base::FileInfo dir(directory);
+    if (!dir.exists() && !dir.createDirectories()) {
+        return;
+    }
+
+    Base::FileInfo fi(diskPath(key));
+    Base::ofstream str(fi, std::ios::out | std::ios::trunc | std::ios::binary);
+    str.write(reinterpret_cast<const char*>(&FormatMagic), sizeof(FormatMagic));
+    str.write(reinterpret_cast<const char*>(&FormatVersion), sizeof(FormatVersion));
+    str.write(reinterpret_cast<const char*>(&data.vertexStart), sizeof(data.vertexStart));
+    writeArray(str, data.points);
+    writeArray(str, data.normals);
+    writeArray(str, data.faceIndex);
+    writeArray(str, data.partIndex);
+    writeArray(str, data.lineIndex);
+    str.close();
+    if (!str) {
+        FC_WARN("Cannot write tessellation cache file " << fi.filePath());
+        fi.deleteFile();
+        return;
+    }
+
+    diskSize += data.memSize();
+    if (!diskPruned || diskSize > diskLimit) {
+        pruneDisk();
+    }
+}
+
+void TessellationCache::pruneDisk()
+{
+    diskPruned = true;
+
+    std::vector<std::pair<std::time_t, Base::FileInfo>> files;
+    diskSize = 0;
+    for (auto& file : Base::FileInfo(directory).getDirectoryContent()) {
+        if (file.hasExtension("tess")) {
+            diskSize += file.size();
+            files.emplace_back(file.lastModified().getTime_t(), file);
+        }
+    }
+    if (diskSize <= diskLimit) {
+        return;
+    }
+
+    // remove the oldest files until three quarters of the limit are used
+    std::sort(files.begin(), files.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    for (auto& file : files) {
+        if (diskSize <= diskLimit / 4 * 3) {
+            break;
+        }
+        std::size_t size = file.second.size();
+        if (file.second.deleteFile()) {
+            diskSize -= std::min(size, diskSize);
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef PARTGUI_TESSELLATIONCACHE_H
+#define PARTGUI_TESSELLATIONCACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Inventor/SbVec3f.h>
+#include <Base/Parameter.h>
+#include <Mod/Part/PartGlobal.h>
+
+class TopoDS_Shape;
+
+namespace PartGui
+{
+
+/// The node arrays of the visual representation of a shape
+struct PartGuiExport TessellationData
+{
+    std::vector<SbVec3f> points;
+    std::vector<SbVec3f> normals;
+    /// triangle indices, each triangle is terminated with -1
+    std::vector<int32_t> faceIndex;
+    /// number of triangles per face
+    std::vector<int32_t> partIndex;
+    /// point indices of the edges, each edge is terminated with -1
+    std::vector<int32_t> lineIndex;
+    /// index of the first vertex point
+    int32_t vertexStart = 0;
+
+    std::size_t memSize() const;
+    /// checks that the indices are within the arrays they refer to
+    bool isValid() const;
+};
+
+/** Cache of the tessellations of shapes
+ *
+ * The tessellations are identified by a content hash of the shape and the
+ * tessellation parameters, so a bit-identical shape, e.g. of a reopened
+ * document, doesn't need to be meshed again. The recently used tessellations
+ * are kept in memory up to a size limit, optionally they are also stored in
+ * the user cache directory.
+ *
+ * The settings are read from the parameter group
+ * BaseApp/Preferences/Mod/Part/TessellationCache: Enabled, MemoryLimit and
+ * DiskLimit in MB, and DiskCache.
+ */
+class PartGuiExport TessellationCache: public ParameterGrp::ObserverType
+{
+public:
+    static TessellationCache& instance();
+
+    bool isEnabled() const;
+    /// update the settings if the parameter group changes
+    void OnChange(Base::Subject<const char*>& caller, const char* reason) override;
+
+    /** Returns the key of the tessellation of \a shape with the given parameters,
+     * an empty string if the cache is disabled or the shape can't be hashed.
+     * The location of the shape is ignored.
+     */
+    std::string makeKey(const TopoDS_Shape& shape,
+                        double deflection,
+                        double angularDeflection,
+                        bool normalsFromUV);
+
+    /// returns the cached tessellation or null
+    std::shared_ptr<const TessellationData> find(const std::string& key);
+    void insert(const std::string& key, const std::shared_ptr<const TessellationData>& data);
+    /// removes all tessellations from memory and disk
+    void clear();
+
+    TessellationCache(const TessellationCache&) = delete;
+    TessellationCache(TessellationCache&&) = delete;
+    TessellationCache& operator=(const TessellationCache&) = delete;
+    TessellationCache& operator=(TessellationCache&&) = delete;
+
+private:
+    TessellationCache();
+    ~TessellationCache() override;
+
+    void readSettings();
+    void insertMemory(const std::string& key, const std::shared_ptr<const TessellationData>& data);
+    std::string diskPath(const std::string& key) const;
+    std::shared_ptr<const TessellationData> readDisk(const std::string& key) const;
+    void writeDisk(const std::string& key, const TessellationData& data);
+    void pruneDisk();
+
+private:
+    using Entry = std::pair<std::string, std::shared_ptr<const TessellationData>>;
+    /// most recently used first
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    std::size_t memSize = 0;
+    std::size_t memoryLimit = 0;
+    std::size_t diskLimit = 0;
+    std::size_t diskSize = 0;
+    bool enabled = true;
+    bool diskCache = false;
+    bool diskPruned = false;
+    std::string directory;
+    ParameterGrp::handle hGrp;
+    mutable std::mutex mutex;
+};
+
+}  // namespace PartGui
+
+#endif  // PARTGUI_TESSELLATIONCACHE_H
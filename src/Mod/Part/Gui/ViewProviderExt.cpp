@@ -26,6 +26,7 @@
 # include <Bnd_Box.hxx>
 # include <BRep_Tool.hxx>
 # include <BRepBndLib.hxx>
+# include <BRepBuilderAPI_Copy.hxx>
 # include <BRepBuilderAPI_MakeVertex.hxx>
 # include <BRepExtrema_DistShapeShape.hxx>
 # include <BRepMesh_IncrementalMesh.hxx>
@@ -41,6 +42,7 @@
 # include <TColStd_Array1OfInteger.hxx>
 # include <TopExp.hxx>
 # include <TopExp_Explorer.hxx>
+# include <TopLoc_Location.hxx>
 # include <TopoDS.hxx>
 # include <TopoDS_Edge.hxx>
 # include <TopoDS_Face.hxx>
@@ -50,13 +52,19 @@
 
 # include <QAction>
 # include <QMenu>
+# include <QtConcurrentRun>
 # include <sstream>
 
 # include <Inventor/SoPickedPoint.h>
+# include <Inventor/actions/SoGLRenderAction.h>
 # include <Inventor/details/SoFaceDetail.h>
 # include <Inventor/details/SoLineDetail.h>
 # include <Inventor/details/SoPointDetail.h>
+# include <Inventor/elements/SoModelMatrixElement.h>
+# include <Inventor/elements/SoViewportRegionElement.h>
+# include <Inventor/elements/SoViewVolumeElement.h>
 # include <Inventor/errors/SoDebugError.h>
+# include <Inventor/nodes/SoCallback.h>
 # include <Inventor/nodes/SoCoordinate3.h>
 # include <Inventor/nodes/SoDrawStyle.h>
 # include <Inventor/nodes/SoMaterial.h>
@@ -66,6 +74,8 @@
 # include <Inventor/nodes/SoPolygonOffset.h>
 # include <Inventor/nodes/SoSeparator.h>
 # include <Inventor/nodes/SoShapeHints.h>
+# include <Inventor/nodes/SoSwitch.h>
+# include <Inventor/sensors/SoOneShotSensor.h>
 
 # include <boost/algorithm/string/predicate.hpp>
 #endif
@@ -91,6 +101,7 @@
 #include "SoBrepFaceSet.h"
 #include "SoBrepPointSet.h"
 #include "TaskFaceAppearances.h"
+#include "TessellationCache.h"
 
 
 FC_LOG_LEVEL_INIT("Part", true, true)
@@ -108,6 +119,11 @@ long toPercent(float value)
 {
     return std::lround(100.0 * value);
 }
+
+// number of tessellations of a shape with a decreasing level of detail
+const int NumDetailLevels = 4;
+// ratio of the deflection of two successive detail levels
+const double DetailLevelFactor = 4.0;
 }
 
 PROPERTY_SOURCE(PartGui::ViewProviderPartExt, Gui::ViewProviderGeometryObject)
@@ -212,6 +228,14 @@ ViewProviderPartExt::ViewProviderPartExt()
     nodeset = new SoBrepPointSet();
     nodeset->ref();
 
+    pcDetailSwitch = new SoSwitch();
+    pcDetailSwitch->ref();
+    auto detailCallback = new SoCallback();
+    detailCallback->setCallback(detailLevelCallback, this);
+    pcDetailSwitch->addChild(detailCallback);
+    pcDetailSwitch->whichChild = SO_SWITCH_NONE;
+    detailSensor = new SoOneShotSensor(detailLevelSensorCB, this);
+
     pcFaceBind = new SoMaterialBinding();
     pcFaceBind->ref();
 
@@ -245,6 +269,11 @@ ViewProviderPartExt::ViewProviderPartExt()
 
     sPixmap = "Part_3D_object";
     loadParameter();
+
+    QObject::connect(&tessellationWatcher, &QFutureWatcherBase::finished,
+                     &tessellationWatcher, [this] { this->onTessellationFinished(); });
+    QObject::connect(&detailWatcher, &QFutureWatcherBase::finished,
+                     &detailWatcher, [this] { this->onDetailLevelFinished(); });
 }
 
 ViewProviderPartExt::~ViewProviderPartExt()
@@ -263,6 +292,8 @@ ViewProviderPartExt::~ViewProviderPartExt()
     normb->unref();
     lineset->unref();
     nodeset->unref();
+    pcDetailSwitch->unref();
+    delete detailSensor;
 }
 
 PyObject* ViewProviderPartExt::getPyObject()
@@ -471,6 +502,7 @@ void ViewProviderPartExt::attach(App::DocumentObject *pcFeat)
 
     // Move 'coords' before the switch
     pcRoot->insertChild(coords,pcRoot->findChild(pcModeSwitch));
+    pcRoot->insertChild(pcDetailSwitch,pcRoot->findChild(coords));
 
     // putting all together with the switch
     addDisplayMaskMode(pcNormalRoot, "Flat Lines");
@@ -923,62 +955,22 @@ void ViewProviderPartExt::unsetEdit(int ModNum)
     }
 }
 
-void ViewProviderPartExt::updateVisual()
+namespace {
+// Meshes the shape and collects the node arrays of its visual representation
+class ShapeTessellator
 {
-    Gui::SoUpdateVBOAction action;
-    action.apply(this->faceset);
-
-    // Clear selection
-    Gui::SoSelectionElementAction saction(Gui::SoSelectionElementAction::None);
-    saction.apply(this->faceset);
-    saction.apply(this->lineset);
-    saction.apply(this->nodeset);
-
-    // Clear highlighting
-    Gui::SoHighlightElementAction haction;
-    haction.apply(this->faceset);
-    haction.apply(this->lineset);
-    haction.apply(this->nodeset);
-
-    TopoDS_Shape cShape = Part::Feature::getShape(getObject());
-    if (cShape.IsNull()) {
-        coords  ->point      .setNum(0);
-        norm    ->vector     .setNum(0);
-        faceset ->coordIndex .setNum(0);
-        faceset ->partIndex  .setNum(0);
-        lineset ->coordIndex .setNum(0);
-        nodeset ->startIndex .setValue(0);
-        VisualTouched = false;
-        return;
+public:
+    ShapeTessellator(Standard_Real deflection, Standard_Real angularDeflection, bool normalsFromUV)
+        : deflection(deflection)
+        , AngDeflectionRads(angularDeflection)
+        , NormalsFromUV(normalsFromUV)
+    {
     }
 
-    // time measurement and book keeping
-    Base::TimeElapsed start_time;
-    int numTriangles=0,numNodes=0,numNorms=0,numFaces=0,numEdges=0,numLines=0;
-    std::set<int> faceEdges;
-
-    try {
-        // calculating the deflection value
-        Bnd_Box bounds;
-        BRepBndLib::Add(cShape, bounds);
-        bounds.SetGap(0.0);
-        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
-        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
-        Standard_Real deflection = ((xMax-xMin)+(yMax-yMin)+(zMax-zMin))/300.0 * Deviation.getValue();
-
-        // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single vertex
-        // should be displayed.
-        if (deflection < gp::Resolution()) {
-            deflection = Precision::Confusion();
-        }
-
-        // For very big objects the computed deflection can become very high and thus leads to a useless
-        // tessellation. To avoid this the upper limit is set to 20.0
-        // See also forum: https://forum.freecad.org/viewtopic.php?t=77521
-        deflection = std::min(deflection, 20.0);
-
-        // create or use the mesh on the data structure
-        Standard_Real AngDeflectionRads = AngularDeflection.getValue() / 180.0 * M_PI;
+    std::shared_ptr<TessellationData> operator()(TopoDS_Shape cShape) const
+    {
+        int numTriangles=0,numNodes=0,numNorms=0,numFaces=0;
+        std::set<int> faceEdges;
 
 #if OCC_VERSION_HEX >= 0x070500
         IMeshTools_Parameters meshParams;
@@ -1032,7 +1024,6 @@ void ViewProviderPartExt::updateVisual()
         // count and index the edges
         for (int i=1; i <= edgeMap.Extent(); i++) {
             edgeIdxSet.insert(i);
-            numEdges++;
 
             const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
             TopLoc_Location aLoc;
@@ -1060,15 +1051,16 @@ void ViewProviderPartExt::updateVisual()
         numNodes += vertexMap.Extent();
 
         // create memory for the nodes and indexes
-        coords  ->point      .setNum(numNodes);
-        norm    ->vector     .setNum(numNorms);
-        faceset ->coordIndex .setNum(numTriangles*4);
-        faceset ->partIndex  .setNum(numFaces);
+        auto data = std::make_shared<TessellationData>();
+        data->points.resize(numNodes);
+        data->normals.resize(numNorms);
+        data->faceIndex.resize(numTriangles*4);
+        data->partIndex.resize(numFaces);
         // get the raw memory for fast fill up
-        SbVec3f* verts = coords  ->point       .startEditing();
-        SbVec3f* norms = norm    ->vector      .startEditing();
-        int32_t* index = faceset ->coordIndex  .startEditing();
-        int32_t* parts = faceset ->partIndex   .startEditing();
+        SbVec3f* verts = data->points.data();
+        SbVec3f* norms = data->normals.data();
+        int32_t* index = data->faceIndex.data();
+        int32_t* parts = data->partIndex.data();
 
         // preset the normal vector with null vector
         for (int i=0;i < numNorms;i++)
@@ -1270,7 +1262,7 @@ void ViewProviderPartExt::updateVisual()
             }
         }
 
-        nodeset->startIndex.setValue(faceNodeOffset);
+        data->vertexStart = faceNodeOffset;
         for (int i=0; i<vertexMap.Extent(); i++) {
             const TopoDS_Vertex& aVertex = TopoDS::Vertex(vertexMap(i+1));
             gp_Pnt pnt = BRep_Tool::Pnt(aVertex);
@@ -1281,27 +1273,155 @@ void ViewProviderPartExt::updateVisual()
         for (int i = 0; i< numNorms ;i++)
             norms[i].normalize();
 
-        std::vector<int32_t> lineSetCoords;
         for (const auto & it : lineSetMap) {
-            lineSetCoords.insert(lineSetCoords.end(), it.second.begin(), it.second.end());
-            lineSetCoords.push_back(-1);
+            data->lineIndex.insert(data->lineIndex.end(), it.second.begin(), it.second.end());
+            data->lineIndex.push_back(-1);
+        }
+
+        return data;
+    }
+
+private:
+    Standard_Real deflection;
+    Standard_Real AngDeflectionRads;
+    bool NormalsFromUV;
+};
+
+// Looks up or meshes the shape in a worker thread, the key is computed if it is unknown.
+// Only the private copy is accessed, the shape itself may be meshed by the GUI thread
+// meanwhile and is just passed back to identify the result.
+TessellationResult tessellateInBackground(const TopoDS_Shape& shape,
+                                          const TopoDS_Shape& copy,
+                                          std::string key,
+                                          Standard_Real deflection,
+                                          Standard_Real angle,
+                                          bool normalsFromUV)
+{
+    TessellationResult result;
+    result.shape = shape;
+    result.deflection = deflection;
+    result.angle = angle;
+    try {
+        TessellationCache& cache = TessellationCache::instance();
+        if (key.empty()) {
+            key = cache.makeKey(copy, deflection, angle, normalsFromUV);
+        }
+        result.key = key;
+        result.data = cache.find(key);
+        if (!result.data) {
+            std::shared_ptr<const TessellationData> data =
+                ShapeTessellator(deflection, angle, normalsFromUV)(copy);
+            cache.insert(key, data);
+            result.data = data;
+        }
+    }
+    catch (const Standard_Failure& e) {
+        FC_ERR("Cannot tessellate shape: " << e.GetMessageString());
+    }
+    catch (...) {
+        FC_ERR("Cannot tessellate shape");
+    }
+    return result;
+}
+}
+
+void ViewProviderPartExt::updateVisual()
+{
+    Gui::SoUpdateVBOAction action;
+    action.apply(this->faceset);
+
+    // Clear selection
+    Gui::SoSelectionElementAction saction(Gui::SoSelectionElementAction::None);
+    saction.apply(this->faceset);
+    saction.apply(this->lineset);
+    saction.apply(this->nodeset);
+
+    // Clear highlighting
+    Gui::SoHighlightElementAction haction;
+    haction.apply(this->faceset);
+    haction.apply(this->lineset);
+    haction.apply(this->nodeset);
+
+    TopoDS_Shape cShape = Part::Feature::getShape(getObject());
+    if (cShape.IsNull()) {
+        coords  ->point      .setNum(0);
+        norm    ->vector     .setNum(0);
+        faceset ->coordIndex .setNum(0);
+        faceset ->partIndex  .setNum(0);
+        lineset ->coordIndex .setNum(0);
+        nodeset ->startIndex .setValue(0);
+        tessellationPending = false;
+        resetDetailLevels(nullptr);
+        VisualTouched = false;
+        return;
+    }
+
+    // time measurement and book keeping
+    Base::TimeElapsed start_time;
+    int numTriangles=0,numNodes=0,numFaces=0,numLines=0;
+
+    try {
+        // calculating the deflection value, the shape is meshed and shown without its
+        // placement, which is applied by the transform node
+        Bnd_Box bounds;
+        BRepBndLib::Add(cShape.Located(TopLoc_Location()), bounds);
+        bounds.SetGap(0.0);
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        Standard_Real deflection = ((xMax-xMin)+(yMax-yMin)+(zMax-zMin))/300.0 * Deviation.getValue();
+
+        // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single vertex
+        // should be displayed.
+        if (deflection < gp::Resolution()) {
+            deflection = Precision::Confusion();
         }
 
-        // preset the index vector size
-        numLines =  lineSetCoords.size();
-        lineset ->coordIndex .setNum(numLines);
-        int32_t* lines = lineset ->coordIndex  .startEditing();
+        // For very big objects the computed deflection can become very high and thus leads to a useless
+        // tessellation. To avoid this the upper limit is set to 20.0
+        // See also forum: https://forum.freecad.org/viewtopic.php?t=77521
+        deflection = std::min(deflection, 20.0);
+
+        // create or use the mesh on the data structure
+        Standard_Real AngDeflectionRads = AngularDeflection.getValue() / 180.0 * M_PI;
 
-        int l=0;
-        for (std::vector<int32_t>::const_iterator it=lineSetCoords.begin();it!=lineSetCoords.end();++it,l++)
-            lines[l] = *it;
+        detailCenter.setValue(float((xMin+xMax)/2), float((yMin+yMax)/2), float((zMin+zMax)/2));
+        detailDeflection = deflection;
+        detailAngularDeflection = AngDeflectionRads;
+
+        // reuse the tessellation of an identical shape, hashing a big shape
+        // is left to the worker thread
+        bool background = isBackgroundTessellation(cShape);
+        TessellationCache& cache = TessellationCache::instance();
+        std::string key = getTessellationKey(cShape, deflection, AngDeflectionRads, !background);
+        std::shared_ptr<const TessellationData> data = cache.find(key);
+        if (!data && background) {
+            // Copy the topology for the worker thread so that it doesn't read a shape
+            // that is meshed here, e.g. by another view provider of the same shape
+            TopoDS_Shape copy = BRepBuilderAPI_Copy(cShape, Standard_False).Shape();
+            bool normalsFromUV = NormalsFromUV;
+            auto lambda = [cShape, copy, key, deflection, AngDeflectionRads, normalsFromUV]() {
+                return tessellateInBackground(cShape, copy, key, deflection, AngDeflectionRads,
+                                              normalsFromUV);
+            };
+            tessellationPending = true;
+            tessellationWatcher.setFuture(QtConcurrent::run(std::move(lambda)));
+            showBoundingBox(xMin, yMin, zMin, xMax, yMax, zMax);
+            resetDetailLevels(nullptr);
+        }
+        else {
+            if (!data) {
+                data = ShapeTessellator(deflection, AngDeflectionRads, NormalsFromUV)(cShape);
+                cache.insert(key, data);
+            }
 
-        // end the editing of the nodes
-        coords  ->point       .finishEditing();
-        norm    ->vector      .finishEditing();
-        faceset ->coordIndex  .finishEditing();
-        faceset ->partIndex   .finishEditing();
-        lineset ->coordIndex  .finishEditing();
+            tessellationPending = false;
+            applyTessellation(*data);
+            resetDetailLevels(data);
+            numNodes = static_cast<int>(data->points.size());
+            numTriangles = static_cast<int>(data->faceIndex.size() / 4);
+            numFaces = static_cast<int>(data->partIndex.size());
+            numLines = static_cast<int>(data->lineIndex.size());
+        }
     }
     catch (const Standard_Failure& e) {
         FC_ERR("Cannot compute Inventor representation for the shape of "
@@ -1314,9 +1434,12 @@ void ViewProviderPartExt::updateVisual()
 #   ifdef FC_DEBUG
         // printing some information
         Base::Console().Log("ViewProvider update time: %f s\n",Base::TimeElapsed::diffTimeF(start_time,Base::TimeElapsed()));
-        Base::Console().Log("Shape tria info: Faces:%d Edges:%d Nodes:%d Triangles:%d IdxVec:%d\n",numFaces,numEdges,numNodes,numTriangles,numLines);
+        Base::Console().Log("Shape tria info: Faces:%d Nodes:%d Triangles:%d IdxVec:%d\n",numFaces,numNodes,numTriangles,numLines);
 #   else
-    (void)numEdges;
+    (void)numNodes;
+    (void)numTriangles;
+    (void)numFaces;
+    (void)numLines;
 #   endif
     VisualTouched = false;
 
@@ -1326,11 +1449,306 @@ void ViewProviderPartExt::updateVisual()
     setHighlightedPoints(PointColorArray.getValue());
 }
 
+bool ViewProviderPartExt::isBackgroundTessellation(const TopoDS_Shape& shape) const
+{
+    // callers that force an update need the final representation at once
+    if (isUpdateForced()) {
+        return false;
+    }
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part");
+    if (!hGrp->GetBool("BackgroundTessellation", true)) {
+        return false;
+    }
+
+    // small shapes are meshed faster than the placeholder is shown, count
+    // the faces only up to the limit
+    long minFaces = hGrp->GetInt("BackgroundTessellationMinFaces", 100);
+    long numFaces = 0;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More() && numFaces < minFaces; xp.Next()) {
+        numFaces++;
+    }
+    return numFaces >= minFaces;
+}
+
+void ViewProviderPartExt::showBoundingBox(double xMin, double yMin, double zMin,
+                                          double xMax, double yMax, double zMax)
+{
+    // the twelve edges of the box, corner i uses the max value of x, y and z for bit 0, 1 and 2
+    static const int32_t edges[] = {
+        0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1,
+        0, 2, -1, 1, 3, -1, 4, 6, -1, 5, 7, -1,
+        0, 4, -1, 1, 5, -1, 2, 6, -1, 3, 7, -1
+    };
+
+    coords->point.setNum(8);
+    SbVec3f* verts = coords->point.startEditing();
+    for (int i=0; i<8; i++) {
+        verts[i].setValue(float((i & 1) ? xMax : xMin),
+                          float((i & 2) ? yMax : yMin),
+                          float((i & 4) ? zMax : zMin));
+    }
+    coords->point.finishEditing();
+
+    norm    ->vector     .setNum(0);
+    faceset ->coordIndex .setNum(0);
+    faceset ->partIndex  .setNum(0);
+    lineset ->coordIndex .setNum(36);
+    lineset ->coordIndex .setValues(0, 36, edges);
+    nodeset ->startIndex .setValue(8);
+}
+
+void ViewProviderPartExt::applyTessellation(const TessellationData& data)
+{
+    int numNodes = static_cast<int>(data.points.size());
+    int numNorms = static_cast<int>(data.normals.size());
+    int numIndexes = static_cast<int>(data.faceIndex.size());
+    int numFaces = static_cast<int>(data.partIndex.size());
+    int numLines = static_cast<int>(data.lineIndex.size());
+
+    coords  ->point      .setNum(numNodes);
+    coords  ->point      .setValues(0, numNodes, data.points.data());
+    norm    ->vector     .setNum(numNorms);
+    norm    ->vector     .setValues(0, numNorms, data.normals.data());
+    faceset ->coordIndex .setNum(numIndexes);
+    faceset ->coordIndex .setValues(0, numIndexes, data.faceIndex.data());
+    faceset ->partIndex  .setNum(numFaces);
+    faceset ->partIndex  .setValues(0, numFaces, data.partIndex.data());
+    lineset ->coordIndex .setNum(numLines);
+    lineset ->coordIndex .setValues(0, numLines, data.lineIndex.data());
+    nodeset ->startIndex .setValue(data.vertexStart);
+}
+
+std::string ViewProviderPartExt::getTessellationKey(const TopoDS_Shape& shape,
+                                                    double deflection, double angle,
+                                                    bool compute)
+{
+    // the key doesn't depend on the location, so it stays valid as long as
+    // the same topology is displayed
+    if (!keyShape.IsPartner(shape) || keyShape.Orientation() != shape.Orientation()) {
+        keyShape = shape;
+        tessellationKeys.clear();
+    }
+
+    auto params = std::make_tuple(deflection, angle, NormalsFromUV);
+    auto it = tessellationKeys.find(params);
+    if (it != tessellationKeys.end()) {
+        return it->second;
+    }
+    if (!compute) {
+        return {};
+    }
+
+    std::string key = TessellationCache::instance().makeKey(shape, deflection, angle, NormalsFromUV);
+    setTessellationKey(shape, deflection, angle, key);
+    return key;
+}
+
+void ViewProviderPartExt::setTessellationKey(const TopoDS_Shape& shape,
+                                             double deflection, double angle,
+                                             const std::string& key)
+{
+    // an empty key means the cache is disabled, it may be enabled later
+    if (key.empty() || !keyShape.IsPartner(shape) || keyShape.Orientation() != shape.Orientation()) {
+        return;
+    }
+    tessellationKeys[std::make_tuple(deflection, angle, NormalsFromUV)] = key;
+}
+
+void ViewProviderPartExt::onTessellationFinished()
+{
+    // the result is outdated if the visual has been updated in the meantime
+    if (!tessellationPending) {
+        return;
+    }
+    tessellationPending = false;
+
+    TessellationResult result = tessellationWatcher.result();
+    setTessellationKey(result.shape, result.deflection, result.angle, result.key);
+    std::shared_ptr<const TessellationData> data = result.data;
+    if (!data) {
+        return;
+    }
+
+    // swap in all nodes at once
+    applyTessellation(*data);
+    resetDetailLevels(data);
+    setHighlightedFaces(ShapeAppearance.getValues());
+    setHighlightedEdges(LineColorArray.getValues());
+    setHighlightedPoints(PointColorArray.getValue());
+}
+
+void ViewProviderPartExt::resetDetailLevels(const std::shared_ptr<const TessellationData>& data)
+{
+    detailLevels.clear();
+    detailLevel = 0;
+    requestedDetailLevel = NumDetailLevels;
+    wantedDetailLevel = 0;
+    pendingDetailLevel = -1;
+
+    bool enable = false;
+    if (data) {
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath
+            ("User parameter:BaseApp/Preferences/Mod/Part");
+        long minTriangles = hGrp->GetInt("LevelOfDetailMinTriangles", 20000);
+        detailPixelError = hGrp->GetFloat("LevelOfDetailPixelError", 2.0);
+        enable = hGrp->GetBool("LevelOfDetail", true)
+            && static_cast<long>(data->faceIndex.size() / 4) >= minTriangles;
+    }
+
+    if (enable) {
+        detailLevels.resize(NumDetailLevels);
+        detailLevels[0] = data;
+    }
+    pcDetailSwitch->whichChild = enable ? 0 : SO_SWITCH_NONE;
+}
+
+void ViewProviderPartExt::setDetailLevel(int level)
+{
+    if (level < 0 || level >= static_cast<int>(detailLevels.size())) {
+        return;
+    }
+    wantedDetailLevel = level;
+    if (level == detailLevel) {
+        return;
+    }
+
+    std::shared_ptr<const TessellationData>& data = detailLevels[level];
+    if (!data) {
+        TopoDS_Shape cShape = Part::Feature::getShape(getObject());
+        if (cShape.IsNull()) {
+            return;
+        }
+
+        double scale = std::pow(DetailLevelFactor, level);
+        double deflection = detailDeflection * scale;
+        double angle = std::max(detailAngularDeflection, std::min(detailAngularDeflection * scale, M_PI_2));
+
+        std::string key = getTessellationKey(cShape, deflection, angle, false);
+        data = TessellationCache::instance().find(key);
+        if (!data) {
+            // keep showing the current level until the worker thread has
+            // meshed this one, then switch to the level wanted at that time
+            if (pendingDetailLevel < 0) {
+                TopoDS_Shape copy;
+                try {
+                    copy = BRepBuilderAPI_Copy(cShape, Standard_False).Shape();
+                }
+                catch (const Standard_Failure& e) {
+                    FC_ERR("Cannot compute level of detail for the shape of "
+                           << pcObject->getFullName() << ": " << e.GetMessageString());
+                    detailLevels.resize(level);
+                    if (detailLevel >= level) {
+                        setDetailLevel(0);
+                    }
+                    return;
+                }
+                pendingDetailLevel = level;
+                bool normalsFromUV = NormalsFromUV;
+                auto lambda = [cShape, copy, key, deflection, angle, normalsFromUV]() {
+                    return tessellateInBackground(cShape, copy, key, deflection, angle,
+                                                  normalsFromUV);
+                };
+                detailWatcher.setFuture(QtConcurrent::run(std::move(lambda)));
+            }
+            return;
+        }
+    }
+
+    detailLevel = level;
+    applyTessellation(*data);
+    setHighlightedFaces(ShapeAppearance.getValues());
+    setHighlightedEdges(LineColorArray.getValues());
+    setHighlightedPoints(PointColorArray.getValue());
+}
+
+void ViewProviderPartExt::onDetailLevelFinished()
+{
+    // the result is outdated if the levels have been reset in the meantime
+    int level = pendingDetailLevel;
+    if (level < 0) {
+        return;
+    }
+    pendingDetailLevel = -1;
+
+    TessellationResult result = detailWatcher.result();
+    setTessellationKey(result.shape, result.deflection, result.angle, result.key);
+    if (!result.data) {
+        FC_ERR("Cannot compute level of detail for the shape of " << pcObject->getFullName());
+        // don't try this and coarser levels again
+        detailLevels.resize(level);
+        if (detailLevel >= level) {
+            setDetailLevel(0);
+        }
+        return;
+    }
+
+    detailLevels[level] = result.data;
+    setDetailLevel(wantedDetailLevel);
+}
+
+void ViewProviderPartExt::detailLevelCallback(void* data, SoAction* action)
+{
+    if (!action->isOfType(SoGLRenderAction::getClassTypeId())) {
+        return;
+    }
+
+    auto self = static_cast<ViewProviderPartExt*>(data);
+    if (self->detailLevels.empty() || self->tessellationPending) {
+        return;
+    }
+
+    // size of a pixel in world units at the center of the shape
+    SoState* state = action->getState();
+    const SbViewVolume& vv = SoViewVolumeElement::get(state);
+    const SbViewportRegion& vp = SoViewportRegionElement::get(state);
+    // the model matrix contains the placement, the center is in the coordinates of the nodes
+    SbVec3f center;
+    SoModelMatrixElement::get(state).multVecMatrix(self->detailCenter, center);
+    SbVec2s size = vp.getViewportSizePixels();
+    float pixelSize = vv.getWorldToScreenScale(center, 1.0F) / std::max<short>(size[1], 1);
+
+    // use the coarsest level whose deviation is not visible on screen
+    int level = 0;
+    double deflection = self->detailDeflection * DetailLevelFactor;
+    while (level + 1 < static_cast<int>(self->detailLevels.size())
+           && deflection <= self->detailPixelError * pixelSize) {
+        deflection *= DetailLevelFactor;
+        level++;
+    }
+
+    // with several views the finest requested level wins
+    self->requestedDetailLevel = std::min(self->requestedDetailLevel, level);
+    if (self->requestedDetailLevel != self->detailLevel) {
+        // the scene must not be modified while it is rendered
+        self->detailSensor->schedule();
+    }
+}
+
+void ViewProviderPartExt::detailLevelSensorCB(void* data, SoSensor* /*sensor*/)
+{
+    auto self = static_cast<ViewProviderPartExt*>(data);
+    int level = self->requestedDetailLevel;
+    self->requestedDetailLevel = NumDetailLevels;
+    self->setDetailLevel(level);
+}
+
+void ViewProviderPartExt::finishTessellation()
+{
+    if (tessellationPending) {
+        tessellationWatcher.waitForFinished();
+        onTessellationFinished();
+    }
+}
+
 void ViewProviderPartExt::forceUpdate(bool enable) {
     if(enable) {
         if(++forceUpdateCount == 1) {
             if(!isShow() && VisualTouched)
                 updateVisual();
+            finishTessellation();
+            setDetailLevel(0);
         }
     }else if(forceUpdateCount)
         --forceUpdateCount;
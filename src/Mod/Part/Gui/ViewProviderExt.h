@@ -24,6 +24,12 @@
 #define PARTGUI_VIEWPROVIDERPARTEXT_H
 
 #include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <QFutureWatcher>
+#include <Inventor/SbVec3f.h>
 
 #include <App/PropertyUnits.h>
 #include <Gui/ViewProviderGeometryObject.h>
@@ -40,6 +46,9 @@ class TopoDS_Face;
 class SoSeparator;
 class SoGroup;
 class SoSwitch;
+class SoAction;
+class SoSensor;
+class SoOneShotSensor;
 class SoVertexShape;
 class SoPickedPoint;
 class SoShapeHints;
@@ -59,6 +68,17 @@ namespace PartGui {
 class SoBrepFaceSet;
 class SoBrepEdgeSet;
 class SoBrepPointSet;
+struct TessellationData;
+
+/// tessellation of a shape that is computed in a worker thread
+struct TessellationResult
+{
+    TopoDS_Shape shape;
+    double deflection = 0.0;
+    double angle = 0.0;
+    std::string key;
+    std::shared_ptr<const TessellationData> data;
+};
 
 class PartGuiExport ViewProviderPartExt : public Gui::ViewProviderGeometryObject
 {
@@ -163,6 +183,8 @@ protected:
     void onChanged(const App::Property* prop) override;
     bool loadParameter();
     void updateVisual();
+    /// wait for a tessellation running in the background and show it
+    void finishTessellation();
     void handleChangedPropertyName(Base::XMLReader& reader,
                                    const char* TypeName,
                                    const char* PropName) override;
@@ -187,6 +209,22 @@ protected:
     bool VisualTouched;
     bool NormalsFromUV;
 
+private:
+    bool isBackgroundTessellation(const TopoDS_Shape& shape) const;
+    void showBoundingBox(double xMin, double yMin, double zMin,
+                         double xMax, double yMax, double zMax);
+    void applyTessellation(const TessellationData& data);
+    std::string getTessellationKey(const TopoDS_Shape& shape, double deflection, double angle,
+                                   bool compute = true);
+    void setTessellationKey(const TopoDS_Shape& shape, double deflection, double angle,
+                            const std::string& key);
+    void onTessellationFinished();
+    void resetDetailLevels(const std::shared_ptr<const TessellationData>& data);
+    void setDetailLevel(int level);
+    void onDetailLevelFinished();
+    static void detailLevelCallback(void* data, SoAction* action);
+    static void detailLevelSensorCB(void* data, SoSensor* sensor);
+
 private:
     Gui::ViewProviderFaceTexture texture;
     // settings stuff
@@ -200,6 +238,30 @@ private:
     // This is needed to restore old DiffuseColor values since the restore
     // function is asynchronous
     App::PropertyColorList _diffuseColor;
+
+    // meshing of big shapes in a worker thread
+    QFutureWatcher<TessellationResult> tessellationWatcher;
+    bool tessellationPending = false;
+    // tessellation cache keys of the displayed shape, hashing it is expensive
+    TopoDS_Shape keyShape;
+    std::map<std::tuple<double, double, bool>, std::string> tessellationKeys;
+
+    // Level of detail: index 0 is the tessellation with the full accuracy, each
+    // further level is coarser and created when the shape gets small on screen.
+    std::vector<std::shared_ptr<const TessellationData>> detailLevels;
+    SoSwitch* pcDetailSwitch;
+    SoOneShotSensor* detailSensor;
+    // center of the unplaced shape, the model matrix of the scene adds the placement
+    SbVec3f detailCenter;
+    double detailDeflection = 0.0;
+    double detailAngularDeflection = 0.0;
+    double detailPixelError = 2.0;
+    int detailLevel = 0;
+    int requestedDetailLevel = 0;
+    // coarse levels are meshed in a worker thread
+    QFutureWatcher<TessellationResult> detailWatcher;
+    int wantedDetailLevel = 0;
+    int pendingDetailLevel = -1;
 };
 
 }
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <Bnd_Box.hxx>
+#include <Bnd_OBB.hxx>
 #include <BRep_Builder.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
@@ -33,7 +34,10 @@
 #include <TopExp_Explorer.hxx>
 #endif
 
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <optional>
 
 #include <App/Application.h>
 #include <Base/Console.h>
@@ -53,8 +57,30 @@
 #include "Mod/Part/App/TopoShapeOpCode.h"
 
 
+FC_LOG_LEVEL_INIT("PartDesign", true, true)
+
 using namespace PartDesign;
 
+namespace
+{
+Bnd_Box getBoundBox(const TopoShape& shape)
+{
+    Bnd_Box box;
+    BRepBndLib::Add(shape.getShape(), box);
+    return box;
+}
+
+Bnd_OBB getOrientedBoundBox(const TopoShape& shape)
+{
+    // Don't use the triangulation as its nodes don't enclose curved faces
+    Bnd_OBB box;
+    BRepBndLib::AddOBB(shape.getShape(), box, Standard_False, Standard_True, Standard_True);
+    box.Enlarge(Precision::Confusion());
+    return box;
+}
+
+}  // namespace
+
 namespace PartDesign
 {
 
@@ -297,6 +323,43 @@ App::DocumentObjectExecReturn* Transformed::execute()
         return shapes;
     };
 
+    // All instances of an original are processed by a single multi-tool boolean. If that fails,
+    // e.g. because of coincident faces of overlapping instances, the instances are split into
+    // batches of disjoint tools that are applied one after another.
+    auto applyBoolean = [&](const char* maker, std::vector<TopoShape> shapes) {
+        if (strcmp(maker, Part::OpCodes::Cut) == 0) {
+            removeDisjointTools(shapes);
+        }
+        if (shapes.size() < 2) {
+            return;
+        }
+
+        FC_TIME_INIT(t);
+        std::size_t batches = 0;
+        try {
+            supportShape.makeElementBoolean(maker, shapes);
+            FC_TIME_LOG(t, getFullName() << " " << maker << " of " << shapes.size() - 1 << " tools");
+            return;
+        }
+        catch (const Standard_Failure&) {
+            batches = makeBatchedBoolean(supportShape, maker, shapes);
+            if (batches == 0) {
+                throw;
+            }
+        }
+        catch (const Base::Exception&) {
+            batches = makeBatchedBoolean(supportShape, maker, shapes);
+            if (batches == 0) {
+                throw;
+            }
+        }
+
+        FC_WARN(getFullName() << ": " << maker << " of all pattern instances failed, retried in "
+                              << batches << " batches");
+        FC_TIME_LOG(t, getFullName() << " " << maker << " of " << shapes.size() - 1 << " tools in "
+                                     << batches << " batches");
+    };
+
     switch (mode) {
         case Mode::TransformToolShapes:
             // NOTE: It would be possible to build a compound from all original addShapes/subShapes
@@ -331,15 +394,17 @@ App::DocumentObjectExecReturn* Transformed::execute()
                     cutShape = cutShape.makeElementTransform(trsf);
                 }
                 if (!fuseShape.isNull()) {
-                    supportShape.makeElementFuse(getTransformedCompShape(supportShape, fuseShape));
+                    applyBoolean(Part::OpCodes::Fuse,
+                                 getTransformedCompShape(supportShape, fuseShape));
                 }
                 if (!cutShape.isNull()) {
-                    supportShape.makeElementCut(getTransformedCompShape(supportShape, cutShape));
+                    applyBoolean(Part::OpCodes::Cut,
+                                 getTransformedCompShape(supportShape, cutShape));
                 }
             }
             break;
         case Mode::TransformBody: {
-            supportShape.makeElementFuse(getTransformedCompShape(supportShape, supportShape));
+            applyBoolean(Part::OpCodes::Fuse, getTransformedCompShape(supportShape, supportShape));
             break;
         }
     }
@@ -384,4 +449,72 @@ TopoDS_Shape Transformed::getRemainingSolids(const TopoDS_Shape& shape)
     return {std::move(compShape)};
 }
 
+void Transformed::removeDisjointTools(std::vector<TopoShape>& shapes)
+{
+    if (shapes.size() < 2) {
+        return;
+    }
+
+    // The axis aligned boxes are checked first, the oriented boxes only for the remaining
+    // tools, which matters for rotated supports and polar patterns
+    const TopoShape& support = shapes.front();
+    Bnd_Box supportBox = getBoundBox(support);
+    std::optional<Bnd_OBB> supportOBB;
+    auto isOut = [&](const TopoShape& tool) {
+        if (getBoundBox(tool).IsOut(supportBox)) {
+            return true;
+        }
+        if (!supportOBB) {
+            supportOBB = getOrientedBoundBox(support);
+        }
+        return getOrientedBoundBox(tool).IsOut(*supportOBB) == Standard_True;
+    };
+    shapes.erase(std::remove_if(shapes.begin() + 1, shapes.end(), isOut), shapes.end());
+}
+
+std::vector<std::vector<TopoShape>>
+Transformed::splitDisjointBatches(const std::vector<TopoShape>& shapes)
+{
+    // The members of a batch only intersect the support, which is the easiest case for a
+    // multi-tool boolean
+    std::vector<std::vector<TopoShape>> batches;
+    std::vector<std::vector<Bnd_Box>> boxes;
+    for (auto it = shapes.begin() + 1; it != shapes.end(); ++it) {
+        Bnd_Box box = getBoundBox(*it);
+        std::size_t index = 0;
+        for (; index < boxes.size(); ++index) {
+            const auto& batchBoxes = boxes[index];
+            if (std::all_of(batchBoxes.begin(), batchBoxes.end(), [&box](const Bnd_Box& other) {
+                    return box.IsOut(other);
+                })) {
+                break;
+            }
+        }
+        if (index == boxes.size()) {
+            batches.emplace_back();
+            boxes.emplace_back();
+        }
+        batches[index].push_back(*it);
+        boxes[index].push_back(box);
+    }
+    return batches;
+}
+
+std::size_t Transformed::makeBatchedBoolean(TopoShape& result,
+                                            const char* maker,
+                                            const std::vector<TopoShape>& shapes)
+{
+    auto batches = splitDisjointBatches(shapes);
+    if (batches.size() < 2) {
+        return 0;
+    }
+
+    result = shapes.front();
+    for (auto& batch : batches) {
+        batch.insert(batch.begin(), result);
+        result.makeElementBoolean(maker, batch);
+    }
+    return batches.size();
+}
+
 }  // namespace PartDesign
@@ -24,6 +24,7 @@
 #ifndef PARTDESIGN_FeatureTransformed_H
 #define PARTDESIGN_FeatureTransformed_H
 
+#include <vector>
 #include <gp_Trsf.hxx>
 
 #include <App/PropertyStandard.h>
@@ -110,6 +111,22 @@ protected:
     TopoDS_Shape refineShapeIfActive(const TopoDS_Shape&) const;
     static TopoDS_Shape getRemainingSolids(const TopoDS_Shape&);
 
+    /** Removes the tool shapes that cannot intersect the support shapes.front()
+     * For a cut they don't change the result but would still be processed by the boolean.
+     */
+    static void removeDisjointTools(std::vector<TopoShape>& shapes);
+    /** Splits the tool shapes, i.e. all but shapes.front(), into batches whose members
+     * don't overlap each other
+     */
+    static std::vector<std::vector<TopoShape>>
+    splitDisjointBatches(const std::vector<TopoShape>& shapes);
+    /** Applies the boolean \a maker of the support shapes.front() and the tool shapes
+     * to \a result, one batch of disjoint tools after another. Returns the number of
+     * batches, or 0 without touching \a result if the tools can't be split.
+     */
+    static std::size_t
+    makeBatchedBoolean(TopoShape& result, const char* maker, const std::vector<TopoShape>& shapes);
+
 private:
 };
 
@@ -19,6 +19,7 @@
 #*                                                                         *
 #***************************************************************************
 
+import math
 import unittest
 
 import FreeCAD
@@ -167,6 +168,49 @@ class TestLinearPattern(unittest.TestCase):
         # self.assertEqual(len(self.LinearPattern.Shape.ElementReverseMap), 170)
         self.assertEqual(self.LinearPattern.Shape.ElementMapSize, 26)
 
+    def makePerforatedPlate(self, columns):
+        self.Body = self.Doc.addObject('PartDesign::Body','Body')
+        self.Box = self.Doc.addObject('PartDesign::AdditiveBox','Box')
+        self.Body.addObject(self.Box)
+        self.Box.Length = 100.0
+        self.Box.Width = 100.0
+        self.Box.Height = 5.0
+        self.Cylinder = self.Doc.addObject('PartDesign::SubtractiveCylinder','Cylinder')
+        self.Body.addObject(self.Cylinder)
+        self.Cylinder.Radius = 2.0
+        self.Cylinder.Height = 5.0
+        self.Cylinder.Placement.Base = FreeCAD.Vector(5, 5, 0)
+        self.Doc.recompute()
+        self.MultiTransform = self.Doc.addObject("PartDesign::MultiTransform","MultiTransform")
+        self.MultiTransform.Originals = [self.Cylinder]
+        self.Body.addObject(self.MultiTransform)
+        self.LinearPattern = self.Doc.addObject("PartDesign::LinearPattern","LinearPattern")
+        self.LinearPattern.Direction = (self.Doc.X_Axis,[""])
+        self.LinearPattern.Length = 10.0 * (columns - 1)
+        self.LinearPattern.Occurrences = columns
+        self.Body.addObject(self.LinearPattern)
+        self.LinearPattern2 = self.Doc.addObject("PartDesign::LinearPattern","LinearPattern2")
+        self.LinearPattern2.Direction = (self.Doc.Y_Axis,[""])
+        self.LinearPattern2.Length = 90.0
+        self.LinearPattern2.Occurrences = 10
+        self.Body.addObject(self.LinearPattern2)
+        self.MultiTransform.Transformations = [self.LinearPattern, self.LinearPattern2]
+        self.Doc.recompute()
+
+    def testPerforatedPlateLinearPattern(self):
+        # All 100 holes are cut by a single multi-tool boolean
+        self.makePerforatedPlate(10)
+        self.assertTrue(self.MultiTransform.Shape.isValid())
+        self.assertEqual(len(self.MultiTransform.Shape.Solids), 1)
+        self.assertAlmostEqual(self.MultiTransform.Shape.Volume, 5e4 - 100 * math.pi * 20, delta=0.01)
+
+    def testPerforatedPlateOutsideInstances(self):
+        # The holes beyond the plate are filtered out before the boolean
+        self.makePerforatedPlate(20)
+        self.assertTrue(self.MultiTransform.Shape.isValid())
+        self.assertEqual(len(self.MultiTransform.Shape.Solids), 1)
+        self.assertAlmostEqual(self.MultiTransform.Shape.Volume, 5e4 - 100 * math.pi * 20, delta=0.01)
+
     def tearDown(self):
         #closing doc
         FreeCAD.closeDocument("PartDesignTestLinearPattern")
@@ -0,0 +1,204 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <memory>
+#if defined(FC_OS_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#endif
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+
+#include "PointStore.h"
+
+
+using namespace Points;
+
+namespace
+{
+constexpr std::size_t chunkBytes = PointStore::ChunkSize * sizeof(PointStore::value_type);
+}
+
+#if defined(FC_OS_WIN32)
+PointStore::PointStore(const std::string& directory)
+    : _directory(directory)
+{
+    Base::FileInfo fi(
+        Base::FileInfo::getTempFileName("PointStore", directory.empty() ? nullptr : directory.c_str()));
+    HANDLE file = CreateFileW(fi.toStdWString().c_str(),
+                              GENERIC_READ | GENERIC_WRITE,
+                              0,
+                              nullptr,
+                              CREATE_NEW,
+                              FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw Base::FileException("Cannot create point storage", fi);
+    }
+    _file = file;
+}
+
+PointStore::~PointStore()
+{
+    for (value_type* data : _chunks) {
+        UnmapViewOfFile(data);
+    }
+    // the file is deleted on closing
+    CloseHandle(_file);
+}
+
+void PointStore::addChunk()
+{
+    ULONGLONG offset = ULONGLONG(_chunks.size()) * chunkBytes;
+    ULONGLONG end = offset + chunkBytes;
+    // the file grows with the size of the mapping
+    HANDLE mapping = CreateFileMappingW(_file,
+                                        nullptr,
+                                        PAGE_READWRITE,
+                                        DWORD(end >> 32),
+                                        DWORD(end & 0xFFFFFFFF),
+                                        nullptr);
+    if (!mapping) {
+        throw Base::FileException("Cannot extend point storage");
+    }
+
+    void* data = MapViewOfFile(mapping,
+                               FILE_MAP_WRITE,
+                               DWORD(offset >> 32),
+                               DWORD(offset & 0xFFFFFFFF),
+                               chunkBytes);
+    // the view keeps a reference to the mapping
+    CloseHandle(mapping);
+    if (!data) {
+        throw Base::FileException("Cannot map point storage");
+    }
+    _chunks.push_back(static_cast<value_type*>(data));
+}
+
+void PointStore::removeChunks(size_type num)
+{
+    for (; num > 0 && !_chunks.empty(); num--) {
+        UnmapViewOfFile(_chunks.back());
+        _chunks.pop_back();
+    }
+}
+#else
+PointStore::PointStore(const std::string& directory)
+    : _directory(directory)
+{
+    std::string path =
+        Base::FileInfo::getTempFileName("PointStore", directory.empty() ? nullptr : directory.c_str());
+    _file = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (_file < 0) {
+        throw Base::FileException("Cannot create point storage", path.c_str());
+    }
+    // the file is removed as soon as it's closed
+    ::unlink(path.c_str());
+}
+
+PointStore::~PointStore()
+{
+    for (value_type* data : _chunks) {
+        munmap(data, chunkBytes);
+    }
+    ::close(_file);
+}
+
+void PointStore::addChunk()
+{
+    off_t offset = off_t(_chunks.size()) * off_t(chunkBytes);
+    if (ftruncate(_file, offset + off_t(chunkBytes)) != 0) {
+        throw Base::FileException("Cannot extend point storage");
+    }
+
+    void* data = mmap(nullptr, chunkBytes, PROT_READ | PROT_WRITE, MAP_SHARED, _file, offset);
+    if (data == MAP_FAILED) {
+        throw Base::FileException("Cannot map point storage");
+    }
+    _chunks.push_back(static_cast<value_type*>(data));
+}
+
+void PointStore::removeChunks(size_type num)
+{
+    for (; num > 0 && !_chunks.empty(); num--) {
+        munmap(_chunks.back(), chunkBytes);
+        _chunks.pop_back();
+    }
+    // give the disk space back, the remaining chunks stay valid anyway
+    int ret = ftruncate(_file, off_t(_chunks.size()) * off_t(chunkBytes));
+    (void)ret;
+}
+#endif
+
+std::unique_ptr<PointStore> PointStore::clone() const
+{
+    auto copy = std::make_unique<PointStore>(_directory);
+    for (size_type i = 0; i < countChunks(); i++) {
+        copy->append(chunk(i), chunkLength(i));
+    }
+    return copy;
+}
+
+void PointStore::resize(size_type num)
+{
+    size_type needed = (num + ChunkSize - 1) / ChunkSize;
+    if (needed < _chunks.size()) {
+        removeChunks(_chunks.size() - needed);
+    }
+    while (_chunks.size() < needed) {
+        addChunk();
+    }
+
+    // the chunks may still hold points that were removed before
+    for (size_type i = _size; i < num;) {
+        size_type pos = i % ChunkSize;
+        size_type len = std::min(ChunkSize - pos, num - i);
+        std::fill_n(_chunks[i / ChunkSize] + pos, len, value_type());
+        i += len;
+    }
+    _size = num;
+}
+
+void PointStore::append(const value_type* pnts, size_type num)
+{
+    while (num > 0) {
+        if (_size == _chunks.size() * ChunkSize) {
+            addChunk();
+        }
+        size_type pos = _size % ChunkSize;
+        size_type len = std::min(ChunkSize - pos, num);
+        std::copy_n(pnts, len, _chunks[_size / ChunkSize] + pos);
+        _size += len;
+        pnts += len;
+        num -= len;
+    }
+}
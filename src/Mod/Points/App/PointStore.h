@@ -0,0 +1,146 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef POINTS_POINTSTORE_H
+#define POINTS_POINTSTORE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <FCConfig.h>
+
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+
+/** Chunked point storage in a memory-mapped temporary file
+ *
+ * The points are kept in chunks of a fixed size, each of them mapped separately
+ * from a temporary file. Appending points never moves the existing ones and the
+ * operating system can write unused chunks back to disk, so a point cloud can be
+ * larger than the main memory. The temporary file is removed when the storage is
+ * destroyed.
+ */
+class PointsExport PointStore
+{
+public:
+    using value_type = Base::Vector3f;
+    using size_type = std::size_t;
+
+    /// number of points per chunk, this is 12 MB
+    static constexpr size_type ChunkSize = size_type(1) << 20;
+
+    /** Creates an empty storage with its temporary file in \a directory or in
+     * the system's temporary directory if it's empty.
+     * Throws a Base::FileException if the file cannot be created.
+     */
+    explicit PointStore(const std::string& directory = {});
+    ~PointStore();
+
+    /// returns a copy of the storage in a new temporary file
+    std::unique_ptr<PointStore> clone() const;
+
+    size_type size() const
+    {
+        return _size;
+    }
+    bool empty() const
+    {
+        return _size == 0;
+    }
+    /// returns the size of the temporary file
+    std::size_t fileSize() const
+    {
+        return _chunks.size() * ChunkSize * sizeof(value_type);
+    }
+    /// the existing points are kept, new ones are set to zero
+    void resize(size_type num);
+    void push_back(const value_type& pnt)
+    {
+        if (_size == _chunks.size() * ChunkSize) {
+            addChunk();
+        }
+        _chunks[_size / ChunkSize][_size % ChunkSize] = pnt;
+        ++_size;
+    }
+    void append(const value_type* pnts, size_type num);
+
+    value_type& operator[](size_type index)
+    {
+        return _chunks[index / ChunkSize][index % ChunkSize];
+    }
+    const value_type& operator[](size_type index) const
+    {
+        return _chunks[index / ChunkSize][index % ChunkSize];
+    }
+
+    /** @name Chunks */
+    //@{
+    size_type countChunks() const
+    {
+        return (_size + ChunkSize - 1) / ChunkSize;
+    }
+    value_type* chunk(size_type index)
+    {
+        return _chunks[index];
+    }
+    const value_type* chunk(size_type index) const
+    {
+        return _chunks[index];
+    }
+    /// number of used points in the chunk
+    size_type chunkLength(size_type index) const
+    {
+        return std::min(ChunkSize, _size - index * ChunkSize);
+    }
+    //@}
+
+    PointStore(const PointStore&) = delete;
+    PointStore(PointStore&&) = delete;
+    PointStore& operator=(const PointStore&) = delete;
+    PointStore& operator=(PointStore&&) = delete;
+
+private:
+    void addChunk();
+    void removeChunks(size_type num);
+
+private:
+    std::string _directory;
+    std::vector<value_type*> _chunks;
+    size_type _size = 0;
+#ifdef FC_OS_WIN32
+    void* _file = nullptr;
+#else
+    int _file = -1;
+#endif
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_POINTSTORE_H
@@ -26,10 +26,16 @@
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <cmath>
 #include <iostream>
+#include <utility>
 #endif
 
+#include <App/Application.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
 #include <Base/Matrix.h>
+#include <Base/Parameter.h>
 #include <Base/Stream.h>
+#include <Base/Swap.h>
 #include <Base/Writer.h>
 
 #include "Points.h"
@@ -45,14 +51,53 @@ using namespace std;
 
 TYPESYSTEM_SOURCE(Points::PointKernel, Data::ComplexGeoData)
 
+namespace
+{
+ParameterGrp::handle getOutOfCoreParameter()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Points/OutOfCore");
+}
+
+std::shared_ptr<PointStore> makeStore()
+{
+    std::string dir = getOutOfCoreParameter()->GetASCII("Directory", "");
+    if (dir.empty()) {
+        // the system's temporary directory may be kept in memory
+        dir = App::Application::getUserCachePath() + "Points";
+    }
+    Base::FileInfo fi(dir);
+    if (!fi.exists()) {
+        fi.createDirectories();
+    }
+    return std::make_shared<PointStore>(dir);
+}
+
+template<typename Func>
+void forEachParallel(PointKernel::value_type* first, PointKernel::value_type* last, Func&& func)
+{
+#ifdef _MSC_VER
+    // Win32-only at the moment since ppl.h is a Microsoft library. Points is not using Qt so we
+    // cannot use QtConcurrent We could also rewrite Points to leverage SIMD instructions Other
+    // option: openMP. But with VC2013 results in high CPU usage even after computation (busy-waits
+    // for >100ms)
+    Concurrency::parallel_for_each(first, last, func);
+#else
+    QtConcurrent::blockingMap(first, last, func);
+#endif
+}
+}  // namespace
+
 PointKernel::PointKernel(const PointKernel& pts)
     : _Mtrx(pts._Mtrx)
     , _Points(pts._Points)
+    , _Store(pts._Store)
 {}
 
 PointKernel::PointKernel(PointKernel&& pts) noexcept
     : _Mtrx(pts._Mtrx)
     , _Points(std::move(pts._Points))
+    , _Store(std::move(pts._Store))
 {}
 
 std::vector<const char*> PointKernel::getElementTypes() const
@@ -83,20 +128,12 @@ Data::Segment* PointKernel::getSubElement(const char* /*Type*/, unsigned long /*
 
 void PointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
-    std::vector<value_type>& kernel = getBasicPoints();
-#ifdef _MSC_VER
-    // Win32-only at the moment since ppl.h is a Microsoft library. Points is not using Qt so we
-    // cannot use QtConcurrent We could also rewrite Points to leverage SIMD instructions Other
-    // option: openMP. But with VC2013 results in high CPU usage even after computation (busy-waits
-    // for >100ms)
-    Concurrency::parallel_for_each(kernel.begin(), kernel.end(), [rclMat](value_type& value) {
-        value = rclMat * value;
-    });
-#else
-    QtConcurrent::blockingMap(kernel, [rclMat](value_type& value) {
-        rclMat.multVec(value, value);
+    // an out-of-core kernel is transformed chunk by chunk
+    forEachRange([&rclMat](value_type* pnts, size_type num) {
+        forEachParallel(pnts, pnts + num, [rclMat](value_type& value) {
+            rclMat.multVec(value, value);
+        });
     });
-#endif
 }
 
 Base::BoundBox3d PointKernel::getBoundBox() const
@@ -108,12 +145,12 @@ Base::BoundBox3d PointKernel::getBoundBox() const
     Concurrency::combinable<Base::BoundBox3d> bbs;
     // Cannot use a const_point_iterator here as it is *not* a proper iterator (fails the for_each
     // template)
-    Concurrency::parallel_for_each(_Points.begin(),
-                                   _Points.end(),
-                                   [this, &bbs](const value_type& value) {
-                                       Base::Vector3d vertd(value.x, value.y, value.z);
-                                       bbs.local().Add(this->_Mtrx * vertd);
-                                   });
+    forEachRange([this, &bbs](const value_type* pnts, size_type num) {
+        Concurrency::parallel_for_each(pnts, pnts + num, [this, &bbs](const value_type& value) {
+            Base::Vector3d vertd(value.x, value.y, value.z);
+            bbs.local().Add(this->_Mtrx * vertd);
+        });
+    });
     // Combine each thread-local bounding box in the final bounding box
     bbs.combine_each([&bnd](const Base::BoundBox3d& lbb) {
         bnd.Add(lbb);
@@ -132,6 +169,7 @@ PointKernel& PointKernel::operator=(const PointKernel& Kernel)
         // copy the mesh structure
         setTransform(Kernel._Mtrx);
         this->_Points = Kernel._Points;
+        this->_Store = Kernel._Store;
     }
 
     return *this;
@@ -143,6 +181,7 @@ PointKernel& PointKernel::operator=(PointKernel&& Kernel) noexcept
         // copy the mesh structure
         setTransform(Kernel._Mtrx);
         this->_Points = std::move(Kernel._Points);
+        this->_Store = std::move(Kernel._Store);
     }
 
     return *this;
@@ -150,9 +189,108 @@ PointKernel& PointKernel::operator=(PointKernel&& Kernel) noexcept
 
 unsigned int PointKernel::getMemSize() const
 {
+    // the points of an out-of-core kernel are not held in memory
     return _Points.size() * sizeof(value_type);
 }
 
+void PointKernel::resize(size_type n)
+{
+    if (_Store) {
+        detach();
+        _Store->resize(n);
+    }
+    else {
+        _Points.resize(n);
+    }
+}
+
+void PointKernel::erase(size_type first, size_type last)
+{
+    if (_Store) {
+        detach();
+        size_type num = size();
+        for (size_type i = last; i < num; i++) {
+            (*_Store)[first + i - last] = (*_Store)[i];
+        }
+        _Store->resize(num - (last - first));
+    }
+    else {
+        _Points.erase(_Points.begin() + first, _Points.begin() + last);
+    }
+}
+
+void PointKernel::clear()
+{
+    if (_Store && _Store.use_count() == 1) {
+        _Store->resize(0);
+    }
+    else if (_Store) {
+        _Store = makeStore();
+    }
+    _Points.clear();
+}
+
+void PointKernel::setOutOfCore(bool on)
+{
+    if (!on) {
+        loadIntoMemory();
+    }
+    else if (!_Store) {
+        auto store = makeStore();
+        store->append(_Points.data(), _Points.size());
+        std::vector<value_type>().swap(_Points);
+        _Store = store;
+    }
+}
+
+bool PointKernel::exceedsMemoryLimit(size_type num)
+{
+    // in MB, zero disables the out-of-core storage
+    long limit = getOutOfCoreParameter()->GetInt("MemoryLimit", 4096);
+    return limit > 0 && num * sizeof(value_type) > static_cast<size_type>(limit) * 1024 * 1024;
+}
+
+void PointKernel::detach()
+{
+    if (_Store && _Store.use_count() > 1) {
+        _Store = _Store->clone();
+    }
+}
+
+const std::vector<PointKernel::value_type>& PointKernel::getBasicPoints() const
+{
+    if (_Store) {
+        throw Base::RuntimeError("Points of an out-of-core kernel are not in memory");
+    }
+    return this->_Points;
+}
+
+void PointKernel::moveIntoMemory()
+{
+    std::vector<value_type> points;
+    points.reserve(_Store->size());
+    // read the shared chunks without making a private copy first
+    std::as_const(*this).forEachRange([&points](const value_type* pnts, size_type num) {
+        points.insert(points.end(), pnts, pnts + num);
+    });
+    _Points.swap(points);
+    _Store.reset();
+}
+
+void PointKernel::decimate(size_type step)
+{
+    if (step < 2) {
+        return;
+    }
+
+    detach();
+    size_type num = (size() + step - 1) / step;
+    for (size_type i = 1; i < num; i++) {
+        basicPoint(i) = basicPoint(i * step);
+    }
+    resize(num);
+}
+
 PointKernel::size_type PointKernel::countValid() const
 {
     size_type num = 0;
@@ -187,15 +325,34 @@ void PointKernel::Save(Base::Writer& writer) const
     }
 }
 
+namespace
+{
+// header of the compact format, the old format starts with the number of points
+constexpr uint32_t compactMagic = 0xB0C0D0E0;
+constexpr uint32_t compactVersion = 0x010000;
+}  // namespace
+
 void PointKernel::SaveDocFile(Base::Writer& writer) const
 {
     Base::OutputStream str(writer.Stream());
     uint32_t uCt = (uint32_t)size();
+    if (writer.getMode("BinaryMesh")) {
+        static_assert(sizeof(value_type) == 3 * sizeof(float_type),
+                      "points must be stored contiguously");
+        str << compactMagic << compactVersion << uCt;
+        forEachRange([&str](const value_type* pnts, size_type num) {
+            str.write(&pnts[0].x, 3 * num);
+        });
+        return;
+    }
+
     str << uCt;
     // store the data without transforming it
-    for (const auto& pnt : _Points) {
-        str << pnt.x << pnt.y << pnt.z;
-    }
+    forEachRange([&str](const value_type* pnts, size_type num) {
+        for (size_type i = 0; i < num; i++) {
+            str << pnts[i].x << pnts[i].y << pnts[i].z;
+        }
+    });
 }
 
 void PointKernel::Restore(Base::XMLReader& reader)
@@ -220,13 +377,46 @@ void PointKernel::RestoreDocFile(Base::Reader& reader)
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
-    _Points.resize(uCt);
+
+    // big clouds are read directly into the out-of-core storage
+    auto prepare = [this](uint32_t num) {
+        _Store.reset();
+        std::vector<value_type>().swap(_Points);
+        if (exceedsMemoryLimit(num)) {
+            setOutOfCore(true);
+        }
+        resize(num);
+    };
+
+    uint32_t swapMagic = uCt;
+    Base::SwapEndian(swapMagic);
+    if (uCt == compactMagic || swapMagic == compactMagic) {
+        if (swapMagic == compactMagic) {
+            str.setByteOrder(Base::Stream::BigEndian);
+        }
+        uint32_t version = 0;
+        str >> version >> uCt;
+        if (version != compactVersion) {
+            throw Base::BadFormatError("Unsupported version of point data");
+        }
+        prepare(uCt);
+        forEachRange([&str](value_type* pnts, size_type num) {
+            str.read(&pnts[0].x, 3 * num);
+        });
+        if (!str) {
+            clear();
+            throw Base::BadFormatError("Reading from stream failed");
+        }
+        return;
+    }
+
+    prepare(uCt);
     for (unsigned long i = 0; i < uCt; i++) {
         float x {};
         float y {};
         float z {};
         str >> x >> y >> z;
-        _Points[i].Set(x, y, z);
+        basicPoint(i).Set(x, y, z);
     }
 }
 
@@ -244,9 +434,11 @@ void PointKernel::load(const char* file)
 void PointKernel::save(std::ostream& out) const
 {
     out << "# ASCII" << std::endl;
-    for (const auto& pnt : _Points) {
-        out << pnt.x << " " << pnt.y << " " << pnt.z << std::endl;
-    }
+    forEachRange([&out](const value_type* pnts, size_type num) {
+        for (size_type i = 0; i < num; i++) {
+            out << pnts[i].x << " " << pnts[i].y << " " << pnts[i].z << std::endl;
+        }
+    });
 }
 
 void PointKernel::getPoints(std::vector<Base::Vector3d>& Points,
@@ -254,7 +446,7 @@ void PointKernel::getPoints(std::vector<Base::Vector3d>& Points,
                             double /*Accuracy*/,
                             uint16_t /*flags*/) const
 {
-    unsigned long ctpoints = _Points.size();
+    unsigned long ctpoints = size();
     Points.reserve(ctpoints);
     for (unsigned long i = 0; i < ctpoints; i++) {
         Points.push_back(this->getPoint(i));
@@ -263,15 +455,13 @@ void PointKernel::getPoints(std::vector<Base::Vector3d>& Points,
 
 // ----------------------------------------------------------------------------
 
-PointKernel::const_point_iterator::const_point_iterator(
-    const PointKernel* kernel,
-    std::vector<kernel_type>::const_iterator index)
+PointKernel::const_point_iterator::const_point_iterator(const PointKernel* kernel,
+                                                       size_type index)
     : _kernel(kernel)
-    , _p_it(index)
+    , _index(index)
 {
-    if (_p_it != kernel->_Points.end()) {
-        value_type vertd(_p_it->x, _p_it->y, _p_it->z);
-        this->_point = _kernel->_Mtrx * vertd;
+    if (_index < kernel->size()) {
+        dereference();
     }
 }
 
@@ -291,7 +481,8 @@ PointKernel::const_point_iterator::operator=(PointKernel::const_point_iterator&&
 
 void PointKernel::const_point_iterator::dereference()
 {
-    value_type vertd(_p_it->x, _p_it->y, _p_it->z);
+    const kernel_type& pnt = _kernel->basicPoint(_index);
+    value_type vertd(pnt.x, pnt.y, pnt.z);
     this->_point = _kernel->_Mtrx * vertd;
 }
 
@@ -310,7 +501,7 @@ const PointKernel::const_point_iterator::value_type* PointKernel::const_point_it
 bool PointKernel::const_point_iterator::operator==(
     const PointKernel::const_point_iterator& pi) const
 {
-    return (this->_kernel == pi._kernel) && (this->_p_it == pi._p_it);
+    return (this->_kernel == pi._kernel) && (this->_index == pi._index);
 }
 
 bool PointKernel::const_point_iterator::operator!=(
@@ -321,27 +512,27 @@ bool PointKernel::const_point_iterator::operator!=(
 
 PointKernel::const_point_iterator& PointKernel::const_point_iterator::operator++()
 {
-    ++(this->_p_it);
+    ++(this->_index);
     return *this;
 }
 
 PointKernel::const_point_iterator PointKernel::const_point_iterator::operator++(int)
 {
     PointKernel::const_point_iterator tmp = *this;
-    ++(this->_p_it);
+    ++(this->_index);
     return tmp;
 }
 
 PointKernel::const_point_iterator& PointKernel::const_point_iterator::operator--()
 {
-    --(this->_p_it);
+    --(this->_index);
     return *this;
 }
 
 PointKernel::const_point_iterator PointKernel::const_point_iterator::operator--(int)
 {
     PointKernel::const_point_iterator tmp = *this;
-    --(this->_p_it);
+    --(this->_index);
     return tmp;
 }
 
@@ -362,19 +553,19 @@ PointKernel::const_point_iterator::operator-(difference_type off) const
 PointKernel::const_point_iterator&
 PointKernel::const_point_iterator::operator+=(difference_type off)
 {
-    (this->_p_it) += off;
+    (this->_index) += off;
     return *this;
 }
 
 PointKernel::const_point_iterator&
 PointKernel::const_point_iterator::operator-=(difference_type off)
 {
-    (this->_p_it) -= off;
+    (this->_index) -= off;
     return *this;
 }
 
 PointKernel::difference_type
 PointKernel::const_point_iterator::operator-(const PointKernel::const_point_iterator& right) const
 {
-    return this->_p_it - right._p_it;
+    return difference_type(this->_index) - difference_type(right._index);
 }
@@ -25,6 +25,7 @@
 #define POINTS_POINT_H
 
 #include <iterator>
+#include <memory>
 #include <vector>
 
 #include <App/ComplexGeoData.h>
@@ -37,6 +38,8 @@
 
 #include <Mod/Points/PointsGlobal.h>
 
+#include "PointStore.h"
+
 namespace Points
 {
 
@@ -84,20 +87,24 @@ public:
     {
         return _Mtrx;
     }
+    /// An out-of-core kernel is loaded into memory
     std::vector<value_type>& getBasicPoints()
     {
+        loadIntoMemory();
         return this->_Points;
     }
-    const std::vector<value_type>& getBasicPoints() const
-    {
-        return this->_Points;
-    }
+    /** The points of an out-of-core kernel can't be returned as a vector, either
+     * they are read with forEachRange() or moved into memory with setOutOfCore(false).
+     */
+    const std::vector<value_type>& getBasicPoints() const;
     void setBasicPoints(const std::vector<value_type>& pts)
     {
+        this->_Store.reset();
         this->_Points = pts;
     }
     void swap(std::vector<value_type>& pts)
     {
+        loadIntoMemory();
         this->_Points.swap(pts);
     }
 
@@ -122,51 +129,118 @@ public:
     void load(std::istream&);
     //@}
 
+    /** @name Out-of-core storage
+     * The points of big clouds can be kept in a memory-mapped temporary file
+     * instead of the main memory. Copies of such a kernel share the file until
+     * one of them is modified.
+     */
+    //@{
+    /// moves the points into a temporary file or back into memory
+    void setOutOfCore(bool on);
+    bool isOutOfCore() const
+    {
+        return static_cast<bool>(_Store);
+    }
+    /// returns true if \a num points exceed the memory limit of the user settings
+    static bool exceedsMemoryLimit(size_type num);
+    /** Calls \a func(const value_type* pnts, size_type num) for consecutive ranges
+     * of the untransformed points. An out-of-core kernel stays on disk.
+     */
+    template<typename Func>
+    void forEachRange(Func&& func) const
+    {
+        if (_Store) {
+            for (size_type i = 0; i < _Store->countChunks(); i++) {
+                func(_Store->chunk(i), _Store->chunkLength(i));
+            }
+        }
+        else if (!_Points.empty()) {
+            func(_Points.data(), _Points.size());
+        }
+    }
+    /// the same as above but the points can be modified
+    template<typename Func>
+    void forEachRange(Func&& func)
+    {
+        detach();
+        if (_Store) {
+            for (size_type i = 0; i < _Store->countChunks(); i++) {
+                func(_Store->chunk(i), _Store->chunkLength(i));
+            }
+        }
+        else if (!_Points.empty()) {
+            func(_Points.data(), _Points.size());
+        }
+    }
+    /// keeps only every \a step-th point
+    void decimate(size_type step);
+    //@}
+
+private:
+    /// makes a private copy of a shared out-of-core storage
+    void detach();
+    void loadIntoMemory()
+    {
+        if (_Store) {
+            moveIntoMemory();
+        }
+    }
+    void moveIntoMemory();
+    const value_type& basicPoint(size_type idx) const
+    {
+        return _Store ? (*_Store)[idx] : _Points[idx];
+    }
+    value_type& basicPoint(size_type idx)
+    {
+        return _Store ? (*_Store)[idx] : _Points[idx];
+    }
+
 private:
     Base::Matrix4D _Mtrx;
     std::vector<value_type> _Points;
+    std::shared_ptr<PointStore> _Store;
 
 public:
     /// number of points stored
     size_type size() const
     {
-        return this->_Points.size();
+        return _Store ? _Store->size() : this->_Points.size();
     }
     size_type countValid() const;
     std::vector<value_type> getValidPoints() const;
-    void resize(size_type n)
-    {
-        _Points.resize(n);
-    }
+    void resize(size_type n);
     void reserve(size_type n)
     {
-        _Points.reserve(n);
-    }
-    inline void erase(size_type first, size_type last)
-    {
-        _Points.erase(_Points.begin() + first, _Points.begin() + last);
-    }
-
-    void clear()
-    {
-        _Points.clear();
+        if (!_Store) {
+            _Points.reserve(n);
+        }
     }
+    void erase(size_type first, size_type last);
+    /// an out-of-core kernel stays out-of-core
+    void clear();
 
 
     /// get the points
-    inline const Base::Vector3d getPoint(const int idx) const
+    inline const Base::Vector3d getPoint(const size_type idx) const
     {
-        return transformPointToOutside(_Points[idx]);
+        return transformPointToOutside(basicPoint(idx));
     }
     /// set the points
-    inline void setPoint(const int idx, const Base::Vector3d& point)
+    inline void setPoint(const size_type idx, const Base::Vector3d& point)
     {
-        _Points[idx] = transformPointToInside(point);
+        detach();
+        basicPoint(idx) = transformPointToInside(point);
     }
     /// insert the points
     inline void push_back(const Base::Vector3d& point)
     {
-        _Points.push_back(transformPointToInside(point));
+        if (_Store) {
+            detach();
+            _Store->push_back(transformPointToInside(point));
+        }
+        else {
+            _Points.push_back(transformPointToInside(point));
+        }
     }
 
     class PointsExport const_point_iterator
@@ -174,13 +248,12 @@ public:
     public:
         using kernel_type = PointKernel::value_type;
         using value_type = Base::Vector3d;
-        using iter_type = std::vector<kernel_type>::const_iterator;
-        using difference_type = iter_type::difference_type;
-        using iterator_category = iter_type::iterator_category;
+        using difference_type = PointKernel::difference_type;
+        using iterator_category = std::random_access_iterator_tag;
         using pointer = const value_type*;
         using reference = const value_type&;
 
-        const_point_iterator(const PointKernel*, std::vector<kernel_type>::const_iterator index);
+        const_point_iterator(const PointKernel*, size_type index);
         const_point_iterator(const const_point_iterator& pi);
         const_point_iterator(const_point_iterator&& pi);
         ~const_point_iterator();
@@ -205,7 +278,7 @@ public:
         void dereference();
         const PointKernel* _kernel;
         value_type _point;
-        std::vector<kernel_type>::const_iterator _p_it;
+        size_type _index;
     };
 
     using const_iterator = const_point_iterator;
@@ -215,11 +288,11 @@ public:
     //@{
     const_point_iterator begin() const
     {
-        return {this, _Points.begin()};
+        return {this, 0};
     }
     const_point_iterator end() const
     {
-        return {this, _Points.end()};
+        return {this, size()};
     }
     const_reverse_iterator rbegin() const
     {
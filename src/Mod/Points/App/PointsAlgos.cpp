@@ -557,22 +557,11 @@ void PlyReader::read(const std::string& filename)
     std::vector<std::string> types;
     std::vector<int> sizes;
     std::size_t offset = 0;
-    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, offset, fields, types, sizes));
+    std::size_t numPoints = readHeader(inp, format, offset, fields, types, sizes);
 
     this->width = numPoints;
     this->height = 1;
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, offset, data);
-    }
-    else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
-    }
-    else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
-    }
-
     std::vector<std::string>::iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
@@ -665,55 +654,61 @@ void PlyReader::read(const std::string& filename)
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (red != max_size && green != max_size && blue != max_size);
 
+    // the rows are transferred one by one, big clouds go to the out-of-core storage
     if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+        if (PointKernel::exceedsMemoryLimit(numPoints)) {
+            points.setOutOfCore(true);
         }
+        points.reserve(numPoints);
     }
-
     if (hasData && hasNormal) {
         normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
-        }
     }
-
     if (hasData && hasIntensity) {
         intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(static_cast<float>(data(i, greyvalue)));
-        }
     }
-
     if (hasData && hasColor) {
         colors.reserve(numPoints);
-        float a = 1.0;
-        if (types[red] == "uchar") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(static_cast<float>(r) / 255.0F,
-                                    static_cast<float>(g) / 255.0F,
-                                    static_cast<float>(b) / 255.0F,
-                                    static_cast<float>(a) / 255.0F);
-            }
+    }
+
+    bool ucharColor = hasColor && types[red] == "uchar";
+    bool floatColor = hasColor && types[red] == "float";
+    auto addRow = [&](const std::vector<double>& row) {
+        if (!hasData) {
+            return;
         }
-        else if (types[red] == "float") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
+        points.push_back(Base::Vector3d(row[x], row[y], row[z]));
+        if (hasNormal) {
+            normals.emplace_back(row[normal_x], row[normal_y], row[normal_z]);
+        }
+        if (hasIntensity) {
+            intensity.push_back(static_cast<float>(row[greyvalue]));
+        }
+        if (ucharColor || floatColor) {
+            float r = static_cast<float>(row[red]);
+            float g = static_cast<float>(row[green]);
+            float b = static_cast<float>(row[blue]);
+            float a = 1.0F;
+            if (alpha != max_size) {
+                a = static_cast<float>(row[alpha]);
+            }
+            if (ucharColor) {
+                colors.emplace_back(r / 255.0F, g / 255.0F, b / 255.0F, a / 255.0F);
+            }
+            else {
                 colors.emplace_back(r, g, b, a);
             }
         }
+    };
+
+    if (format == "ascii") {
+        readAscii(inp, offset, numPoints, fields.size(), addRow);
+    }
+    else if (format == "binary_little_endian") {
+        readBinary(false, inp, offset, numPoints, types, sizes, addRow);
+    }
+    else if (format == "binary_big_endian") {
+        readBinary(true, inp, offset, numPoints, types, sizes, addRow);
     }
 }
 
@@ -887,12 +882,15 @@ std::size_t PlyReader::readHeader(std::istream& in,
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
+void PlyReader::readAscii(std::istream& inp,
+                          std::size_t offset,
+                          std::size_t numPoints,
+                          std::size_t numFields,
+                          const RowHandler& addRow)
 {
     std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
+    std::size_t row = 0;
+    std::vector<double> values(numFields);
     std::vector<std::string> list;
     while (std::getline(inp, line) && row < numPoints) {
         if (line.empty()) {
@@ -908,13 +906,12 @@ void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd
         boost::trim(line);
         boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
 
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
+        std::fill(values.begin(), values.end(), 0.0);
+        std::size_t size = list.size();
+        for (std::size_t col = 0; col < size && col < numFields; col++) {
+            values[col] = boost::lexical_cast<double>(list[col]);
         }
+        addRow(values);
 
         ++row;
     }
@@ -923,12 +920,12 @@ void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd
 void PlyReader::readBinary(bool swapByteOrder,
                            std::istream& inp,
                            std::size_t offset,
+                           std::size_t numPoints,
                            const std::vector<std::string>& types,
                            const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
+                           const RowHandler& addRow)
 {
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
+    std::size_t numFields = types.size();
 
     int neededSize = 0;
     ConverterPtr convert_float32(new ConverterT<float>);
@@ -941,7 +938,7 @@ void PlyReader::readBinary(bool swapByteOrder,
     ConverterPtr convert_uint32(new ConverterT<uint32_t>);
 
     std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
+    for (std::size_t j = 0; j < numFields; j++) {
         const std::string& t = types[j];
         switch (sizes[j]) {
             case 1:
@@ -1009,11 +1006,12 @@ void PlyReader::readBinary(bool swapByteOrder,
 
     Base::InputStream str(inp);
     str.setByteOrder(swapByteOrder ? Base::Stream::BigEndian : Base::Stream::LittleEndian);
-    for (Eigen::Index i = 0; i < numPoints; i++) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            double value = converters[j]->toDouble(str);
-            data(i, j) = value;
+    std::vector<double> values(numFields);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        for (std::size_t j = 0; j < numFields; j++) {
+            values[j] = converters[j]->toDouble(str);
         }
+        addRow(values);
     }
 }
 
@@ -1034,34 +1032,7 @@ void PcdReader::read(const std::string& filename)
     std::vector<std::string> fields;
     std::vector<std::string> types;
     std::vector<int> sizes;
-    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
-
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, data);
-    }
-    else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
-    }
-    else if (format == "binary_compressed") {
-        unsigned int c {};
-        unsigned int u {};
-        Base::InputStream str(inp);
-        str >> c >> u;
-
-        std::vector<char> compressed(c);
-        inp.read(compressed.data(), c);
-        std::vector<char> uncompressed(u);
-        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
-            DataStreambuf ibuf(uncompressed);
-            std::istream istr(nullptr);
-            istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
-        }
-        else {
-            throw Base::BadFormatError("Failed to decompress binary data");
-        }
-    }
+    std::size_t numPoints = readHeader(inp, format, fields, types, sizes);
 
     std::vector<std::string>::iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
@@ -1140,48 +1111,76 @@ void PcdReader::read(const std::string& filename)
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (rgba != max_size);
 
+    // the rows are transferred one by one, big clouds go to the out-of-core storage
     if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+        if (PointKernel::exceedsMemoryLimit(numPoints)) {
+            points.setOutOfCore(true);
         }
+        points.reserve(numPoints);
     }
-
     if (hasData && hasNormal) {
         normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
-        }
     }
-
     if (hasData && hasIntensity) {
         intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(data(i, greyvalue));
-        }
     }
-
     if (hasData && hasColor) {
         colors.reserve(numPoints);
-        if (types[rgba] == "U") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                uint32_t packed = static_cast<uint32_t>(data(i, rgba));
-                App::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
+    }
+
+    static_assert(sizeof(float) == sizeof(uint32_t), "float and uint32_t have different sizes");
+    bool packedColor = hasColor && types[rgba] == "U";
+    bool floatColor = hasColor && types[rgba] == "F";
+    auto addRow = [&](const std::vector<double>& row) {
+        if (!hasData) {
+            return;
+        }
+        points.push_back(Base::Vector3d(row[x], row[y], row[z]));
+        if (hasNormal) {
+            normals.emplace_back(row[normal_x], row[normal_y], row[normal_z]);
         }
-        else if (types[rgba] == "F") {
-            static_assert(sizeof(float) == sizeof(uint32_t),
-                          "float and uint32_t have different sizes");
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float f = static_cast<float>(data(i, rgba));
-                uint32_t packed {};
+        if (hasIntensity) {
+            intensity.push_back(row[greyvalue]);
+        }
+        if (packedColor || floatColor) {
+            uint32_t packed {};
+            if (packedColor) {
+                packed = static_cast<uint32_t>(row[rgba]);
+            }
+            else {
+                float f = static_cast<float>(row[rgba]);
                 std::memcpy(&packed, &f, sizeof(packed));
-                App::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
             }
+            App::Color col;
+            col.setPackedARGB(packed);
+            colors.emplace_back(col);
+        }
+    };
+
+    if (format == "ascii") {
+        readAscii(inp, numPoints, fields.size(), addRow);
+    }
+    else if (format == "binary") {
+        readBinary(false, inp, numPoints, types, sizes, addRow);
+    }
+    else if (format == "binary_compressed") {
+        unsigned int c {};
+        unsigned int u {};
+        Base::InputStream str(inp);
+        str >> c >> u;
+
+        std::vector<char> compressed(c);
+        inp.read(compressed.data(), c);
+        std::vector<char> uncompressed(u);
+        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
+            std::vector<char>().swap(compressed);
+            DataStreambuf ibuf(uncompressed);
+            std::istream istr(nullptr);
+            istr.rdbuf(&ibuf);
+            readBinary(true, istr, numPoints, types, sizes, addRow);
+        }
+        else {
+            throw Base::BadFormatError("Failed to decompress binary data");
         }
     }
 }
@@ -1257,12 +1256,14 @@ std::size_t PcdReader::readHeader(std::istream& in,
     return points;
 }
 
-void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
+void PcdReader::readAscii(std::istream& inp,
+                          std::size_t numPoints,
+                          std::size_t numFields,
+                          const RowHandler& addRow)
 {
     std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
+    std::size_t row = 0;
+    std::vector<double> values(numFields);
     std::vector<std::string> list;
     while (std::getline(inp, line) && row < numPoints) {
         if (line.empty()) {
@@ -1273,13 +1274,12 @@ void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
         boost::trim(line);
         boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
 
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
+        std::fill(values.begin(), values.end(), 0.0);
+        std::size_t size = list.size();
+        for (std::size_t col = 0; col < size && col < numFields; col++) {
+            values[col] = boost::lexical_cast<double>(list[col]);
         }
+        addRow(values);
 
         ++row;
     }
@@ -1287,12 +1287,12 @@ void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
 
 void PcdReader::readBinary(bool transpose,
                            std::istream& inp,
+                           std::size_t numPoints,
                            const std::vector<std::string>& types,
                            const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
+                           const RowHandler& addRow)
 {
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
+    std::size_t numFields = types.size();
 
     int neededSize = 0;
     ConverterPtr convert_float32(new ConverterT<float>);
@@ -1305,7 +1305,7 @@ void PcdReader::readBinary(bool transpose,
     ConverterPtr convert_uint32(new ConverterT<uint32_t>);
 
     std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
+    for (std::size_t j = 0; j < numFields; j++) {
         char t = types[j][0];
         switch (sizes[j]) {
             case 1:
@@ -1372,20 +1372,30 @@ void PcdReader::readBinary(bool transpose,
     }
 
     Base::InputStream str(inp);
+    std::vector<double> values(numFields);
     if (transpose) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
+        // the fields are stored one after another, so seek to the value of each field
+        std::vector<std::streamoff> start(numFields);
+        std::streamoff pos = ulCurr;
+        for (std::size_t j = 0; j < numFields; j++) {
+            start[j] = pos;
+            pos += converters[j]->getSizeOf() * static_cast<std::streamoff>(numPoints);
+        }
+        for (std::size_t i = 0; i < numPoints; i++) {
+            for (std::size_t j = 0; j < numFields; j++) {
+                std::streamoff size = converters[j]->getSizeOf();
+                buf->pubseekpos(start[j] + size * static_cast<std::streamoff>(i), std::ios::in);
+                values[j] = converters[j]->toDouble(str);
             }
+            addRow(values);
         }
     }
     else {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            for (Eigen::Index j = 0; j < numFields; j++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
+        for (std::size_t i = 0; i < numPoints; i++) {
+            for (std::size_t j = 0; j < numFields; j++) {
+                values[j] = converters[j]->toDouble(str);
             }
+            addRow(values);
         }
     }
 }
@@ -1436,6 +1446,16 @@ public:
 private:
     void readData3D(const e57::VectorNode& data3D)
     {
+        // big clouds go to the out-of-core storage
+        std::size_t total = 0;
+        for (int child = 0; child < data3D.childCount(); ++child) {
+            e57::StructureNode scan_data(data3D.get(child));
+            total += e57::CompressedVectorNode(scan_data.get("points")).childCount();
+        }
+        if (PointKernel::exceedsMemoryLimit(total)) {
+            points.setOutOfCore(true);
+        }
+
         for (int child = 0; child < data3D.childCount(); ++child) {
             e57::StructureNode scan_data(data3D.get(child));
             Base::Placement plm;
@@ -1910,83 +1930,15 @@ void PlyWriter::write(const std::string& filename)
         converters.push_back(convert_float);
     }
 
-    Eigen::Index numPoints = Eigen::Index(points.size());
-    Eigen::Index numValid = 0;
-    const std::vector<Base::Vector3f>& pts = points.getBasicPoints();
-    for (Eigen::Index i = 0; i < numPoints; i++) {
-        const Base::Vector3f& p = pts[i];
-        if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
-            numValid++;
-        }
-    }
-
-    Eigen::MatrixXf data(numPoints, properties.size());
-
-    if (placement.isIdentity()) {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            data(i, 0) = pts[i].x;
-            data(i, 1) = pts[i].y;
-            data(i, 2) = pts[i].z;
-        }
-    }
-    else {
-        Base::Vector3d tmp;
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            tmp = Base::convertTo<Base::Vector3d>(pts[i]);
-            placement.multVec(tmp, tmp);
-            data(i, 0) = static_cast<float>(tmp.x);
-            data(i, 1) = static_cast<float>(tmp.y);
-            data(i, 2) = static_cast<float>(tmp.z);
-        }
-    }
-
-    Eigen::Index col = 3;
-    if (hasNormals) {
-        Eigen::Index col0 = col;
-        Eigen::Index col1 = col + 1;
-        Eigen::Index col2 = col + 2;
-        Base::Rotation rot = placement.getRotation();
-        if (rot.isIdentity()) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                data(i, col0) = normals[i].x;
-                data(i, col1) = normals[i].y;
-                data(i, col2) = normals[i].z;
-            }
-        }
-        else {
-            Base::Vector3d tmp;
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                tmp = Base::convertTo<Base::Vector3d>(normals[i]);
-                rot.multVec(tmp, tmp);
-                data(i, col0) = static_cast<float>(tmp.x);
-                data(i, col1) = static_cast<float>(tmp.y);
-                data(i, col2) = static_cast<float>(tmp.z);
+    std::size_t numValid = 0;
+    points.forEachRange([&numValid](const Base::Vector3f* pnts, std::size_t num) {
+        for (std::size_t i = 0; i < num; i++) {
+            const Base::Vector3f& p = pnts[i];
+            if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
+                numValid++;
             }
         }
-        col += 3;
-    }
-
-    if (hasColors) {
-        Eigen::Index col0 = col;
-        Eigen::Index col1 = col + 1;
-        Eigen::Index col2 = col + 2;
-        Eigen::Index col3 = col + 3;
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            App::Color c = colors[i];
-            data(i, col0) = (c.r * 255.0F + 0.5F);
-            data(i, col1) = (c.g * 255.0F + 0.5F);
-            data(i, col2) = (c.b * 255.0F + 0.5F);
-            data(i, col3) = (c.a * 255.0F + 0.5F);
-        }
-        col += 4;
-    }
-
-    if (hasIntensity) {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            data(i, col) = intensity[i];
-        }
-        col += 1;
-    }
+    });
 
     Base::ofstream out(Base::FileInfo(filename), std::ios::out);
     out << "ply" << std::endl
@@ -2000,22 +1952,58 @@ void PlyWriter::write(const std::string& filename)
     }
     out << "end_header" << std::endl;
 
-    for (Eigen::Index r = 0; r < numPoints; r++) {
-        if (boost::math::isnan(data(r, 0))) {
-            continue;
-        }
-        if (boost::math::isnan(data(r, 1))) {
-            continue;
-        }
-        if (boost::math::isnan(data(r, 2))) {
-            continue;
-        }
-        for (Eigen::Index c = 0; c < col; c++) {
-            float value = data(r, c);
-            out << converters[c]->toString(value) << " ";
+    // the rows are written while walking the points, so an out-of-core kernel stays on disk
+    bool transform = !placement.isIdentity();
+    Base::Rotation rot = placement.getRotation();
+    std::vector<float> row(properties.size());
+    std::size_t index = 0;
+    points.forEachRange([&](const Base::Vector3f* pnts, std::size_t num) {
+        for (std::size_t i = 0; i < num; i++, index++) {
+            Base::Vector3f pnt = pnts[i];
+            if (transform) {
+                Base::Vector3d tmp = Base::convertTo<Base::Vector3d>(pnt);
+                placement.multVec(tmp, tmp);
+                pnt.Set(static_cast<float>(tmp.x), static_cast<float>(tmp.y), static_cast<float>(tmp.z));
+            }
+            if (boost::math::isnan(pnt.x) || boost::math::isnan(pnt.y) || boost::math::isnan(pnt.z)) {
+                continue;
+            }
+
+            std::size_t col = 0;
+            row[col++] = pnt.x;
+            row[col++] = pnt.y;
+            row[col++] = pnt.z;
+
+            if (hasNormals) {
+                Base::Vector3f nor = normals[index];
+                if (!rot.isIdentity()) {
+                    Base::Vector3d tmp = Base::convertTo<Base::Vector3d>(nor);
+                    rot.multVec(tmp, tmp);
+                    nor.Set(static_cast<float>(tmp.x), static_cast<float>(tmp.y), static_cast<float>(tmp.z));
+                }
+                row[col++] = nor.x;
+                row[col++] = nor.y;
+                row[col++] = nor.z;
+            }
+
+            if (hasColors) {
+                App::Color c = colors[index];
+                row[col++] = (c.r * 255.0F + 0.5F);
+                row[col++] = (c.g * 255.0F + 0.5F);
+                row[col++] = (c.b * 255.0F + 0.5F);
+                row[col++] = (c.a * 255.0F + 0.5F);
+            }
+
+            if (hasIntensity) {
+                row[col++] = intensity[index];
+            }
+
+            for (std::size_t c = 0; c < col; c++) {
+                out << converters[c]->toString(row[c]) << " ";
+            }
+            out << std::endl;
         }
-        out << std::endl;
-    }
+    });
 }
 
 // ----------------------------------------------------------------------------
@@ -2072,70 +2060,7 @@ void PcdWriter::write(const std::string& filename)
         converters.push_back(convert_float);
     }
 
-    Eigen::Index numPoints = Eigen::Index(points.size());
-    const std::vector<Base::Vector3f>& pts = points.getBasicPoints();
-
-    Eigen::MatrixXd data(numPoints, fields.size());
-
-    if (placement.isIdentity()) {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            data(i, 0) = pts[i].x;
-            data(i, 1) = pts[i].y;
-            data(i, 2) = pts[i].z;
-        }
-    }
-    else {
-        Base::Vector3d tmp;
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            tmp = Base::convertTo<Base::Vector3d>(pts[i]);
-            placement.multVec(tmp, tmp);
-            data(i, 0) = static_cast<float>(tmp.x);
-            data(i, 1) = static_cast<float>(tmp.y);
-            data(i, 2) = static_cast<float>(tmp.z);
-        }
-    }
-
-    Eigen::Index col = 3;
-    if (hasNormals) {
-        Eigen::Index col0 = col;
-        Eigen::Index col1 = col + 1;
-        Eigen::Index col2 = col + 2;
-        Base::Rotation rot = placement.getRotation();
-        if (rot.isIdentity()) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                data(i, col0) = normals[i].x;
-                data(i, col1) = normals[i].y;
-                data(i, col2) = normals[i].z;
-            }
-        }
-        else {
-            Base::Vector3d tmp;
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                tmp = Base::convertTo<Base::Vector3d>(normals[i]);
-                rot.multVec(tmp, tmp);
-                data(i, col0) = static_cast<float>(tmp.x);
-                data(i, col1) = static_cast<float>(tmp.y);
-                data(i, col2) = static_cast<float>(tmp.z);
-            }
-        }
-        col += 3;
-    }
-
-    if (hasColors) {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            // http://docs.pointclouds.org/1.3.0/structpcl_1_1_r_g_b.html
-            data(i, col) = colors[i].getPackedARGB();
-        }
-        col += 1;
-    }
-
-    if (hasIntensity) {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            data(i, col) = intensity[i];
-        }
-        col += 1;
-    }
-
+    std::size_t numPoints = points.size();
     std::size_t numFields = fields.size();
     Base::ofstream out(Base::FileInfo(filename), std::ios::out);
     out << "# .PCD v0.7 - Point Cloud Data file format" << std::endl << "VERSION 0.7" << std::endl;
@@ -2184,16 +2109,61 @@ void PcdWriter::write(const std::string& filename)
 
     out << "POINTS " << numPoints << std::endl << "DATA ascii" << std::endl;
 
-    for (Eigen::Index r = 0; r < numPoints; r++) {
-        for (Eigen::Index c = 0; c < col; c++) {
-            double value = data(r, c);
-            if (boost::math::isnan(value)) {
-                out << "nan ";
+    // the rows are written while walking the points, so an out-of-core kernel stays on disk
+    bool transform = !placement.isIdentity();
+    Base::Rotation rot = placement.getRotation();
+    std::vector<double> row(numFields);
+    std::size_t index = 0;
+    points.forEachRange([&](const Base::Vector3f* pnts, std::size_t num) {
+        for (std::size_t i = 0; i < num; i++, index++) {
+            std::size_t col = 0;
+            if (transform) {
+                Base::Vector3d tmp = Base::convertTo<Base::Vector3d>(pnts[i]);
+                placement.multVec(tmp, tmp);
+                row[col++] = static_cast<float>(tmp.x);
+                row[col++] = static_cast<float>(tmp.y);
+                row[col++] = static_cast<float>(tmp.z);
             }
             else {
-                out << converters[c]->toString(value) << " ";
+                row[col++] = pnts[i].x;
+                row[col++] = pnts[i].y;
+                row[col++] = pnts[i].z;
+            }
+
+            if (hasNormals) {
+                if (rot.isIdentity()) {
+                    row[col++] = normals[index].x;
+                    row[col++] = normals[index].y;
+                    row[col++] = normals[index].z;
+                }
+                else {
+                    Base::Vector3d tmp = Base::convertTo<Base::Vector3d>(normals[index]);
+                    rot.multVec(tmp, tmp);
+                    row[col++] = static_cast<float>(tmp.x);
+                    row[col++] = static_cast<float>(tmp.y);
+                    row[col++] = static_cast<float>(tmp.z);
+                }
+            }
+
+            if (hasColors) {
+                // http://docs.pointclouds.org/1.3.0/structpcl_1_1_r_g_b.html
+                row[col++] = colors[index].getPackedARGB();
             }
+
+            if (hasIntensity) {
+                row[col++] = intensity[index];
+            }
+
+            for (std::size_t c = 0; c < col; c++) {
+                double value = row[c];
+                if (boost::math::isnan(value)) {
+                    out << "nan ";
+                }
+                else {
+                    out << converters[c]->toString(value) << " ";
+                }
+            }
+            out << std::endl;
         }
-        out << std::endl;
-    }
+    });
 }
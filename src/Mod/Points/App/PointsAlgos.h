@@ -23,6 +23,7 @@
 #ifndef _PointsAlgos_h_
 #define _PointsAlgos_h_
 
+#include <functional>
 #include <Eigen/Core>
 
 #include "Points.h"
@@ -71,6 +72,9 @@ public:
     Reader& operator=(Reader&&) = delete;
 
 protected:
+    /// handles the values of the fields of a point
+    using RowHandler = std::function<void(const std::vector<double>&)>;
+
     // NOLINTBEGIN
     PointKernel points;
     std::vector<float> intensity;
@@ -101,13 +105,18 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
+    void readAscii(std::istream&,
+                   std::size_t offset,
+                   std::size_t numPoints,
+                   std::size_t numFields,
+                   const RowHandler& addRow);
     void readBinary(bool swapByteOrder,
                     std::istream&,
                     std::size_t offset,
+                    std::size_t numPoints,
                     const std::vector<std::string>& types,
                     const std::vector<int>& sizes,
-                    Eigen::MatrixXd& data);
+                    const RowHandler& addRow);
 };
 
 class PointsExport PcdReader: public Reader
@@ -122,12 +131,16 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, Eigen::MatrixXd& data);
+    void readAscii(std::istream&,
+                   std::size_t numPoints,
+                   std::size_t numFields,
+                   const RowHandler& addRow);
     void readBinary(bool transpose,
                     std::istream&,
+                    std::size_t numPoints,
                     const std::vector<std::string>& types,
                     const std::vector<int>& sizes,
-                    Eigen::MatrixXd& data);
+                    const RowHandler& addRow);
 };
 
 class PointsExport E57Reader: public Reader
@@ -0,0 +1,539 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <QThread>
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/Matrix.h>
+
+#include "PointsOctree.h"
+
+
+using namespace Points;
+
+namespace
+{
+using Range = std::pair<std::size_t, std::size_t>;
+
+// number of cells per axis that fit into a 64-bit Morton code
+constexpr std::uint64_t MaxCells = std::uint64_t(1) << PointsOctree::MaxDepth;
+
+std::vector<Range> makeBlocks(std::size_t count)
+{
+    // small blocks are not worth a thread
+    const std::size_t minBlock = 65536;
+    std::size_t threads = std::max(QThread::idealThreadCount(), 1);
+    std::size_t num = std::max<std::size_t>(std::min(threads, count / minBlock), 1);
+
+    std::vector<Range> blocks;
+    blocks.reserve(num);
+    for (std::size_t i = 0; i < num; i++) {
+        blocks.emplace_back(count * i / num, count * (i + 1) / num);
+    }
+    return blocks;
+}
+
+/// calls \a func(begin, end) concurrently for blocks of the range [0, count)
+template<typename Func>
+void forEachBlock(std::size_t count, Func&& func)
+{
+    std::vector<Range> blocks = makeBlocks(count);
+    QtConcurrent::blockingMap(blocks, [&func](const Range& block) {
+        func(block.first, block.second);
+    });
+}
+
+/// sorts the blocks concurrently and merges them pairwise
+template<typename T>
+void parallelSort(std::vector<T>& values)
+{
+    std::vector<Range> blocks = makeBlocks(values.size());
+    QtConcurrent::blockingMap(blocks, [&values](const Range& block) {
+        std::sort(values.begin() + block.first, values.begin() + block.second);
+    });
+
+    while (blocks.size() > 1) {
+        std::vector<Range> merged;
+        std::vector<std::array<std::size_t, 3>> jobs;
+        for (std::size_t i = 0; i + 1 < blocks.size(); i += 2) {
+            jobs.push_back({blocks[i].first, blocks[i].second, blocks[i + 1].second});
+            merged.emplace_back(blocks[i].first, blocks[i + 1].second);
+        }
+        if (blocks.size() % 2 != 0) {
+            merged.push_back(blocks.back());
+        }
+        QtConcurrent::blockingMap(jobs, [&values](const std::array<std::size_t, 3>& job) {
+            std::inplace_merge(values.begin() + job[0],
+                               values.begin() + job[1],
+                               values.begin() + job[2]);
+        });
+        blocks.swap(merged);
+    }
+}
+
+/// inserts two zero bits after each of the lower 21 bits
+std::uint64_t splitBits(std::uint64_t value)
+{
+    value &= 0x1fffff;
+    value = (value | value << 32) & 0x1f00000000ffff;
+    value = (value | value << 16) & 0x1f0000ff0000ff;
+    value = (value | value << 8) & 0x100f00f00f00f00f;
+    value = (value | value << 4) & 0x10c30c30c30c30c3;
+    value = (value | value << 2) & 0x1249249249249249;
+    return value;
+}
+
+std::uint64_t mortonCode(std::uint64_t x, std::uint64_t y, std::uint64_t z)
+{
+    return splitBits(x) | splitBits(y) << 1 | splitBits(z) << 2;
+}
+
+std::array<std::uint64_t, 3>
+cellIndex(const Base::BoundBox3f& box, const Base::Vector3f& pnt, double cellSize)
+{
+    return {static_cast<std::uint64_t>((double(pnt.x) - box.MinX) / cellSize),
+            static_cast<std::uint64_t>((double(pnt.y) - box.MinY) / cellSize),
+            static_cast<std::uint64_t>((double(pnt.z) - box.MinZ) / cellSize)};
+}
+
+double distanceSquared(const Base::Vector3f& pnt1, const Base::Vector3d& pnt2)
+{
+    double dx = double(pnt1.x) - pnt2.x;
+    double dy = double(pnt1.y) - pnt2.y;
+    double dz = double(pnt1.z) - pnt2.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+/// squared distance of \a pnt to the nearest point of \a box
+double distanceSquared(const Base::BoundBox3f& box, const Base::Vector3d& pnt)
+{
+    auto axis = [](double value, double min, double max) {
+        if (value < min) {
+            return min - value;
+        }
+        if (value > max) {
+            return value - max;
+        }
+        return 0.0;
+    };
+    double dx = axis(pnt.x, box.MinX, box.MaxX);
+    double dy = axis(pnt.y, box.MinY, box.MaxY);
+    double dz = axis(pnt.z, box.MinZ, box.MaxZ);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+/// squared distance of \a pnt to the farthest corner of \a box
+double maxDistanceSquared(const Base::BoundBox3f& box, const Base::Vector3d& pnt)
+{
+    auto axis = [](double value, double min, double max) {
+        return std::max(std::fabs(value - min), std::fabs(value - max));
+    };
+    double dx = axis(pnt.x, box.MinX, box.MaxX);
+    double dy = axis(pnt.y, box.MinY, box.MaxY);
+    double dz = axis(pnt.z, box.MinZ, box.MaxZ);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+void checkSize(std::size_t size)
+{
+    if (size > std::numeric_limits<PointsOctree::index_type>::max()) {
+        throw Base::ValueError("Too many points for an octree");
+    }
+}
+}  // namespace
+
+PointsOctree::PointsOctree(const PointKernel& kernel, unsigned int leafSize)
+    : _leafSize(std::max(leafSize, 1U))
+{
+    checkSize(kernel.size());
+
+    std::vector<Base::Vector3f> points(kernel.size());
+    Base::Matrix4D mat = kernel.getTransform();
+    std::size_t offset = 0;
+    kernel.forEachRange([&](const PointKernel::value_type* pnts, PointKernel::size_type num) {
+        Base::Vector3f* dst = points.data() + offset;
+        forEachBlock(num, [&mat, pnts, dst](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                mat.multVec(pnts[i], dst[i]);
+            }
+        });
+        offset += num;
+    });
+
+    build(points);
+}
+
+PointsOctree::PointsOctree(const std::vector<Base::Vector3f>& points, unsigned int leafSize)
+    : _leafSize(std::max(leafSize, 1U))
+{
+    checkSize(points.size());
+    build(points);
+}
+
+void PointsOctree::build(const std::vector<Base::Vector3f>& points)
+{
+    std::size_t count = points.size();
+    if (count == 0) {
+        return;
+    }
+
+    Base::BoundBox3f box;
+    std::mutex mutex;
+    forEachBlock(count, [&](std::size_t begin, std::size_t end) {
+        Base::BoundBox3f part(&points[begin], end - begin);
+        std::lock_guard<std::mutex> lock(mutex);
+        box.Add(part);
+    });
+
+    // quantize the points on a cube around the bounding box
+    double extent = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    double scale = extent > 0.0 ? double(MaxCells) / extent : 0.0;
+    auto quantize = [scale](float value, float min) {
+        auto cell = static_cast<std::uint64_t>((double(value) - min) * scale);
+        return std::min(cell, MaxCells - 1);
+    };
+
+    std::vector<std::pair<std::uint64_t, index_type>> keys(count);
+    forEachBlock(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const Base::Vector3f& pnt = points[i];
+            keys[i].first = mortonCode(quantize(pnt.x, box.MinX),
+                                       quantize(pnt.y, box.MinY),
+                                       quantize(pnt.z, box.MinZ));
+            keys[i].second = static_cast<index_type>(i);
+        }
+    });
+    parallelSort(keys);
+
+    std::vector<std::uint64_t> codes(count);
+    _points.resize(count);
+    _indices.resize(count);
+    forEachBlock(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            codes[i] = keys[i].first;
+            _indices[i] = keys[i].second;
+            _points[i] = points[keys[i].second];
+        }
+    });
+    std::vector<std::pair<std::uint64_t, index_type>>().swap(keys);
+
+    Node root;
+    root.end = static_cast<index_type>(count);
+    _nodes.push_back(root);
+    subdivide(codes, 0, 0);
+}
+
+void PointsOctree::subdivide(const std::vector<std::uint64_t>& codes,
+                             index_type index,
+                             unsigned int depth)
+{
+    index_type begin = _nodes[index].begin;
+    index_type end = _nodes[index].end;
+
+    // Octants without points are skipped and a level where all points fall into the same octant
+    // doesn't create a node. The codes of a node share the bits above the level, so the octant
+    // numbers are ascending.
+    std::vector<std::pair<index_type, index_type>> ranges;
+    if (end - begin > _leafSize) {
+        for (; depth < MaxDepth; depth++) {
+            unsigned int shift = 3 * (MaxDepth - 1 - depth);
+            ranges.clear();
+            index_type first = begin;
+            for (std::uint64_t octant = 0; octant < 8 && first < end; octant++) {
+                auto it = std::upper_bound(codes.begin() + first,
+                                           codes.begin() + end,
+                                           octant,
+                                           [shift](std::uint64_t value, std::uint64_t code) {
+                                               return value < ((code >> shift) & 7);
+                                           });
+                auto last = static_cast<index_type>(it - codes.begin());
+                if (last > first) {
+                    ranges.emplace_back(first, last);
+                }
+                first = last;
+            }
+            if (ranges.size() > 1) {
+                break;
+            }
+        }
+    }
+
+    if (ranges.size() < 2) {
+        _nodes[index].box = computeBoundBox(begin, end);
+        return;
+    }
+
+    auto firstChild = static_cast<index_type>(_nodes.size());
+    _nodes[index].firstChild = firstChild;
+    _nodes[index].countChildren = static_cast<unsigned char>(ranges.size());
+    for (const auto& it : ranges) {
+        Node child;
+        child.begin = it.first;
+        child.end = it.second;
+        _nodes.push_back(child);
+    }
+
+    Base::BoundBox3f box;
+    for (std::size_t i = 0; i < ranges.size(); i++) {
+        auto child = static_cast<index_type>(firstChild + i);
+        subdivide(codes, child, depth + 1);
+        box.Add(_nodes[child].box);
+    }
+    _nodes[index].box = box;
+}
+
+Base::BoundBox3f PointsOctree::computeBoundBox(index_type begin, index_type end) const
+{
+    return Base::BoundBox3f(&_points[begin], end - begin);
+}
+
+Base::BoundBox3d PointsOctree::getBoundBox() const
+{
+    if (_nodes.empty()) {
+        return Base::BoundBox3d();
+    }
+
+    const Base::BoundBox3f& box = _nodes.front().box;
+    return Base::BoundBox3d(box.MinX, box.MinY, box.MinZ, box.MaxX, box.MaxY, box.MaxZ);
+}
+
+void PointsOctree::nearestNeighbours(const Base::Vector3d& pnt,
+                                     std::size_t k,
+                                     std::vector<index_type>& indices,
+                                     std::vector<double>& distances) const
+{
+    indices.clear();
+    distances.clear();
+    if (_nodes.empty() || k == 0) {
+        return;
+    }
+
+    // squared distance and node or point
+    using Candidate = std::pair<double, index_type>;
+    // the nodes are visited by increasing distance of their boxes
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> nodes;
+    // the farthest point found so far is on top
+    std::priority_queue<Candidate> best;
+
+    nodes.emplace(distanceSquared(_nodes.front().box, pnt), 0);
+    while (!nodes.empty()) {
+        Candidate next = nodes.top();
+        nodes.pop();
+        if (best.size() == k && next.first > best.top().first) {
+            break;
+        }
+
+        const Node& node = _nodes[next.second];
+        if (node.countChildren == 0) {
+            for (index_type i = node.begin; i < node.end; i++) {
+                double dist = distanceSquared(_points[i], pnt);
+                if (best.size() < k) {
+                    best.emplace(dist, i);
+                }
+                else if (dist < best.top().first) {
+                    best.pop();
+                    best.emplace(dist, i);
+                }
+            }
+        }
+        else {
+            for (index_type i = 0; i < node.countChildren; i++) {
+                index_type child = node.firstChild + i;
+                double dist = distanceSquared(_nodes[child].box, pnt);
+                if (best.size() < k || dist <= best.top().first) {
+                    nodes.emplace(dist, child);
+                }
+            }
+        }
+    }
+
+    indices.resize(best.size());
+    distances.resize(best.size());
+    for (std::size_t i = best.size(); i > 0; i--) {
+        indices[i - 1] = _indices[best.top().second];
+        distances[i - 1] = std::sqrt(best.top().first);
+        best.pop();
+    }
+}
+
+void PointsOctree::radiusSearch(const Base::Vector3d& pnt,
+                                double radius,
+                                std::vector<index_type>& indices) const
+{
+    indices.clear();
+    if (_nodes.empty() || radius < 0.0) {
+        return;
+    }
+
+    double radius2 = radius * radius;
+    std::vector<index_type> stack {0};
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (distanceSquared(node.box, pnt) > radius2) {
+            continue;
+        }
+
+        if (maxDistanceSquared(node.box, pnt) <= radius2) {
+            // the whole node is inside the sphere
+            indices.insert(indices.end(),
+                           _indices.begin() + node.begin,
+                           _indices.begin() + node.end);
+        }
+        else if (node.countChildren == 0) {
+            for (index_type i = node.begin; i < node.end; i++) {
+                if (distanceSquared(_points[i], pnt) <= radius2) {
+                    indices.push_back(_indices[i]);
+                }
+            }
+        }
+        else {
+            for (index_type i = 0; i < node.countChildren; i++) {
+                stack.push_back(node.firstChild + i);
+            }
+        }
+    }
+}
+
+void PointsOctree::checkCellSize(double cellSize) const
+{
+    if (!(cellSize > 0.0)) {
+        throw Base::ValueError("Cell size must be positive");
+    }
+
+    const Base::BoundBox3f& box = _nodes.front().box;
+    double extent = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    // one more cell is needed for the neighbourhood
+    if (extent / cellSize >= double(MaxCells - 2)) {
+        throw Base::ValueError("Cell size is too small for the extent of the points");
+    }
+}
+
+std::vector<PointsOctree::index_type> PointsOctree::voxelSample(double cellSize) const
+{
+    std::vector<index_type> result;
+    if (_nodes.empty()) {
+        return result;
+    }
+    checkCellSize(cellSize);
+
+    const Base::BoundBox3f& box = _nodes.front().box;
+    std::vector<std::pair<std::uint64_t, index_type>> keys(_points.size());
+    forEachBlock(_points.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            auto cell = cellIndex(box, _points[i], cellSize);
+            keys[i].first = mortonCode(cell[0], cell[1], cell[2]);
+            keys[i].second = static_cast<index_type>(i);
+        }
+    });
+    parallelSort(keys);
+
+    for (std::size_t first = 0; first < keys.size();) {
+        std::size_t last = first + 1;
+        while (last < keys.size() && keys[last].first == keys[first].first) {
+            last++;
+        }
+
+        Base::Vector3d center;
+        for (std::size_t i = first; i < last; i++) {
+            const Base::Vector3f& pnt = _points[keys[i].second];
+            center += Base::Vector3d(pnt.x, pnt.y, pnt.z);
+        }
+        center /= double(last - first);
+
+        index_type closest = keys[first].second;
+        double minDist = std::numeric_limits<double>::max();
+        for (std::size_t i = first; i < last; i++) {
+            double dist = distanceSquared(_points[keys[i].second], center);
+            if (dist < minDist) {
+                minDist = dist;
+                closest = keys[i].second;
+            }
+        }
+
+        result.push_back(_indices[closest]);
+        first = last;
+    }
+
+    return result;
+}
+
+std::vector<PointsOctree::index_type> PointsOctree::poissonDiskSample(double radius) const
+{
+    std::vector<index_type> result;
+    if (_nodes.empty()) {
+        return result;
+    }
+    checkCellSize(radius);
+
+    // With the radius as cell size the conflicting points lie in the neighbour cells
+    const Base::BoundBox3f& box = _nodes.front().box;
+    auto key = [](std::uint64_t x, std::uint64_t y, std::uint64_t z) {
+        return x | y << MaxDepth | z << (2 * MaxDepth);
+    };
+    std::unordered_map<std::uint64_t, std::vector<index_type>> kept;
+    double radius2 = radius * radius;
+
+    auto isFree = [&](index_type index, const std::array<std::uint64_t, 3>& cell) {
+        Base::Vector3d pnt(_points[index].x, _points[index].y, _points[index].z);
+        for (std::uint64_t x = std::max<std::uint64_t>(cell[0], 1) - 1; x <= cell[0] + 1; x++) {
+            for (std::uint64_t y = std::max<std::uint64_t>(cell[1], 1) - 1; y <= cell[1] + 1; y++) {
+                for (std::uint64_t z = std::max<std::uint64_t>(cell[2], 1) - 1; z <= cell[2] + 1;
+                     z++) {
+                    auto it = kept.find(key(x, y, z));
+                    if (it == kept.end()) {
+                        continue;
+                    }
+                    for (index_type other : it->second) {
+                        if (distanceSquared(_points[other], pnt) < radius2) {
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    };
+
+    for (std::size_t i = 0; i < _points.size(); i++) {
+        auto index = static_cast<index_type>(i);
+        auto cell = cellIndex(box, _points[i], radius);
+        if (isFree(index, cell)) {
+            kept[key(cell[0], cell[1], cell[2])].push_back(index);
+            result.push_back(_indices[i]);
+        }
+    }
+
+    return result;
+}
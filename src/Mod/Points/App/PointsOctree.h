@@ -0,0 +1,135 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef POINTS_OCTREE_H
+#define POINTS_OCTREE_H
+
+#include <cstdint>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+
+#include "Points.h"
+
+
+namespace Points
+{
+
+/**
+ * The PointsOctree is an adaptive spatial index of a point cloud. Unlike the PointsGrid, whose
+ * cells all have the same size, a node is only subdivided as long as it holds more than a given
+ * number of points. So the octree works well for clouds of very non-uniform density like scans
+ * where the points near the scanner are much denser than the far ones.
+ *
+ * The points are sorted along a Morton (Z-order) curve while building the index. Each node refers
+ * to a contiguous range of this order and keeps the tight bounding box of its points. The octree
+ * holds its own copy of the transformed points in this order, so a query touches only a few
+ * contiguous blocks of memory. The returned indices refer to the points of the source.
+ */
+class PointsExport PointsOctree
+{
+public:
+    using index_type = std::uint32_t;
+
+    /// default number of points a leaf may hold
+    static constexpr unsigned int DefaultLeafSize = 32;
+    /// maximum depth of the tree, 21 levels per axis fit into a 64-bit Morton code
+    static constexpr unsigned int MaxDepth = 21;
+
+    /** @name Construction */
+    //@{
+    /** Builds the octree of the transformed points of \a kernel. An out-of-core kernel is read
+     * range by range and not loaded into memory. */
+    explicit PointsOctree(const PointKernel& kernel, unsigned int leafSize = DefaultLeafSize);
+    explicit PointsOctree(const std::vector<Base::Vector3f>& points,
+                          unsigned int leafSize = DefaultLeafSize);
+    //@}
+
+    /** Returns the number of indexed points. */
+    std::size_t size() const
+    {
+        return _points.size();
+    }
+    /** Returns the number of nodes including the leaves. */
+    std::size_t countNodes() const
+    {
+        return _nodes.size();
+    }
+    /** Returns the bounding box of all points. */
+    Base::BoundBox3d getBoundBox() const;
+
+    /** @name Search */
+    //@{
+    /** Searches for the \a k nearest points of \a pnt. The indices and distances are sorted by
+     * increasing distance. Fewer than \a k points are returned only if the cloud is smaller. */
+    void nearestNeighbours(const Base::Vector3d& pnt,
+                           std::size_t k,
+                           std::vector<index_type>& indices,
+                           std::vector<double>& distances) const;
+    /** Searches for all points whose distance to \a pnt is not greater than \a radius. The
+     * indices are not sorted. */
+    void radiusSearch(const Base::Vector3d& pnt,
+                      double radius,
+                      std::vector<index_type>& indices) const;
+    //@}
+
+    /** @name Downsampling */
+    //@{
+    /** Divides the bounding box into cubes of the edge length \a cellSize and keeps the point
+     * closest to the centroid of each occupied cube. The indices of the kept points are
+     * returned, so colors or normals can be taken over. */
+    std::vector<index_type> voxelSample(double cellSize) const;
+    /** Selects a subset of the points in which no two points are closer than \a radius and where
+     * each removed point has a kept point within \a radius. The points are visited along the
+     * Morton curve so the result is reproducible. */
+    std::vector<index_type> poissonDiskSample(double radius) const;
+    //@}
+
+private:
+    struct Node
+    {
+        Base::BoundBox3f box;
+        // range in the sorted points
+        index_type begin = 0;
+        index_type end = 0;
+        // the children are stored consecutively, a leaf has none
+        index_type firstChild = 0;
+        unsigned char countChildren = 0;
+    };
+
+    void build(const std::vector<Base::Vector3f>& points);
+    void subdivide(const std::vector<std::uint64_t>& codes, index_type index, unsigned int depth);
+    Base::BoundBox3f computeBoundBox(index_type begin, index_type end) const;
+    void checkCellSize(double cellSize) const;
+
+private:
+    unsigned int _leafSize;
+    std::vector<Base::Vector3f> _points;
+    std::vector<index_type> _indices;
+    std::vector<Node> _nodes;
+};
+
+}  // namespace Points
+
+#endif  // POINTS_OCTREE_H
@@ -31,6 +31,7 @@
 #include <Base/VectorPy.h>
 
 #include "Points.h"
+#include "PointsOctree.h"
 // inclusion of the generated files (generated out of PointsPy.xml)
 #include "PointsPy.h"
 #include "PointsPy.cpp"
@@ -38,6 +39,47 @@
 
 using namespace Points;
 
+namespace
+{
+PointKernel* copyPoints(const PointKernel& kernel,
+                        const std::vector<PointsOctree::index_type>& indices)
+{
+    std::unique_ptr<PointKernel> pts(new PointKernel());
+    pts->reserve(indices.size());
+    for (auto index : indices) {
+        pts->push_back(kernel.getPoint(index));
+    }
+    return pts.release();
+}
+
+// Accepts a single vector or a sequence of vectors so that one octree answers all queries
+std::vector<Base::Vector3d> getQueryPoints(PyObject* obj, bool& single)
+{
+    std::vector<Base::Vector3d> points;
+    single = PyObject_TypeCheck(obj, &Base::VectorPy::Type);
+    if (single) {
+        points.push_back(*static_cast<Base::VectorPy*>(obj)->getVectorPtr());
+    }
+    else {
+        Py::Sequence list(obj);
+        points.reserve(list.size());
+        for (const auto& item : list) {
+            points.push_back(Py::Vector(item).toVector());
+        }
+    }
+    return points;
+}
+
+Py::List toIndexList(const std::vector<PointsOctree::index_type>& indices)
+{
+    Py::List indexList;
+    for (auto index : indices) {
+        indexList.append(Py::Long(static_cast<unsigned long>(index)));
+    }
+    return indexList;
+}
+}  // namespace
+
 // returns a string which represents the object e.g. when printed in python
 std::string PointsPy::representation() const
 {
@@ -242,6 +284,103 @@ PyObject* PointsPy::fromValid(PyObject* args)
     }
 }
 
+PyObject* PointsPy::nearestNeighbours(PyObject* args)
+{
+    PyObject* obj {};
+    Py_ssize_t count = 1;
+    if (!PyArg_ParseTuple(args, "O|n", &obj, &count)) {
+        return nullptr;
+    }
+    if (count < 1) {
+        PyErr_SetString(PyExc_ValueError, "number of neighbours must be positive");
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        bool single {};
+        std::vector<Base::Vector3d> pnts = getQueryPoints(obj, single);
+        PointsOctree octree(*getPointKernelPtr());
+        std::vector<PointsOctree::index_type> indices;
+        std::vector<double> distances;
+
+        Py::List result;
+        for (const auto& pnt : pnts) {
+            octree.nearestNeighbours(pnt, static_cast<std::size_t>(count), indices, distances);
+            Py::List distanceList;
+            for (double distance : distances) {
+                distanceList.append(Py::Float(distance));
+            }
+            result.append(Py::TupleN(toIndexList(indices), distanceList));
+        }
+        if (single) {
+            return Py::new_reference_to(Py::Object(result[0]));
+        }
+        return Py::new_reference_to(result);
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::radiusSearch(PyObject* args)
+{
+    PyObject* obj {};
+    double radius {};
+    if (!PyArg_ParseTuple(args, "Od", &obj, &radius)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        bool single {};
+        std::vector<Base::Vector3d> pnts = getQueryPoints(obj, single);
+        PointsOctree octree(*getPointKernelPtr());
+        std::vector<PointsOctree::index_type> indices;
+
+        Py::List result;
+        for (const auto& pnt : pnts) {
+            octree.radiusSearch(pnt, radius, indices);
+            result.append(toIndexList(indices));
+        }
+        if (single) {
+            return Py::new_reference_to(Py::Object(result[0]));
+        }
+        return Py::new_reference_to(result);
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::voxelSample(PyObject* args)
+{
+    double cellSize {};
+    if (!PyArg_ParseTuple(args, "d", &cellSize)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const PointKernel* points = getPointKernelPtr();
+        PointsOctree octree(*points);
+        return new PointsPy(copyPoints(*points, octree.voxelSample(cellSize)));
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::poissonDiskSample(PyObject* args)
+{
+    double radius {};
+    if (!PyArg_ParseTuple(args, "d", &radius)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const PointKernel* points = getPointKernelPtr();
+        PointsOctree octree(*points);
+        return new PointsPy(copyPoints(*points, octree.poissonDiskSample(radius)));
+    }
+    PY_CATCH;
+}
+
 Py::Long PointsPy::getCountPoints() const
 {
     return Py::Long((long)getPointKernelPtr()->size());
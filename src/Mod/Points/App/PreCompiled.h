@@ -39,11 +39,16 @@
 
 // STL
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <set>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 // boost
@@ -53,8 +58,16 @@
 #include <boost/regex.hpp>
 
 // Qt
+#include <QThread>
 #include <QtConcurrentMap>
 
+#ifdef FC_OS_WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
 #endif  //_PreComp_
 
 #endif
@@ -76,6 +76,7 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool deferDocFile(const std::shared_ptr<Base::DeferredFile>& file) override;
     //@}
 
     /** @name Modification */
@@ -87,6 +88,9 @@ public:
     void removeIndices(const std::vector<unsigned long>&);
     //@}
 
+protected:
+    void restoreDeferredFile(Base::Reader& reader) override;
+
 private:
     Base::Reference<PointKernel> _cPoints;
 };
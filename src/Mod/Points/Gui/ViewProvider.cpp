@@ -712,14 +712,13 @@ void ViewProviderPointsBuilder::createPoints(const App::Property* prop,
     coords->point.setNum(cPts.size());
     SbVec3f* vec = coords->point.startEditing();
 
-    // get all points
+    // get all points, an out-of-core kernel is not loaded into memory
     std::size_t idx = 0;
-    const std::vector<Points::PointKernel::value_type>& kernel = cPts.getBasicPoints();
-    for (std::vector<Points::PointKernel::value_type>::const_iterator it = kernel.begin();
-         it != kernel.end();
-         ++it, idx++) {
-        vec[idx].setValue(it->x, it->y, it->z);
-    }
+    cPts.forEachRange([vec, &idx](const Points::PointKernel::value_type* pnts, std::size_t num) {
+        for (std::size_t i = 0; i < num; i++, idx++) {
+            vec[idx].setValue(pnts[i].x, pnts[i].y, pnts[i].z);
+        }
+    });
 
     points->numPoints = cPts.size();
     coords->point.finishEditing();
@@ -740,17 +739,18 @@ void ViewProviderPointsBuilder::createPoints(const App::Property* prop,
     std::size_t idx = 0;
     std::vector<int32_t> indices;
     indices.reserve(cPts.size());
-    const std::vector<Points::PointKernel::value_type>& kernel = cPts.getBasicPoints();
-    for (std::vector<Points::PointKernel::value_type>::const_iterator it = kernel.begin();
-         it != kernel.end();
-         ++it, idx++) {
-        vec[idx].setValue(it->x, it->y, it->z);
-        // valid point?
-        if (!(boost::math::isnan(it->x) || boost::math::isnan(it->y)
-              || boost::math::isnan(it->z))) {
-            indices.push_back(idx);
+    cPts.forEachRange([vec, &idx, &indices](const Points::PointKernel::value_type* pnts,
+                                            std::size_t num) {
+        for (std::size_t i = 0; i < num; i++, idx++) {
+            const Points::PointKernel::value_type& pnt = pnts[i];
+            vec[idx].setValue(pnt.x, pnt.y, pnt.z);
+            // valid point?
+            if (!(boost::math::isnan(pnt.x) || boost::math::isnan(pnt.y)
+                  || boost::math::isnan(pnt.z))) {
+                indices.push_back(idx);
+            }
         }
-    }
+    });
     coords->point.finishEditing();
 
     // get all point indices
@@ -382,8 +382,11 @@ private:
             std::vector<Base::Vector3f> pts;
             if (PyObject_TypeCheck(o, &(Points::PointsPy::Type))) {
                 Points::PointsPy* pPoints = static_cast<Points::PointsPy*>(o);
-                Points::PointKernel* points = pPoints->getPointKernelPtr();
-                pts = points->getBasicPoints();
+                const Points::PointKernel* points = pPoints->getPointKernelPtr();
+                pts.reserve(points->size());
+                points->forEachRange([&pts](const Base::Vector3f* pnts, std::size_t num) {
+                    pts.insert(pts.end(), pnts, pnts + num);
+                });
             }
             else if (PyObject_TypeCheck(o, &(Mesh::MeshPy::Type))) {
                 const Mesh::MeshObject* mesh = static_cast<Mesh::MeshPy*>(o)->getMeshObjectPtr();
@@ -731,6 +734,8 @@ Mesh.show(m)
             throw Py::Exception();
 
         Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+        // the fitting needs all points in memory
+        points->setOutOfCore(false);
 
         BSplineFitting fit(points->getBasicPoints());
         fit.setOrder(degree+1);
@@ -112,16 +112,17 @@ void RegionGrowing::perform(const std::vector<Base::Vector3f>& myNormals)
     pcl::PointCloud<pcl::Normal>::Ptr normals(new pcl::PointCloud<pcl::Normal>);
     normals->reserve(myNormals.size());
 
-    std::size_t num_points = myPoints.size();
-    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
-    for (std::size_t index = 0; index < num_points; index++) {
-        const Base::Vector3f& p = points[index];
-        const Base::Vector3f& n = myNormals[index];
-        if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
-            cloud->push_back(pcl::PointXYZ(p.x, p.y, p.z));
-            normals->push_back(pcl::Normal(n.x, n.y, n.z));
+    std::size_t index = 0;
+    myPoints.forEachRange([&](const Base::Vector3f* points, std::size_t num_points) {
+        for (std::size_t i = 0; i < num_points; i++, index++) {
+            const Base::Vector3f& p = points[i];
+            const Base::Vector3f& n = myNormals[index];
+            if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
+                cloud->push_back(pcl::PointXYZ(p.x, p.y, p.z));
+                normals->push_back(pcl::Normal(n.x, n.y, n.z));
+            }
         }
-    }
+    });
 
     pcl::search::Search<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
     tree->setInputCloud(cloud);
@@ -141,22 +141,23 @@ void SurfaceTriangulation::perform(const std::vector<Base::Vector3f>& normals)
     search::KdTree<PointNormal>::Ptr tree;
 
     cloud_with_normals->reserve(myPoints.size());
-    std::size_t num_points = myPoints.size();
-    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
-    for (std::size_t index = 0; index < num_points; index++) {
-        const Base::Vector3f& p = points[index];
-        const Base::Vector3f& n = normals[index];
-        if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
-            PointNormal pn;
-            pn.x = p.x;
-            pn.y = p.y;
-            pn.z = p.z;
-            pn.normal_x = n.x;
-            pn.normal_y = n.y;
-            pn.normal_z = n.z;
-            cloud_with_normals->push_back(pn);
+    std::size_t index = 0;
+    myPoints.forEachRange([&](const Base::Vector3f* points, std::size_t num_points) {
+        for (std::size_t i = 0; i < num_points; i++, index++) {
+            const Base::Vector3f& p = points[i];
+            const Base::Vector3f& n = normals[index];
+            if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
+                PointNormal pn;
+                pn.x = p.x;
+                pn.y = p.y;
+                pn.z = p.z;
+                pn.normal_x = n.x;
+                pn.normal_y = n.y;
+                pn.normal_z = n.z;
+                cloud_with_normals->push_back(pn);
+            }
         }
-    }
+    });
 
     // Create search tree
     tree.reset(new search::KdTree<PointNormal>);
@@ -268,22 +269,23 @@ void PoissonReconstruction::perform(const std::vector<Base::Vector3f>& normals)
     search::KdTree<PointNormal>::Ptr tree;
 
     cloud_with_normals->reserve(myPoints.size());
-    std::size_t num_points = myPoints.size();
-    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
-    for (std::size_t index = 0; index < num_points; index++) {
-        const Base::Vector3f& p = points[index];
-        const Base::Vector3f& n = normals[index];
-        if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
-            PointNormal pn;
-            pn.x = p.x;
-            pn.y = p.y;
-            pn.z = p.z;
-            pn.normal_x = n.x;
-            pn.normal_y = n.y;
-            pn.normal_z = n.z;
-            cloud_with_normals->push_back(pn);
+    std::size_t index = 0;
+    myPoints.forEachRange([&](const Base::Vector3f* points, std::size_t num_points) {
+        for (std::size_t i = 0; i < num_points; i++, index++) {
+            const Base::Vector3f& p = points[i];
+            const Base::Vector3f& n = normals[index];
+            if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
+                PointNormal pn;
+                pn.x = p.x;
+                pn.y = p.y;
+                pn.z = p.z;
+                pn.normal_x = n.x;
+                pn.normal_y = n.y;
+                pn.normal_z = n.z;
+                cloud_with_normals->push_back(pn);
+            }
         }
-    }
+    });
 
     // Create search tree
     tree.reset(new search::KdTree<PointNormal>);
@@ -382,22 +384,23 @@ void GridReconstruction::perform(const std::vector<Base::Vector3f>& normals)
     search::KdTree<PointNormal>::Ptr tree;
 
     cloud_with_normals->reserve(myPoints.size());
-    std::size_t num_points = myPoints.size();
-    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
-    for (std::size_t index = 0; index < num_points; index++) {
-        const Base::Vector3f& p = points[index];
-        const Base::Vector3f& n = normals[index];
-        if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
-            PointNormal pn;
-            pn.x = p.x;
-            pn.y = p.y;
-            pn.z = p.z;
-            pn.normal_x = n.x;
-            pn.normal_y = n.y;
-            pn.normal_z = n.z;
-            cloud_with_normals->push_back(pn);
+    std::size_t index = 0;
+    myPoints.forEachRange([&](const Base::Vector3f* points, std::size_t num_points) {
+        for (std::size_t i = 0; i < num_points; i++, index++) {
+            const Base::Vector3f& p = points[i];
+            const Base::Vector3f& n = normals[index];
+            if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
+                PointNormal pn;
+                pn.x = p.x;
+                pn.y = p.y;
+                pn.z = p.z;
+                pn.normal_x = n.x;
+                pn.normal_y = n.y;
+                pn.normal_z = n.z;
+                cloud_with_normals->push_back(pn);
+            }
         }
-    }
+    });
 
     // Create search tree
     tree.reset(new search::KdTree<PointNormal>);
@@ -445,18 +448,16 @@ void ImageTriangulation::perform()
     cloud_organized->height = height;
     cloud_organized->points.resize(cloud_organized->width * cloud_organized->height);
 
-    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
-
-    int npoints = 0;
-    for (size_t i = 0; i < cloud_organized->height; i++) {
-        for (size_t j = 0; j < cloud_organized->width; j++) {
-            const Base::Vector3f& p = points[npoints];
+    std::size_t npoints = 0;
+    myPoints.forEachRange([&](const Base::Vector3f* points, std::size_t num_points) {
+        for (std::size_t i = 0; i < num_points; i++) {
+            const Base::Vector3f& p = points[i];
             cloud_organized->points[npoints].x = p.x;
             cloud_organized->points[npoints].y = p.y;
             cloud_organized->points[npoints].z = p.z;
             npoints++;
         }
-    }
+    });
 
     OrganizedFastMesh<PointXYZ> ofm;
 
@@ -574,22 +575,23 @@ void Reen::MarchingCubesRBF::perform(const std::vector<Base::Vector3f>& normals)
     search::KdTree<PointNormal>::Ptr tree;
 
     cloud_with_normals->reserve(myPoints.size());
-    std::size_t num_points = myPoints.size();
-    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
-    for (std::size_t index = 0; index < num_points; index++) {
-        const Base::Vector3f& p = points[index];
-        const Base::Vector3f& n = normals[index];
-        if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
-            PointNormal pn;
-            pn.x = p.x;
-            pn.y = p.y;
-            pn.z = p.z;
-            pn.normal_x = n.x;
-            pn.normal_y = n.y;
-            pn.normal_z = n.z;
-            cloud_with_normals->push_back(pn);
+    std::size_t index = 0;
+    myPoints.forEachRange([&](const Base::Vector3f* points, std::size_t num_points) {
+        for (std::size_t i = 0; i < num_points; i++, index++) {
+            const Base::Vector3f& p = points[i];
+            const Base::Vector3f& n = normals[index];
+            if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
+                PointNormal pn;
+                pn.x = p.x;
+                pn.y = p.y;
+                pn.z = p.z;
+                pn.normal_x = n.x;
+                pn.normal_y = n.y;
+                pn.normal_z = n.z;
+                cloud_with_normals->push_back(pn);
+            }
         }
-    }
+    });
 
     // Create search tree
     tree.reset(new search::KdTree<PointNormal>);
@@ -685,22 +687,23 @@ void Reen::MarchingCubesHoppe::perform(const std::vector<Base::Vector3f>& normal
     search::KdTree<PointNormal>::Ptr tree;
 
     cloud_with_normals->reserve(myPoints.size());
-    std::size_t num_points = myPoints.size();
-    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
-    for (std::size_t index = 0; index < num_points; index++) {
-        const Base::Vector3f& p = points[index];
-        const Base::Vector3f& n = normals[index];
-        if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
-            PointNormal pn;
-            pn.x = p.x;
-            pn.y = p.y;
-            pn.z = p.z;
-            pn.normal_x = n.x;
-            pn.normal_y = n.y;
-            pn.normal_z = n.z;
-            cloud_with_normals->push_back(pn);
+    std::size_t index = 0;
+    myPoints.forEachRange([&](const Base::Vector3f* points, std::size_t num_points) {
+        for (std::size_t i = 0; i < num_points; i++, index++) {
+            const Base::Vector3f& p = points[i];
+            const Base::Vector3f& n = normals[index];
+            if (!boost::math::isnan(p.x) && !boost::math::isnan(p.y) && !boost::math::isnan(p.z)) {
+                PointNormal pn;
+                pn.x = p.x;
+                pn.y = p.y;
+                pn.z = p.z;
+                pn.normal_x = n.x;
+                pn.normal_y = n.y;
+                pn.normal_z = n.z;
+                cloud_with_normals->push_back(pn);
+            }
         }
-    }
+    });
 
     // Create search tree
     tree.reset(new search::KdTree<PointNormal>);
@@ -195,7 +195,8 @@ bool Sketch::analyseBlockedGeometry(const std::vector<Part::Geometry*>& internal
 
 int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
                         const std::vector<Constraint*>& ConstraintList,
-                        int extGeoCount)
+                        int extGeoCount,
+                        bool reuseDiagnosis)
 {
     Base::TimeElapsed start_time;
 
@@ -271,7 +272,9 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
     clearTemporaryConstraints();
     GCSsys.declareUnknowns(Parameters);
     GCSsys.declareDrivenParams(DrivenParameters);
+    GCSsys.reuseDiagnosis = reuseDiagnosis;
     GCSsys.initSolution(defaultSolverRedundant);
+    GCSsys.reuseDiagnosis = false;
 
     // Post-analysis
     // Now that we have all the parameters information, we deal properly with the block constraints
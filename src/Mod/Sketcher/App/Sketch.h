@@ -73,10 +73,15 @@ public:
      * an over-constrained sketch will always contain conflicting constraints
      * a fully constrained or under-constrained sketch may contain conflicting
      * constraints or may not
+     *
+     * if reuseDiagnosis is true, the diagnosis of the previous set up is kept when the geometry
+     * and constraints have the same topology. This is only valid if the geometry was just moved
+     * since then (e.g. by dragging), which can't change the degrees of freedom.
      */
     int setUpSketch(const std::vector<Part::Geometry*>& GeoList,
                     const std::vector<Constraint*>& ConstraintList,
-                    int extGeoCount = 0);
+                    int extGeoCount = 0,
+                    bool reuseDiagnosis = false);
     /// return the actual geometry of the sketch a TopoShape
     Part::TopoShape toShape() const;
     /// add unspecified geometry
@@ -618,6 +623,10 @@ public:
     {
         GCSsys.dogLegGaussStep = mode;
     }
+    inline void setJacobianMatrix(GCS::JacobianMatrix mode)
+    {
+        GCSsys.jacobianMatrix = mode;
+    }
     inline void setDebugMode(GCS::DebugMode mode)
     {
         debugMode = mode;
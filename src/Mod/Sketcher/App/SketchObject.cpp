@@ -184,6 +184,7 @@ SketchObject::SketchObject()
     lastSolveTime = 0;
 
     solverNeedsUpdate = false;
+    solverDiagnosisReusable = false;
 
     noRecomputes = false;
 
@@ -503,8 +504,12 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
     // happened therefore we update our sketch solver geometry with the SketchObject one.
     //
     // set up a sketch (including dofs counting and diagnosing of conflicts)
-    lastDoF = solvedSketch.setUpSketch(
-        getCompleteGeometry(), Constraints.getValues(), getExternalGeometryCount());
+    lastDoF = solvedSketch.setUpSketch(getCompleteGeometry(),
+                                       Constraints.getValues(),
+                                       getExternalGeometryCount(),
+                                       solverDiagnosisReusable);
+
+    solverDiagnosisReusable = false;
 
     // At this point we have the solver information about conflicting/redundant/over-constrained,
     // but the sketch is NOT solved. Some examples: Redundant: a vertical line, a horizontal line
@@ -1368,6 +1373,9 @@ int SketchObject::movePoint(int GeoId, PointPos PosId, const Base::Vector3d& toP
             if (*it)
                 delete *it;
         }
+
+        // set after the change of Geometry, which resets it
+        solverDiagnosisReusable = true;
     }
 
     solvedSketch.resetInitMove();// reset solver point moving mechanism
@@ -10046,6 +10054,8 @@ void SketchObject::onChanged(const App::Property* prop)
     auto doc = getDocument();
 
     if (prop == &Geometry || prop == &Constraints) {
+        solverDiagnosisReusable = false;
+
         if (doc && doc->isPerformingTransaction()) {// undo/redo
             setStatus(App::PendingTransactionUpdate, true);
         }
@@ -938,6 +938,12 @@ private:
     */
     bool solverNeedsUpdate;
 
+    /** this internal flag indicates that the only change since the last set up of the solver is
+       a move of the geometry by the solver (movePoint), which can't change the DoF or the
+       conflicting/redundant constraints, so the next solve() can keep the solver diagnosis.
+    */
+    bool solverDiagnosisReusable;
+
     int lastDoF;
     bool lastHasConflict;
     bool lastHasRedundancies;
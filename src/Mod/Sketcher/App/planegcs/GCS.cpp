@@ -471,6 +471,8 @@ System::System()
     , hasDiagnosis(false)
     , isInit(false)
     , emptyDiagnoseMatrix(true)
+    , diagnosedDofs(0)
+    , diagnosedEmptyMatrix(true)
     , maxIter(100)
     , maxIterRedundant(100)
     , sketchSizeMultiplier(false)
@@ -479,8 +481,10 @@ System::System()
     , convergenceRedundant(1e-10)
     , qrAlgorithm(EigenSparseQR)
     , dogLegGaussStep(FullPivLU)
+    , jacobianMatrix(EigenDenseJacobian)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
+    , reuseDiagnosis(false)
     , LM_eps(1E-10)
     , LM_eps1(1E-80)
     , LM_tau(1E-3)
@@ -533,6 +537,7 @@ void System::clear()
 void System::invalidatedDiagnosis()
 {
     hasDiagnosis = false;
+    diagnosedTopology.clear();
     pDependentParameters.clear();
     pDependentParametersGroups.clear();
 }
@@ -2158,8 +2163,143 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+namespace
+{
+// The parts of solve_LM_impl and solve_DL_impl that differ between the dense and the sparse
+// Jacobian
+
+void setDiagonal(Eigen::MatrixXd& A, const Eigen::VectorXd& diag)
+{
+    A.diagonal() = diag;
+}
+
+void solveAugmentedNormalEquations(const Eigen::MatrixXd& A,
+                                   const Eigen::VectorXd& g,
+                                   Eigen::VectorXd& h)
+{
+    h = A.fullPivLu().solve(g);
+}
+
+void solveGaussStep(const Eigen::MatrixXd& Jx,
+                    const Eigen::VectorXd& fx,
+                    DogLegGaussStep gaussStep,
+                    Eigen::VectorXd& h_gn)
+{
+    // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+    // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+    switch (gaussStep) {
+        case FullPivLU:
+            h_gn = Jx.fullPivLu().solve(-fx);
+            break;
+        case LeastNormFullPivLU:
+            h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+            break;
+        case LeastNormLdlt:
+            h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+            break;
+    }
+}
+
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+using SparseMatrixType = Eigen::SparseMatrix<double>;
+
+void setDiagonal(SparseMatrixType& A, const Eigen::VectorXd& diag)
+{
+    // J^T J has a structurally non-zero diagonal, as every parameter of a subsystem appears in
+    // at least one constraint, so this doesn't insert new entries
+    for (int i = 0; i < diag.size(); ++i) {
+        A.coeffRef(i, i) = diag(i);
+    }
+}
+
+void solveAugmentedNormalEquations(const SparseMatrixType& A,
+                                   const Eigen::VectorXd& g,
+                                   Eigen::VectorXd& h)
+{
+    // A = J^T J + mu I is symmetric positive definite for mu > 0
+    Eigen::SimplicialLDLT<SparseMatrixType> ldlt(A);
+    if (ldlt.info() == Eigen::Success) {
+        h = ldlt.solve(g);
+    }
+    else {
+        // the caller rejects the step and increases the damping
+        h.setZero(g.size());
+    }
+}
+
+void solveGaussStep(const SparseMatrixType& Jx,
+                    const Eigen::VectorXd& fx,
+                    DogLegGaussStep gaussStep,
+                    Eigen::VectorXd& h_gn)
+{
+    // There is no sparse counterpart of the full pivoting LU. Instead the minimum norm solution
+    // of Jx * h_gn = -fx is obtained from a QR decomposition of Jx^T = Q R P^T, which also
+    // handles the rank deficient Jacobians of redundant constraints. The basic solution of a QR
+    // decomposition of Jx itself sets arbitrary parameters to zero and makes DogLeg stall in
+    // under-constrained sketches.
+    auto solveQR = [&]() {
+        SparseMatrixType JxT = Jx.transpose();
+        JxT.makeCompressed();
+        Eigen::SparseQR<SparseMatrixType, Eigen::COLAMDOrdering<int>> qr(JxT);
+        if (qr.info() != Eigen::Success) {
+            h_gn.setZero(Jx.cols());
+            return;
+        }
+        // R^T (Q^T h_gn) = P^T (-fx), only the first rank rows of R are non-zero
+        int rank = static_cast<int>(qr.rank());
+        Eigen::VectorXd b = qr.colsPermutation().transpose() * (-fx);
+        SparseMatrixType R = qr.matrixR().topLeftCorner(rank, rank);
+        Eigen::VectorXd z = Eigen::VectorXd::Zero(Jx.cols());
+        z.head(rank) = R.transpose().triangularView<Eigen::Lower>().solve(b.head(rank));
+        h_gn = qr.matrixQ() * z;
+    };
+
+    switch (gaussStep) {
+        case FullPivLU:
+            solveQR();
+            break;
+        // J J^T is singular for redundant constraints, which the sparse LU and LDLT don't
+        // always report, so their result is checked as well
+        case LeastNormFullPivLU: {
+            SparseMatrixType JJt = Jx * Jx.adjoint();
+            Eigen::SparseLU<SparseMatrixType, Eigen::COLAMDOrdering<int>> lu(JJt);
+            if (lu.info() == Eigen::Success) {
+                h_gn = Jx.adjoint() * lu.solve(-fx);
+            }
+            if (lu.info() != Eigen::Success || !h_gn.allFinite()) {
+                solveQR();
+            }
+            break;
+        }
+        case LeastNormLdlt: {
+            SparseMatrixType JJt = Jx * Jx.adjoint();
+            Eigen::SimplicialLDLT<SparseMatrixType> ldlt(JJt);
+            if (ldlt.info() == Eigen::Success) {
+                h_gn = Jx.adjoint() * ldlt.solve(-fx);
+            }
+            if (ldlt.info() != Eigen::Success || !h_gn.allFinite()) {
+                solveQR();
+            }
+            break;
+        }
+    }
+}
+#endif
+}  // namespace
+
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 {
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (jacobianMatrix == EigenSparseJacobian) {
+        return solve_LM_impl<SparseMatrixType>(subsys, isRedundantsolving);
+    }
+#endif
+    return solve_LM_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename MatrixType>
+int System::solve_LM_impl(SubSystem* subsys, bool isRedundantsolving)
+{
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2173,8 +2313,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    MatrixType J(csize, xsize);  // Jacobi of the subsystem
+    MatrixType A(xsize, xsize);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
     subsys->redirectParams();
@@ -2221,7 +2361,6 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
         // J^T J, J^T e
         subsys->calcJacobi(J);
-        ;
 
         A = J.transpose() * J;
         g = J.transpose() * e;
@@ -2246,12 +2385,10 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         int k = 0;
         while (k < 50) {
             // augment normal equations A = A+uI
-            for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
-            }
+            setDiagonal(A, diag_A.array() + mu);
 
             // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
+            solveAugmentedNormalEquations(A, g, h);
             double rel_error = (A * h - g).norm() / g.norm();
 
             // check if solving works
@@ -2301,9 +2438,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
             mu *= nu;
             nu *= 2.0;
-            for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
-            }
+            setDiagonal(A, diag_A);  // restore diagonal J^T J entries
 
             k++;
         }
@@ -2335,6 +2470,17 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
 int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 {
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (jacobianMatrix == EigenSparseJacobian) {
+        return solve_DL_impl<SparseMatrixType>(subsys, isRedundantsolving);
+    }
+#endif
+    return solve_DL_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename MatrixType>
+int System::solve_DL_impl(SubSystem* subsys, bool isRedundantsolving)
+{
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2364,6 +2510,8 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
                        ? "FullPivLU"
                        : (dogLegGaussStep == LeastNormFullPivLU ? "LeastNormFullPivLU"
                                                                 : "LeastNormLdlt"))
+               << ", jacobian: "
+               << (jacobianMatrix == EigenSparseJacobian ? "EigenSparse" : "EigenDense")
                << ", xsize: " << xsize << ", csize: " << csize << ", maxIter: " << maxIterNumber
                << "\n";
 
@@ -2373,7 +2521,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    MatrixType Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2419,19 +2567,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
             h_sd = alpha * g;
 
             // get the gauss-newton step
-            // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-            // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-            switch (dogLegGaussStep) {
-                case FullPivLU:
-                    h_gn = Jx.fullPivLu().solve(-fx);
-                    break;
-                case LeastNormFullPivLU:
-                    h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                    break;
-                case LeastNormLdlt:
-                    h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                    break;
-            }
+            solveGaussStep(Jx, fx, dogLegGaussStep, h_gn);
 
             double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
             if (rel_error > 1e15) {
@@ -4936,6 +5072,13 @@ int System::diagnose(Algorithm alg)
         return dofs;
     }
 
+    std::vector<int> topology;
+    makeDiagnosisTopology(topology);
+    if (reuseDiagnosis && !diagnosedTopology.empty() && topology == diagnosedTopology) {
+        restoreDiagnosis();
+        return dofs;
+    }
+
 #ifdef _DEBUG_TO_FILE
     SolverReportingManager::Manager().LogToFile("GCS::System::diagnose()\n");
 #endif
@@ -4954,6 +5097,7 @@ int System::diagnose(Algorithm alg)
         hasDiagnosis = true;
         emptyDiagnoseMatrix = true;
         dofs = 0;
+        storeDiagnosis(std::move(topology));
         return dofs;
     }
 
@@ -5196,9 +5340,111 @@ int System::diagnose(Algorithm alg)
     }
 #endif
 
+    storeDiagnosis(std::move(topology));
     return dofs;
 }
 
+void System::makeDiagnosisTopology(std::vector<int>& topology)
+{
+    // Everything the reduced Jacobian of diagnose() is built from, except the parameter values.
+    // The parameters are identified by their position in plist, or -1 if they are not unknowns.
+    auto paramIndex = [this](double* param) {
+        MAP_pD_I::const_iterator it = pIndex.find(param);
+        return it != pIndex.end() ? it->second : -1;
+    };
+
+    topology.clear();
+    topology.push_back(static_cast<int>(plist.size()));
+    topology.push_back(static_cast<int>(pdrivenlist.size()));
+    for (double* param : pdrivenlist) {
+        topology.push_back(paramIndex(param));
+    }
+    for (Constraint* constr : clist) {
+        if (constr->getTag() < 0) {
+            continue;
+        }
+        const VEC_pD& cparams = c2p[constr];
+        topology.push_back(constr->getTypeId());
+        topology.push_back(constr->getTag());
+        topology.push_back(constr->isDriving() ? 1 : 0);
+        topology.push_back(static_cast<int>(constr->isInternalAlignment()));
+        topology.push_back(static_cast<int>(cparams.size()));
+        for (double* param : cparams) {
+            topology.push_back(paramIndex(param));
+        }
+    }
+}
+
+void System::storeDiagnosis(std::vector<int>&& topology)
+{
+    diagnosedTopology = std::move(topology);
+    diagnosedDofs = dofs;
+    diagnosedEmptyMatrix = emptyDiagnoseMatrix;
+    diagnosedConflictingTags = conflictingTags;
+    diagnosedRedundantTags = redundantTags;
+    diagnosedPartiallyRedundantTags = partiallyRedundantTags;
+
+    diagnosedRedundant.clear();
+    int index = 0;
+    for (Constraint* constr : clist) {
+        if (constr->getTag() < 0) {
+            continue;
+        }
+        if (redundant.count(constr) > 0) {
+            diagnosedRedundant.push_back(index);
+        }
+        index++;
+    }
+
+    diagnosedDependentParameters.clear();
+    for (double* param : pDependentParameters) {
+        diagnosedDependentParameters.push_back(pIndex[param]);
+    }
+    diagnosedDependentParametersGroups.clear();
+    for (const VEC_pD& group : pDependentParametersGroups) {
+        VEC_I indices;
+        for (double* param : group) {
+            indices.push_back(pIndex[param]);
+        }
+        diagnosedDependentParametersGroups.push_back(std::move(indices));
+    }
+}
+
+void System::restoreDiagnosis()
+{
+    dofs = diagnosedDofs;
+    emptyDiagnoseMatrix = diagnosedEmptyMatrix;
+    conflictingTags = diagnosedConflictingTags;
+    redundantTags = diagnosedRedundantTags;
+    partiallyRedundantTags = diagnosedPartiallyRedundantTags;
+
+    std::vector<Constraint*> diagnosedConstraints;
+    for (Constraint* constr : clist) {
+        if (constr->getTag() >= 0) {
+            diagnosedConstraints.push_back(constr);
+        }
+    }
+    redundant.clear();
+    for (int index : diagnosedRedundant) {
+        redundant.insert(diagnosedConstraints[index]);
+    }
+
+    pDependentParameters.clear();
+    for (int index : diagnosedDependentParameters) {
+        pDependentParameters.push_back(plist[index]);
+    }
+    pDependentParametersGroups.clear();
+    for (const VEC_I& indices : diagnosedDependentParametersGroups) {
+        VEC_pD group;
+        for (int index : indices) {
+            group.push_back(plist[index]);
+        }
+        pDependentParametersGroups.push_back(std::move(group));
+    }
+
+    hasDiagnosis = true;
+}
+
 void System::makeDenseQRDecomposition(const Eigen::MatrixXd& J,
                                       const std::map<int, int>& jacobianconstraintmap,
                                       Eigen::FullPivHouseholderQR<Eigen::MatrixXd>& qrJT,
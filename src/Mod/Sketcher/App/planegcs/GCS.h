@@ -78,6 +78,15 @@ enum QRAlgorithm
     EigenSparseQR = 1
 };
 
+// Storage of the Jacobian in DogLeg and LevenbergMarquardt. With the sparse Jacobian the steps
+// are solved with a sparse Cholesky (LDLT) or QR decomposition, which scales much better for
+// sketches with thousands of constraints.
+enum JacobianMatrix
+{
+    EigenDenseJacobian = 0,
+    EigenSparseJacobian = 1
+};
+
 enum DebugMode
 {
     NoDebug = 0,
@@ -143,10 +152,30 @@ private:
 
     bool emptyDiagnoseMatrix;  // false only if there is at least one driving constraint.
 
+    // Result of the last diagnose(), with the constraints replaced by their position among the
+    // constraints with tag >= 0 and the parameters by their position in plist, so that it
+    // outlives clear() and can be reused for a rebuilt system, see reuseDiagnosis
+    std::vector<int> diagnosedTopology;  // empty if there is no stored diagnosis
+    int diagnosedDofs;
+    bool diagnosedEmptyMatrix;
+    VEC_I diagnosedConflictingTags, diagnosedRedundantTags, diagnosedPartiallyRedundantTags;
+    VEC_I diagnosedRedundant;
+    VEC_I diagnosedDependentParameters;
+    std::vector<VEC_I> diagnosedDependentParametersGroups;
+
+    void makeDiagnosisTopology(std::vector<int>& topology);
+    void storeDiagnosis(std::vector<int>&& topology);
+    void restoreDiagnosis();
+
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
 
+    template<typename MatrixType>
+    int solve_LM_impl(SubSystem* subsys, bool isRedundantsolving);
+    template<typename MatrixType>
+    int solve_DL_impl(SubSystem* subsys, bool isRedundantsolving);
+
     void makeReducedJacobian(Eigen::MatrixXd& J,
                              std::map<int, int>& jacobianconstraintmap,
                              GCS::VEC_pD& pdiagnoselist,
@@ -224,8 +253,14 @@ public:
     double convergenceRedundant;
     QRAlgorithm qrAlgorithm;
     DogLegGaussStep dogLegGaussStep;
+    JacobianMatrix jacobianMatrix;
     double qrpivotThreshold;
     DebugMode debugMode;
+    // if true, diagnose() reuses the previous diagnosis when the constraints and unknowns have the
+    // same topology, i.e. the same types, tags and parameter positions. The rank of the Jacobian
+    // may still depend on the parameter values, so this is only meant for systems that are
+    // rebuilt after moving the geometry, like after dragging in the Sketcher.
+    bool reuseDiagnosis;
     double LM_eps;
     double LM_eps1;
     double LM_tau;
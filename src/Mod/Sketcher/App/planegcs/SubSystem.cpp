@@ -273,7 +273,36 @@ void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 
 void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
 {
-    calcJacobi(plist, jacobi);
+    // only the parameters of a constraint can have a non-zero derivative, so the
+    // adjacency list avoids evaluating all csize * psize entries
+    jacobi.setZero(csize, psize);
+    for (int i = 0; i < csize; i++) {
+        auto it = c2p.find(clist[i]);
+        if (it != c2p.end()) {
+            for (double* param : it->second) {
+                jacobi(i, int(param - pvals.data())) = clist[i]->grad(param);
+            }
+        }
+    }
+}
+
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    // The entries of all adjacent parameters are stored, even if their derivative
+    // is currently zero, so that the sparsity pattern doesn't change between the
+    // iterations of a solver
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < csize; i++) {
+        auto it = c2p.find(clist[i]);
+        if (it != c2p.end()) {
+            for (double* param : it->second) {
+                triplets.emplace_back(i, int(param - pvals.data()), clist[i]->grad(param));
+            }
+        }
+    }
+
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(triplets.begin(), triplets.end());
 }
 
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
@@ -50,6 +50,7 @@ private:
     void setupConnections();
     void onComboBoxDefaultSolverCurrentIndexChanged(int index);
     void onComboBoxDogLegGaussStepCurrentIndexChanged(int index);
+    void onComboBoxJacobianMatrixCurrentIndexChanged(int index);
     void onSpinBoxMaxIterValueChanged(int i);
     void onCheckBoxSketchSizeMultiplierStateChanged(int state);
     void onLineEditConvergenceEditingFinished();
@@ -570,6 +570,8 @@ void Cell::setAlias(const std::string& n)
     if (alias != n) {
         PropertySheet::AtomicPropertyChange signaller(*owner);
 
+        // Aliases are resolved as properties of the sheet
+        App::ObjectIdentifier::invalidateBindings();
         owner->revAliasProp.erase(alias);
 
         // Update owner
@@ -73,8 +73,12 @@ void PropertySheet::clear()
     cellToPropertyNameMap.clear();
     documentObjectToCellMap.clear();
     cellToDocumentObjectMap.clear();
+    cellDependants.clear();
+    cellPrecedents.clear();
+    cellLinks.clear();
     aliasProp.clear();
     revAliasProp.clear();
+    App::ObjectIdentifier::invalidateBindings();
 
     clearDeps();
 }
@@ -280,6 +284,9 @@ PropertySheet::PropertySheet(const PropertySheet& other)
     , cellToPropertyNameMap(other.cellToPropertyNameMap)
     , documentObjectToCellMap(other.documentObjectToCellMap)
     , cellToDocumentObjectMap(other.cellToDocumentObjectMap)
+    , cellDependants(other.cellDependants)
+    , cellPrecedents(other.cellPrecedents)
+    , cellLinks(other.cellLinks)
     , aliasProp(other.aliasProp)
     , revAliasProp(other.revAliasProp)
     , updateCount(other.updateCount)
@@ -808,6 +815,7 @@ void PropertySheet::clearAlias(CellAddress address)
     if (j != aliasProp.end()) {
         revAliasProp.erase(j->second);
         aliasProp.erase(j);
+        App::ObjectIdentifier::invalidateBindings();
     }
 }
 
@@ -847,6 +855,7 @@ void PropertySheet::moveAlias(CellAddress currPos, CellAddress newPos)
         aliasProp[newPos] = j->second;
         revAliasProp[j->second] = newPos;
         aliasProp.erase(currPos);
+        App::ObjectIdentifier::invalidateBindings();
     }
 }
 
@@ -1356,7 +1365,8 @@ void PropertySheet::addDependencies(CellAddress key)
         return;
     }
 
-    for (auto& var : expression->getIdentifiers()) {
+    auto identifiers = expression->getIdentifiers();
+    for (auto& var : identifiers) {
         for (auto& dep : var.first.getDep(true)) {
             App::DocumentObject* docObj = dep.first;
             App::Document* doc = docObj->getDocument();
@@ -1367,7 +1377,6 @@ void PropertySheet::addDependencies(CellAddress key)
 
             documentObjectToCellMap[docObjName].insert(key);
             cellToDocumentObjectMap[key].insert(docObjName);
-            ++updateCount;
 
             for (auto& name : dep.second) {
                 std::string propName = docObjName + "." + name;
@@ -1389,11 +1398,39 @@ void PropertySheet::addDependencies(CellAddress key)
                         // Insert into maps
                         propertyNameToCellMap[propName].insert(key);
                         cellToPropertyNameMap[key].insert(propName);
+
+                        if (docObj == owner) {
+                            cellDependants[j->second].insert(key);
+                            cellPrecedents[key].insert(j->second);
+                        }
+                    }
+                    else if (docObj == owner) {
+                        CellAddress addr = stringToAddress(name.c_str(), true);
+                        if (addr.isValid()) {
+                            cellDependants[addr].insert(key);
+                            cellPrecedents[key].insert(addr);
+                        }
                     }
                 }
             }
         }
     }
+
+    // Links to other objects, only a change of these requires to update the
+    // dependencies of the sheet
+    CellLinks links;
+    expression->getDepObjects(links.objects, &links.labels);
+    links.objects.erase(owner);
+    for (auto& var : identifiers) {
+        if (!var.first.getSubObjectName().empty()) {
+            links.hasSubNames = true;
+            break;
+        }
+    }
+    if (!links.objects.empty() || !links.labels.empty() || links.hasSubNames) {
+        cellLinks[key] = std::move(links);
+        ++updateCount;
+    }
 }
 
 /**
@@ -1451,6 +1488,26 @@ void PropertySheet::removeDependencies(CellAddress key)
         }
 
         cellToDocumentObjectMap.erase(i2);
+    }
+
+    /* Remove from cell dependency graph */
+
+    auto i3 = cellPrecedents.find(key);
+
+    if (i3 != cellPrecedents.end()) {
+        for (const auto& precedent : i3->second) {
+            auto k = cellDependants.find(precedent);
+            if (k != cellDependants.end()) {
+                k->second.erase(key);
+                if (k->second.empty()) {
+                    cellDependants.erase(k);
+                }
+            }
+        }
+        cellPrecedents.erase(i3);
+    }
+
+    if (cellLinks.erase(key)) {
         ++updateCount;
     }
 }
@@ -1506,6 +1563,9 @@ void PropertySheet::breakLink(App::DocumentObject* obj, bool clear)
 
 void PropertySheet::onBreakLink(App::DocumentObject* obj)
 {
+    for (auto& v : cellLinks) {
+        v.second.objects.erase(obj);
+    }
     invalidateDependants(obj);
 }
 
@@ -1622,6 +1682,26 @@ const std::set<CellAddress>& PropertySheet::getDeps(const std::string& name) con
     }
 }
 
+const std::set<CellAddress>& PropertySheet::getCellDependants(CellAddress address) const
+{
+    static std::set<CellAddress> empty;
+    auto it = cellDependants.find(address);
+    if (it != cellDependants.end()) {
+        return it->second;
+    }
+    return empty;
+}
+
+const std::set<CellAddress>& PropertySheet::getCellPrecedents(CellAddress address) const
+{
+    static std::set<CellAddress> empty;
+    auto it = cellPrecedents.find(address);
+    if (it != cellPrecedents.end()) {
+        return it->second;
+    }
+    return empty;
+}
+
 const std::set<std::string>& PropertySheet::getDeps(CellAddress pos) const
 {
     static std::set<std::string> empty;
@@ -1655,16 +1735,24 @@ void PropertySheet::hasSetValue()
 
     updateCount = 0;
 
+    // Merge the links cached per cell by addDependencies(), so that only
+    // the expressions with sub-object references have to be visited
     std::map<App::DocumentObject*, bool> deps;
     std::vector<std::string> labels;
     unregisterElementReference();
     UpdateElementReferenceExpressionVisitor<PropertySheet> v(*this);
-    for (auto& d : data) {
-        auto expr = d.second->expression.get();
-        if (expr) {
-            expr->getDepObjects(deps, &labels);
-            if (!restoring) {
-                expr->visit(v);
+    for (auto& d : cellLinks) {
+        for (auto& dep : d.second.objects) {
+            auto res = deps.insert(dep);
+            if (!dep.second) {
+                res.first->second = false;
+            }
+        }
+        labels.insert(labels.end(), d.second.labels.begin(), d.second.labels.end());
+        if (d.second.hasSubNames && !restoring) {
+            auto cell = getValue(d.first);
+            if (cell && cell->expression) {
+                cell->expression->visit(v);
             }
         }
     }
@@ -197,6 +197,12 @@ public:
 
     const std::set<std::string>& getDeps(App::CellAddress pos) const;
 
+    /// Cells of this sheet whose expression refers to the cell at \a address
+    const std::set<App::CellAddress>& getCellDependants(App::CellAddress address) const;
+
+    /// Cells of this sheet the expression of the cell at \a address refers to
+    const std::set<App::CellAddress>& getCellPrecedents(App::CellAddress address) const;
+
     void recomputeDependencies(App::CellAddress key);
 
     PyObject* getPyObject() override;
@@ -319,6 +325,28 @@ private:
     /*! DocumentObject this cell depends on */
     std::map<App::CellAddress, std::set<std::string>> cellToDocumentObjectMap;
 
+    /*! Cell level dependency graph of this sheet, i.e. when the cell given in
+      key changes, the set of addresses needs to be recomputed.
+      */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellDependants;
+
+    /*! Cells of this sheet this cell depends on */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellPrecedents;
+
+    /*! Links of a cell expression to other objects, cached to update the
+      dependencies of the sheet without walking all expressions.
+      */
+    struct CellLinks
+    {
+        /*! Linked objects, mapped to true for hidden references */
+        std::map<App::DocumentObject*, bool> objects;
+        /*! Referenced labels */
+        std::vector<std::string> labels;
+        /*! Whether the expression has sub-object references */
+        bool hasSubNames = false;
+    };
+    std::map<App::CellAddress, CellLinks> cellLinks;
+
     /*! Mapping of cell position to alias property */
     std::map<App::CellAddress, std::string> aliasProp;
 
@@ -124,6 +124,7 @@ void Sheet::clearAll()
 
     propAddress.clear();
     cellErrors.clear();
+    changedOther = true;
     columnWidths.clear();
     rowHeights.clear();
 
@@ -566,8 +567,10 @@ Property* Sheet::setFloatProperty(CellAddress key, double value)
     std::string name = key.toString(CellAddress::Cell::ShowRowColumn);
     Property* prop = props.getDynamicPropertyByName(name.c_str());
     PropertyFloat* floatProp;
+    bool created = false;
 
     if (!prop || prop->getTypeId() != PropertyFloat::getClassTypeId()) {
+        created = true;
         if (prop) {
             this->removeDynamicProperty(name.c_str());
             propAddress.erase(prop);
@@ -584,7 +587,10 @@ Property* Sheet::setFloatProperty(CellAddress key, double value)
     }
 
     propAddress[floatProp] = key;
-    floatProp->setValue(value);
+    // Keep an unchanged value untouched, so that its dependents are not recomputed
+    if (created || floatProp->getValue() != value) {
+        floatProp->setValue(value);
+    }
 
     return floatProp;
 }
@@ -594,8 +600,10 @@ Property* Sheet::setIntegerProperty(CellAddress key, long value)
     std::string name = key.toString(CellAddress::Cell::ShowRowColumn);
     Property* prop = props.getDynamicPropertyByName(name.c_str());
     PropertyInteger* intProp;
+    bool created = false;
 
     if (!prop || prop->getTypeId() != PropertyInteger::getClassTypeId()) {
+        created = true;
         if (prop) {
             this->removeDynamicProperty(name.c_str());
             propAddress.erase(prop);
@@ -612,7 +620,9 @@ Property* Sheet::setIntegerProperty(CellAddress key, long value)
     }
 
     propAddress[intProp] = key;
-    intProp->setValue(value);
+    if (created || intProp->getValue() != value) {
+        intProp->setValue(value);
+    }
 
     return intProp;
 }
@@ -634,8 +644,10 @@ Property* Sheet::setQuantityProperty(CellAddress key, double value, const Base::
     std::string name = key.toString(CellAddress::Cell::ShowRowColumn);
     Property* prop = props.getDynamicPropertyByName(name.c_str());
     PropertySpreadsheetQuantity* quantityProp;
+    bool created = false;
 
     if (!prop || prop->getTypeId() != PropertySpreadsheetQuantity::getClassTypeId()) {
+        created = true;
         if (prop) {
             this->removeDynamicProperty(name.c_str());
             propAddress.erase(prop);
@@ -652,8 +664,10 @@ Property* Sheet::setQuantityProperty(CellAddress key, double value, const Base::
     }
 
     propAddress[quantityProp] = key;
-    quantityProp->setValue(value);
-    quantityProp->setUnit(unit);
+    if (created || quantityProp->getValue() != value || quantityProp->getUnit() != unit) {
+        quantityProp->setValue(value);
+        quantityProp->setUnit(unit);
+    }
 
     cells.setComputedUnit(key, unit);
 
@@ -676,7 +690,10 @@ Property* Sheet::setStringProperty(CellAddress key, const std::string& value)
     Property* prop = props.getDynamicPropertyByName(name.c_str());
     PropertyString* stringProp = freecad_dynamic_cast<PropertyString>(prop);
 
+    bool created = false;
+
     if (!stringProp) {
+        created = true;
         if (prop) {
             this->removeDynamicProperty(name.c_str());
             propAddress.erase(prop);
@@ -690,7 +707,9 @@ Property* Sheet::setStringProperty(CellAddress key, const std::string& value)
     }
 
     propAddress[stringProp] = key;
-    stringProp->setValue(value.c_str());
+    if (created || stringProp->getStrValue() != value) {
+        stringProp->setValue(value.c_str());
+    }
 
     return stringProp;
 }
@@ -1031,6 +1050,10 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
+    // The dirty cells are recomputed in any case, the cells depending on them
+    // only if the value of a cell they refer to has changed.
+    std::set<CellAddress> pending = dirtyCells;
+
     DependencyList graph;
     std::map<CellAddress, Vertex> VertexList;
     std::map<Vertex, CellAddress> VertexIndexList;
@@ -1047,7 +1070,7 @@ DocumentObjectExecReturn* Sheet::execute()
         }
 
         // Process cells that depend on the current cell
-        for (auto& dep : providesTo(currPos)) {
+        for (auto& dep : cells.getCellDependants(currPos)) {
             auto resDep = VertexList.emplace(dep, Vertex());
             if (resDep.second) {
                 resDep.first->second = add_vertex(graph);
@@ -1069,8 +1092,23 @@ DocumentObjectExecReturn* Sheet::execute()
         FC_LOG("recomputing " << getFullName());
         for (auto& pos : make_order) {
             const auto& addr = VertexIndexList[pos];
+            if (!pending.count(addr)) {
+                continue;
+            }
             FC_TRACE(addr.toString());
+            bool changedBefore = changedCells.erase(addr) > 0;
+            Property* prop = getProperty(addr);
             recomputeCell(addr);
+            if (getProperty(addr) != prop) {
+                changedCells.insert(addr);
+            }
+            if (changedCells.count(addr)) {
+                const auto& deps = cells.getCellDependants(addr);
+                pending.insert(deps.begin(), deps.end());
+            }
+            else if (changedBefore) {
+                changedCells.insert(addr);
+            }
         }
     }
     catch (std::exception&) {
@@ -1108,7 +1146,7 @@ DocumentObjectExecReturn* Sheet::execute()
                 }
 
                 // Process cells that depend on the current cell
-                for (auto& dep : providesTo(currPos)) {
+                for (auto& dep : cells.getCellDependants(currPos)) {
                     auto resDep = VertexList.emplace(dep, Vertex());
                     if (resDep.second) {
                         resDep.first->second = add_vertex(graph);
@@ -1213,6 +1251,7 @@ void Sheet::clear(CellAddress address, bool /*all*/)
         }
         cells.clear(address);
     }
+    changedCells.insert(address);
 
     std::string addr = address.toString();
     if (auto prop = props.getDynamicPropertyByName(addr.c_str())) {
@@ -1617,7 +1656,7 @@ void Sheet::providesTo(CellAddress address, std::set<std::string>& result) const
 
 std::set<CellAddress> Sheet::providesTo(CellAddress address) const
 {
-    return cells.getDeps(getFullName() + "." + address.toString());
+    return cells.getCellDependants(address);
 }
 
 void Sheet::onDocumentRestored()
@@ -1720,11 +1759,78 @@ void Sheet::onChanged(const App::Property* prop)
         }
     }
     else {
+        auto it = propAddress.find(prop);
+        if (it != propAddress.end()) {
+            changedCells.insert(it->second);
+        }
+        else if (prop != &columnWidths && prop != &rowHeights && prop != &ExpressionEngine) {
+            changedOther = true;
+        }
         cells.slotChangedObject(*this, *prop);
     }
     App::DocumentObject::onChanged(prop);
 }
 
+/**
+ * Enforce the recompute of the dependent objects that refer to a cell whose
+ * value has changed. Other sheets are not enforced, the cells referring to
+ * a changed cell are marked dirty already.
+ */
+
+void Sheet::enforceDependentRecompute()
+{
+    if (changedOther) {
+        DocumentObject::enforceDependentRecompute();
+    }
+    else if (!changedCells.empty()) {
+        for (auto obj : getInList()) {
+            if (dependsOnChangedCells(obj)) {
+                obj->enforceRecompute();
+            }
+        }
+    }
+    changedCells.clear();
+    changedOther = false;
+}
+
+bool Sheet::dependsOnChangedCells(const App::DocumentObject* obj) const
+{
+    std::vector<Property*> props;
+    obj->getPropertyList(props);
+    for (auto prop : props) {
+        if (prop->isDerivedFrom(PropertySheet::getClassTypeId())) {
+            continue;
+        }
+        if (auto container = freecad_dynamic_cast<PropertyExpressionContainer>(prop)) {
+            for (const auto& v : container->getExpressions()) {
+                auto deps = v.second->getDeps(Expression::DepAll);
+                auto it = deps.find(const_cast<Sheet*>(this));
+                if (it == deps.end()) {
+                    continue;
+                }
+                for (const auto& dep : it->second) {
+                    // Sub-object references are tracked by object only
+                    if (dep.first.empty()) {
+                        return true;
+                    }
+                    CellAddress address = getCellAddress(dep.first.c_str(), true);
+                    if (address.isValid() && changedCells.count(address)) {
+                        return true;
+                    }
+                }
+            }
+        }
+        else if (auto link = freecad_dynamic_cast<PropertyLinkBase>(prop)) {
+            std::vector<App::DocumentObject*> links;
+            link->getLinks(links, true);
+            if (std::find(links.begin(), links.end(), this) != links.end()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void Sheet::setCopyOrCutRanges(const std::vector<App::Range>& ranges, bool copy)
 {
     std::set<Range> rangeSet(copyCutRanges.begin(), copyCutRanges.end());
@@ -237,6 +237,10 @@ public:
 protected:
     void onChanged(const App::Property* prop) override;
 
+    void enforceDependentRecompute() override;
+
+    bool dependsOnChangedCells(const App::DocumentObject* obj) const;
+
     void updateColumnsOrRows(bool horizontal, int section, int count);
 
     std::set<App::CellAddress> providesTo(App::CellAddress address) const;
@@ -274,6 +278,12 @@ protected:
     /* Set of cells with errors */
     std::set<App::CellAddress> cellErrors;
 
+    /* Cells with a changed value since the dependent objects were last enforced */
+    std::set<App::CellAddress> changedCells;
+
+    /* Any other property changed since the dependent objects were last enforced */
+    bool changedOther = false;
+
     /* Properties */
 
     /* Cell data */
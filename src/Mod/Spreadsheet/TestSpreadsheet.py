@@ -1572,6 +1572,43 @@ class SpreadsheetCases(unittest.TestCase):
         self.assertLess(abs(sheet.F4.Value - -1.6971), 0.0001)
         self.assertEqual(sheet.F5, FreeCAD.Vector(1.72, 2.96, 4.2))
 
+    def testRecomputeOnlyChangedDependents(self):
+        """Objects referring to cells with an unchanged value are not recomputed"""
+
+        class Counter:
+            def __init__(self, obj):
+                obj.Proxy = self
+                self.count = 0
+
+            def execute(self, obj):
+                self.count += 1
+
+        sheet = self.doc.addObject("Spreadsheet::Sheet", "Spreadsheet")
+        sheet.set("A1", "1")
+        sheet.set("B1", "=A1 * 0")
+        sheet.set("C1", "=A1 + 1")
+        sheet.set("D1", "=B1 + 1")
+        feature = self.doc.addObject("App::FeaturePython", "Feature")
+        Counter(feature)
+        feature.addProperty("App::PropertyFloat", "Value")
+        feature.setExpression("Value", "Spreadsheet.D1")
+        self.doc.recompute()
+        count = feature.Proxy.count
+
+        sheet.set("A1", "2")
+        self.doc.recompute()
+        self.assertEqual(sheet.C1, 3)
+        self.assertEqual(sheet.D1, 1)
+        self.assertEqual(feature.Proxy.count, count)
+
+        feature.setExpression("Value", "Spreadsheet.C1")
+        self.doc.recompute()
+        count = feature.Proxy.count
+        sheet.set("A1", "3")
+        self.doc.recompute()
+        self.assertEqual(feature.Value, 4)
+        self.assertEqual(feature.Proxy.count, count + 1)
+
     def tearDown(self):
         # closing doc
         FreeCAD.closeDocument(self.doc.Name)
@@ -808,6 +808,13 @@ class DocumentRecomputeCases(unittest.TestCase):
         self.L1.Link = self.L2
         self.L2.Link = self.L3
 
+    def testRecomputeTraceArgument(self):
+        self.L1.touch()
+        self.assertEqual(self.Doc.recompute(trace=None), 1)
+        self.L1.touch()
+        with self.assertRaises(TypeError):
+            self.Doc.recompute(trace=1)
+
     def testRecompute(self):
 
         # sequence to test recompute behaviour
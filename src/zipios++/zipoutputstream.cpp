@@ -63,6 +63,12 @@ void ZipOutputStream::putNextEntry(const std::string& entryName) {
   putNextEntry( ZipCDirEntry(entryName));
 }
 
+void ZipOutputStream::putRawEntry( const ZipCDirEntry &entry, const char *data,
+                                   uint32 compressed_size, uint32 size, uint32 crc,
+                                   StorageMethod method ) {
+  ozf->putRawEntry( entry, data, compressed_size, size, crc, method ) ;
+}
+
 
 void ZipOutputStream::setComment( const std::string &comment ) {
   ozf->setComment( comment ) ;
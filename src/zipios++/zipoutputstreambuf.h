@@ -49,6 +49,19 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes a complete entry whose data has already been compressed
+      by the caller, e.g. on another thread. The data must be raw
+      deflate data (no zlib header) if method is DEFLATED, or the
+      uncompressed data if method is STORED.
+      @param entry the entry to write.
+      @param data the compressed data.
+      @param compressed_size the number of bytes in data.
+      @param size the uncompressed size of the entry.
+      @param crc the crc32 of the uncompressed data.
+      @param method the method data has been compressed with. */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data, uint32 compressed_size,
+                    uint32 size, uint32 crc, StorageMethod method ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -68,6 +81,7 @@ protected:
 
   void setEntryClosedState() ;
   void updateEntryHeaderInfo() ;
+  static int currentDosTime() ;
 
   // Should/could be moved to zipheadio.h ?!
   static void writeCentralDirectory( const vector< ZipCDirEntry > &entries, 
@@ -5,6 +5,8 @@
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
+#include "App/RecomputeProfile.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +96,116 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, parallelRecomputeExecutesIndependentObjects)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("ParallelRecompute", true);
+    std::vector<App::FeatureTestPlacement*> features;
+    for (int i = 0; i < 8; ++i) {
+        auto feature = static_cast<App::FeatureTestPlacement*>(
+            doc()->addObject("App::FeatureTestPlacement"));
+        feature->Input1.setValue(Base::Placement(Base::Vector3d(i, 0, 0), Base::Rotation()));
+        feature->Input2.setValue(Base::Placement(Base::Vector3d(0, i, 0), Base::Rotation()));
+        features.push_back(feature);
+    }
+    int changes = 0;
+    auto conn = doc()->signalChangedObject.connect(
+        [&changes](const App::DocumentObject&, const App::Property&) { ++changes; });
+
+    // Act
+    int count = doc()->recompute();
+    hGrp->RemoveBool("ParallelRecompute");
+    conn.disconnect();
+
+    // Assert
+    EXPECT_EQ(count, 8);
+    EXPECT_EQ(changes, 16);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(features[i]->MultLeft.getValue().getPosition(), Base::Vector3d(i, i, 0));
+        EXPECT_FALSE(features[i]->isTouched());
+    }
+}
+
+TEST_F(DocumentTest, recomputeFollowsChangedDependencies)
+{
+    // Arrange
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    doc()->recompute();
+    std::vector<const App::DocumentObject*> order;
+    auto conn = doc()->signalRecomputedObject.connect([&order](const App::DocumentObject& obj) {
+        order.push_back(&obj);
+    });
+
+    // Act
+    first->Source1.setValue(second);
+    second->touch();
+    doc()->recompute();
+    conn.disconnect();
+
+    // Assert
+    ASSERT_EQ(order.size(), 2);
+    EXPECT_EQ(order[0], second);
+    EXPECT_EQ(order[1], first);
+}
+
+TEST_F(DocumentTest, recomputeProfileRecordsExecutedObjects)
+{
+    // Arrange
+    auto base = doc()->addObject("App::FeatureTest");
+    auto dependent = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    dependent->Source1.setValue(base);
+    App::RecomputeProfile profile;
+    doc()->setRecomputeProfile(&profile);
+
+    // Act
+    doc()->recompute();
+    doc()->setRecomputeProfile(nullptr);
+    std::ostringstream trace;
+    profile.writeChromeTrace(trace);
+
+    // Assert
+    const auto& entries = profile.getEntries();
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].object, base->getFullName());
+    EXPECT_TRUE(entries[0].touchedBy.empty());
+    EXPECT_EQ(entries[1].object, dependent->getFullName());
+    EXPECT_THAT(entries[1].touchedBy, ::testing::ElementsAre(base->getFullName()));
+    EXPECT_EQ(profile.getPasses(), 1);
+    EXPECT_THAT(trace.str(), ::testing::HasSubstr("\"traceEvents\""));
+}
+
+TEST_F(DocumentTest, undoLimitEvictsOldestTransactions)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    doc()->clearUndos();
+    const std::string value(100000, 'x');
+    auto change = [&](int index) {
+        doc()->openTransaction("Change");
+        feature->String.setValue(value + std::to_string(index));
+        doc()->commitTransaction();
+    };
+    for (int i = 0; i < 4; ++i) {
+        change(i);
+    }
+    EXPECT_EQ(doc()->getAvailableUndos(), 4);
+    EXPECT_GE(doc()->getUndoMemSize(), 4 * value.size());
+
+    // Act
+    doc()->setUndoLimit(2 * value.size() + value.size() / 2);
+    change(4);
+    auto stats = doc()->getUndoStats();
+
+    // Assert
+    EXPECT_EQ(stats.undoCount, 2);
+    EXPECT_EQ(stats.evicted, 3);
+    EXPECT_LE(stats.undoMemSize, doc()->getUndoLimit());
+    EXPECT_TRUE(doc()->undo());
+    EXPECT_EQ(feature->String.getStrValue(), value + "3");
+}
+
 // NOLINTEND(readability-magic-numbers)
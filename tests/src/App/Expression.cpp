@@ -1,7 +1,14 @@
 #include <gtest/gtest.h>
 
+#include "App/Application.h"
+#include "App/CompiledExpression.h"
+#include "App/Document.h"
 #include "App/ExpressionParser.h"
 #include "App/ExpressionTokenizer.h"
+#include "App/FeatureTest.h"
+#include "Base/Interpreter.h"
+#include "Base/TimeInfo.h"
+#include <src/App/InitApplication.h>
 
 // clang-format off
 TEST(Expression, tokenize)
@@ -289,3 +296,139 @@ TEST(Expression, test_e_rad)
     op.release();
 }
 // clang-format on
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+class CompiledExpressionTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    App::FeatureTest* addFeature(const char* name, long integer, double value)
+    {
+        auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", name));
+        feature->Integer.setValue(integer);
+        feature->Float.setValue(value);
+        return feature;
+    }
+
+    // Spreadsheet like parameter set with a few chained references
+    std::unique_ptr<App::Expression> parseChainedSum(int count)
+    {
+        std::vector<App::FeatureTest*> params;
+        for (int i = 0; i < count; ++i) {
+            params.push_back(addFeature(("Param" + std::to_string(i)).c_str(), i, i * 0.5));
+        }
+        std::string text = "Param0.Float";
+        for (int i = 1; i < count; ++i) {
+            std::string name = "Param" + std::to_string(i);
+            text += " + (" + name + ".Integer > 10 ? " + name + ".Float * 2 : " + name
+                + ".Float / 2)";
+        }
+        return std::unique_ptr<App::Expression>(App::Expression::parse(params[0], text));
+    }
+
+    static bool isEqual(const Py::Object& value1, const Py::Object& value2)
+    {
+        return PyObject_RichCompareBool(value1.ptr(), value2.ptr(), Py_EQ) == 1;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+};
+
+TEST_F(CompiledExpressionTest, compiledMatchesTreeEvaluation)
+{
+    auto param = addFeature("Param", 5, 2.5);
+    const char* texts[] = {
+        "Param.Float * 2 + 1",
+        "-Param.Float ^ 2 / 4",
+        "Param.Integer > 3 ? Param.Float : -Param.Float",
+        "Param.Integer < 3 ? 1 : Param.Integer == 5 ? 2 : 3",
+        "abs(Param.Float - 10) % 3",
+        "+Param.Integer * Param.Float",
+    };
+    Base::PyGILStateLocker lock;
+    for (auto text : texts) {
+        std::unique_ptr<App::Expression> expr(App::Expression::parse(param, text));
+        App::CompiledExpression compiled(expr.get());
+        EXPECT_TRUE(isEqual(compiled.getPyValue(), expr->getPyValue())) << text;
+    }
+}
+
+TEST_F(CompiledExpressionTest, compiledRebindsAfterRelabel)
+{
+    auto first = addFeature("First", 1, 1.0);
+    auto second = addFeature("Second", 1, 10.0);
+    first->Label.setValue("Target");
+    std::unique_ptr<App::Expression> expr(App::Expression::parse(second, "<<Target>>.Float + 1"));
+    App::CompiledExpression compiled(expr.get());
+    Base::PyGILStateLocker lock;
+    EXPECT_EQ(static_cast<double>(Py::Float(compiled.getPyValue())), 2.0);
+
+    first->Float.setValue(2.0);
+    EXPECT_EQ(static_cast<double>(Py::Float(compiled.getPyValue())), 3.0);
+
+    first->Label.setValue("Other");
+    second->Label.setValue("Target");
+    EXPECT_EQ(static_cast<double>(Py::Float(compiled.getPyValue())), 11.0);
+}
+
+TEST_F(CompiledExpressionTest, compiledMatchesTreeEvaluationOfChainedSum)
+{
+    std::unique_ptr<App::Expression> expr = parseChainedSum(20);
+    App::CompiledExpression compiled(expr.get());
+    Base::PyGILStateLocker lock;
+    EXPECT_TRUE(isEqual(compiled.getPyValue(), expr->getPyValue()));
+}
+
+// Run with --gtest_also_run_disabled_tests to print the time of the tree and compiled evaluation
+TEST_F(CompiledExpressionTest, DISABLED_benchmarkTreeAndCompiledEvaluation)
+{
+    std::unique_ptr<App::Expression> expr = parseChainedSum(20);
+    App::CompiledExpression compiled(expr.get());
+
+    const int iterations = 2000;
+    Base::PyGILStateLocker lock;
+    Py::Object treeValue;
+    Py::Object compiledValue;
+
+    Base::TimeElapsed treeStart;
+    for (int i = 0; i < iterations; ++i) {
+        treeValue = expr->getPyValue();
+    }
+    double treeTime = Base::TimeElapsed::diffTimeF(treeStart);
+
+    Base::TimeElapsed compiledStart;
+    for (int i = 0; i < iterations; ++i) {
+        compiledValue = compiled.getPyValue();
+    }
+    double compiledTime = Base::TimeElapsed::diffTimeF(compiledStart);
+
+    EXPECT_TRUE(isEqual(treeValue, compiledValue));
+    std::cout << "Evaluation of " << iterations << " x " << compiled.size()
+              << " instructions: tree " << treeTime << " s, compiled " << compiledTime << " s"
+              << std::endl;
+}
+
+// NOLINTEND(readability-magic-numbers)
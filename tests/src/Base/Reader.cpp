@@ -7,7 +7,9 @@
 #endif
 
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Reader.h"
+#include "Base/Writer.h"
 #include <array>
 #include <boost/filesystem.hpp>
 #include <fstream>
@@ -342,3 +344,70 @@ TEST_F(ReaderTest, invalidDefaults)
         { Reader()->getAttributeAsInteger("missing", "Not a Float"); },
         std::invalid_argument);
 }
+
+class DeferredPayload: public Base::Persistence
+{
+public:
+    unsigned int getMemSize() const override
+    {
+        return 0;
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << "payload";
+    }
+    void RestoreDocFile(Base::Reader& reader) override
+    {
+        reader >> data;
+    }
+    bool deferDocFile(const std::shared_ptr<Base::DeferredFile>& file) override
+    {
+        deferred = file;
+        return true;
+    }
+
+    std::string data;
+    std::shared_ptr<Base::DeferredFile> deferred;
+};
+
+TEST(DeferredFileTest, readFilesDefersInLazyMode)
+{
+    // Arrange
+    XERCES_CPP_NAMESPACE::XMLPlatformUtils::Initialize();
+    auto archive = fs::temp_directory_path() / "unit_test_DeferredFile.zip";
+    DeferredPayload saved;
+    {
+        Base::ZipWriter writer(archive.string().c_str());
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << R"(<?xml version="1.0" encoding="UTF-8"?><document/>)";
+        writer.addFile("Payload.txt", &saved);
+        writer.writeFiles();
+    }
+    DeferredPayload restored;
+
+    // Act
+    {
+        std::ifstream file(archive.string(), std::ios::in | std::ios::binary);
+        zipios::ZipInputStream zipstream(file);
+        Base::XMLReader reader(archive.string().c_str(), zipstream);
+        reader.readElement("document");
+        reader.addFile("Payload.txt", &restored);
+        reader.setLazyFiles(true);
+        reader.readFiles(zipstream);
+        EXPECT_TRUE(reader.hasDeferredFiles());
+    }
+
+    // Assert
+    EXPECT_TRUE(restored.data.empty());
+    ASSERT_TRUE(restored.deferred);
+    EXPECT_EQ(restored.deferred->getSize(), 7);
+    restored.deferred->read([&restored](Base::Reader& reader) {
+        restored.RestoreDocFile(reader);
+    });
+    EXPECT_EQ(restored.data, "payload");
+    fs::remove(archive);
+}
@@ -1,8 +1,13 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <sstream>
 
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +134,78 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+class FilePayload: public Base::Persistence
+{
+public:
+    explicit FilePayload(std::string data)
+        : data(std::move(data))
+    {}
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(data.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << data;
+    }
+
+private:
+    std::string data;
+};
+
+class ZipWriterTest: public ::testing::TestWithParam<int>
+{
+protected:
+    static std::map<std::string, std::string> readEntries(const std::string& fileName)
+    {
+        std::map<std::string, std::string> entries;
+        zipios::ZipFile zip(fileName);
+        for (const auto& entry : zip.entries()) {
+            std::unique_ptr<std::istream> str(zip.getInputStream(entry->getName()));
+            std::ostringstream data;
+            data << str->rdbuf();
+            entries[entry->getName()] = data.str();
+        }
+        return entries;
+    }
+};
+
+TEST_P(ZipWriterTest, writeFilesConcurrently)
+{
+    // Arrange
+    std::vector<FilePayload> files;
+    for (int i = 0; i < 20; ++i) {
+        files.emplace_back(std::string(1000 * i, static_cast<char>('a' + i)) + "end");
+    }
+    std::string fileName {"ZipWriterTest.zip"};
+
+    // Act
+    {
+        Base::ZipWriter writer(fileName.c_str());
+        writer.setLevel(GetParam());
+        writer.setThreads(4);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        for (int i = 0; i < 20; ++i) {
+            writer.addFile(("File" + std::to_string(i)).c_str(), &files[i]);
+        }
+        writer.writeFiles();
+    }
+
+    // Assert
+    auto entries = readEntries(fileName);
+    std::remove(fileName.c_str());
+    ASSERT_EQ(entries.size(), 21U);
+    EXPECT_EQ(entries["Document.xml"], "<Document/>");
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(entries["File" + std::to_string(i)],
+                  std::string(1000 * i, static_cast<char>('a' + i)) + "end");
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ZipWriterLevels, ZipWriterTest, ::testing::Values(0, 1, 6));
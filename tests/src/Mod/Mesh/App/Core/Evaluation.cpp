@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <Base/Exception.h>
+#include <Base/Sequencer.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshEvaluationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // planar grid with a few defects
+        const int count = 40;
+        auto point = [](float i, float j) {
+            return Base::Vector3f(i * 0.1F, j * 0.1F, 0.0F);
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < count; i++) {
+            for (int j = 0; j < count; j++) {
+                facets.emplace_back(point(i, j), point(i + 1, j), point(i, j + 1));
+                facets.emplace_back(point(i, j + 1), point(i + 1, j), point(i + 1, j + 1));
+            }
+        }
+
+        // a fin at an inner edge gives a non-manifold edge
+        facets.emplace_back(point(10, 11), point(11, 10), Base::Vector3f(1.05F, 1.05F, 1.0F));
+        // a triangle at the corner gives a non-manifold point
+        facets.emplace_back(point(0, 0), point(-1, -0.5F), point(-0.5F, -1));
+        // a vertical triangle piercing the grid
+        facets.emplace_back(Base::Vector3f(2.52F, 2.53F, -0.5F),
+                            Base::Vector3f(2.83F, 2.53F, -0.5F),
+                            Base::Vector3f(2.67F, 2.58F, 0.5F));
+        kernel = facets;
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshEvaluationTest, TestBVHSearch)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    EXPECT_EQ(bvh.CountFacets(), kernel.CountFacets());
+    EXPECT_TRUE(bvh.GetBoundBox().IsInBox(kernel.GetBoundBox()));
+
+    std::vector<Base::BoundBox3f> boxes {
+        Base::BoundBox3f(0.5F, 0.5F, -1.0F, 0.8F, 0.7F, 1.0F),
+        Base::BoundBox3f(2.6F, 2.5F, -0.1F, 2.7F, 2.6F, 0.1F),
+        Base::BoundBox3f(-2.0F, -2.0F, -2.0F, 0.0F, 0.0F, 0.0F),
+        Base::BoundBox3f(10.0F, 10.0F, 10.0F, 11.0F, 11.0F, 11.0F)};
+
+    for (const auto& box : boxes) {
+        std::vector<MeshCore::FacetIndex> found;
+        bvh.Search(box, [&found](MeshCore::FacetIndex index) {
+            found.push_back(index);
+        });
+        std::sort(found.begin(), found.end());
+
+        std::vector<MeshCore::FacetIndex> expected;
+        for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+            if (kernel.GetFacet(i).GetBoundBox() && box) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(found, expected);
+    }
+}
+
+TEST_F(MeshEvaluationTest, TestDefectsMatchSingleChecks)
+{
+    MeshCore::MeshEvalDefects eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+    const MeshCore::MeshDefectReport& report = eval.GetReport();
+
+    MeshCore::MeshEvalTopology topology(kernel);
+    EXPECT_FALSE(topology.Evaluate());
+    EXPECT_EQ(report.nonManifoldEdges.size(), 1);
+    EXPECT_EQ(report.nonManifoldEdges, topology.GetIndices());
+    EXPECT_EQ(report.nonManifoldFacets, topology.GetFacets());
+
+    MeshCore::MeshEvalPointManifolds points(kernel);
+    EXPECT_FALSE(points.Evaluate());
+    EXPECT_EQ(report.nonManifoldPoints.size(), 1);
+    EXPECT_EQ(report.nonManifoldPoints, points.GetIndices());
+    EXPECT_EQ(report.facetsOfNonManifoldPoints, points.GetFacetIndices());
+
+    MeshCore::MeshEvalSelfIntersection selfIntersection(kernel);
+    EXPECT_FALSE(selfIntersection.Evaluate());
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    selfIntersection.GetIntersections(pairs);
+    EXPECT_FALSE(pairs.empty());
+    EXPECT_EQ(report.selfIntersections, pairs);
+    for (const auto& it : pairs) {
+        EXPECT_LT(it.first, it.second);
+        EXPECT_EQ(it.second, kernel.CountFacets() - 1);
+    }
+
+    MeshCore::MeshEvalNeighbourhood neighbourhood(kernel);
+    EXPECT_EQ(report.invalidNeighbours, neighbourhood.GetIndices());
+}
+
+TEST_F(MeshEvaluationTest, TestDefectsSelectedChecks)
+{
+    MeshCore::MeshEvalDefects eval(kernel, MeshCore::MeshEvalDefects::NonManifoldPoints);
+    EXPECT_FALSE(eval.Evaluate());
+    EXPECT_EQ(eval.GetReport().nonManifoldPoints.size(), 1);
+    EXPECT_TRUE(eval.GetReport().nonManifoldEdges.empty());
+    EXPECT_TRUE(eval.GetReport().selfIntersections.empty());
+}
+
+TEST_F(MeshEvaluationTest, TestInvalidNeighbourOfLastEdge)
+{
+    // the edge with the highest point indices is checked, too
+    MeshCore::MeshPointArray points;
+    points.push_back(MeshCore::MeshPoint(Base::Vector3f(0, 0, 0)));
+    points.push_back(MeshCore::MeshPoint(Base::Vector3f(1, 0, 0)));
+    points.push_back(MeshCore::MeshPoint(Base::Vector3f(0, 1, 0)));
+    MeshCore::MeshFacetArray facets;
+    MeshCore::MeshFacet facet(0, 1, 2, MeshCore::FACET_INDEX_MAX, 0, MeshCore::FACET_INDEX_MAX);
+    facets.push_back(facet);
+
+    MeshCore::MeshKernel mesh;
+    mesh.Adopt(points, facets);
+
+    MeshCore::MeshEvalNeighbourhood eval(mesh);
+    EXPECT_FALSE(eval.Evaluate());
+    EXPECT_EQ(eval.GetIndices(), std::vector<MeshCore::FacetIndex> {0});
+
+    MeshCore::MeshEvalDefects defects(mesh, MeshCore::MeshEvalDefects::Neighbourhood);
+    EXPECT_FALSE(defects.Evaluate());
+    EXPECT_EQ(defects.GetReport().invalidNeighbours, std::vector<MeshCore::FacetIndex> {0});
+}
+
+namespace
+{
+// a sequencer that counts its steps and aborts at the first step that can be aborted
+class AbortingSequencer: public Base::SequencerBase
+{
+public:
+    int steps = 0;
+
+protected:
+    void nextStep(bool canAbort) override
+    {
+        steps++;
+        if (canAbort) {
+            throw Base::AbortException("Aborting...");
+        }
+    }
+};
+}  // namespace
+
+TEST_F(MeshEvaluationTest, TestSelfIntersectionsCanBeAborted)
+{
+    AbortingSequencer seq;
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> intersection;
+    EXPECT_THROW(eval.GetIntersections(intersection), Base::AbortException);
+
+    MeshCore::MeshEvalDefects defects(kernel);
+    EXPECT_THROW(defects.Evaluate(), Base::AbortException);
+}
+
+TEST_F(MeshEvaluationTest, TestTopologyShowsProgress)
+{
+    AbortingSequencer seq;
+    MeshCore::MeshEvalTopology eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+    EXPECT_GT(seq.steps, 0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
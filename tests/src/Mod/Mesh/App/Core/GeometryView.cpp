@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <cfloat>
+#include <cmath>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/GeometryView.h>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+void ExpectBoundBoxEq(const Base::BoundBox3f& box1, const Base::BoundBox3f& box2)
+{
+    EXPECT_EQ(box1.MinX, box2.MinX);
+    EXPECT_EQ(box1.MinY, box2.MinY);
+    EXPECT_EQ(box1.MinZ, box2.MinZ);
+    EXPECT_EQ(box1.MaxX, box2.MaxX);
+    EXPECT_EQ(box1.MaxY, box2.MaxY);
+    EXPECT_EQ(box1.MaxZ, box2.MaxZ);
+}
+}  // namespace
+
+class MeshGeometryViewTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // wavy surface with enough points to split the work over several threads
+        const int count = 120;
+        auto point = [](int i, int j) {
+            float x = float(i) * 0.1F;
+            float y = float(j) * 0.1F;
+            return Base::Vector3f(x, y, 0.5F * std::sin(x) * std::cos(y));
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < count; i++) {
+            for (int j = 0; j < count; j++) {
+                facets.emplace_back(point(i, j), point(i + 1, j), point(i, j + 1));
+                facets.emplace_back(point(i, j + 1), point(i + 1, j), point(i + 1, j + 1));
+            }
+        }
+        kernel = facets;
+
+        mat.rotX(0.3);
+        mat.rotZ(1.1);
+        mat.move(Base::Vector3d(10.0, -5.0, 2.0));
+    }
+
+    MeshCore::MeshKernel kernel;
+    Base::Matrix4D mat;
+};
+
+TEST_F(MeshGeometryViewTest, TestBoundBox)
+{
+    MeshCore::MeshGeometryView view(kernel);
+    EXPECT_EQ(view.CountPoints(), kernel.CountPoints());
+    EXPECT_EQ(view.CountFacets(), kernel.CountFacets());
+
+    Base::BoundBox3f box;
+    for (const auto& pnt : kernel.GetPoints()) {
+        box.Add(pnt);
+    }
+    ExpectBoundBoxEq(view.GetBoundBox(), box);
+    ExpectBoundBoxEq(MeshCore::MeshGeometryView::GetBoundBox(kernel.GetPoints()), box);
+}
+
+TEST_F(MeshGeometryViewTest, TestTransform)
+{
+    MeshCore::MeshGeometryView view(kernel, mat);
+
+    MeshCore::MeshPointArray points = kernel.GetPoints();
+    Base::BoundBox3f box;
+    for (auto& pnt : points) {
+        pnt *= mat;
+        box.Add(pnt);
+    }
+
+    kernel.Transform(mat);
+    ExpectBoundBoxEq(kernel.GetBoundBox(), box);
+    ExpectBoundBoxEq(view.GetBoundBox(), box);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(kernel.GetPoint(i), points[i]);
+        EXPECT_EQ(view.GetPoint(i), points[i]);
+    }
+}
+
+TEST_F(MeshGeometryViewTest, TestFacetNormalsAndAreas)
+{
+    MeshCore::MeshGeometryView view(kernel);
+    std::vector<Base::Vector3f> normals;
+    std::vector<float> areas;
+    view.GetFacetNormals(normals);
+    view.GetFacetAreas(areas);
+    ASSERT_EQ(normals.size(), kernel.CountFacets());
+    ASSERT_EQ(areas.size(), kernel.CountFacets());
+
+    MeshCore::MeshFacetIterator it(kernel);
+    for (it.Init(); it.More(); it.Next()) {
+        EXPECT_LT(Base::Distance(normals[it.Position()], it->GetNormal()), 1e-5F);
+        EXPECT_NEAR(areas[it.Position()], it->Area(), 1e-6F);
+    }
+}
+
+TEST_F(MeshGeometryViewTest, TestNearestFacet)
+{
+    MeshCore::MeshGeometryView view(kernel, mat);
+    kernel.Transform(mat);
+
+    std::vector<MeshCore::FacetIndex> facets;
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i += 7) {
+        facets.push_back(i);
+    }
+
+    for (int i = 0; i < 50; i++) {
+        Base::Vector3f pnt = mat * Base::Vector3f(float(i % 10) * 1.3F, float(i / 10) * 2.5F, 0.3F);
+        pnt.z += float(i % 3) - 1.0F;
+
+        float minDist = FLT_MAX;
+        std::size_t nearest = facets.size();
+        for (std::size_t j = 0; j < facets.size(); j++) {
+            float dist = kernel.GetFacet(facets[j]).DistanceToPoint(pnt);
+            if (dist < minDist) {
+                minDist = dist;
+                nearest = j;
+            }
+        }
+
+        float dist {};
+        bool positive {};
+        std::size_t index = view.NearestFacet(pnt, facets.data(), facets.size(), dist, positive);
+        EXPECT_NEAR(dist, minDist, 1e-4F);
+        EXPECT_NEAR(kernel.GetFacet(facets[index]).DistanceToPoint(pnt), minDist, 1e-4F);
+        if (index == nearest) {
+            MeshCore::MeshGeomFacet facet = kernel.GetFacet(facets[nearest]);
+            EXPECT_EQ(positive, pnt.DistanceToPlane(facet._aclPoints[0], facet.GetNormal()) > 0);
+        }
+    }
+
+    float dist {};
+    bool positive {};
+    EXPECT_EQ(view.NearestFacet(Base::Vector3f(), facets.data(), 0, dist, positive), 0);
+    EXPECT_EQ(dist, FLT_MAX);
+}
+
+TEST_F(MeshGeometryViewTest, TestNearestFacetOfSet)
+{
+    MeshCore::MeshGeometryView view(kernel, mat);
+
+    std::vector<MeshCore::FacetIndex> facets;
+    std::set<MeshCore::FacetIndex> facetSet;
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i += 3) {
+        facets.push_back(i);
+        facetSet.insert(i);
+    }
+
+    for (int i = 0; i < 20; i++) {
+        Base::Vector3f pnt = mat * Base::Vector3f(float(i % 5) * 1.7F, float(i / 5) * 2.1F, 0.4F);
+
+        float dist {};
+        bool positive {};
+        std::size_t index = view.NearestFacet(pnt, facets.data(), facets.size(), dist, positive);
+
+        float setDist {};
+        bool setPositive {};
+        MeshCore::FacetIndex facet = view.NearestFacet(pnt, facetSet, setDist, setPositive);
+        EXPECT_EQ(facet, facets[index]);
+        EXPECT_FLOAT_EQ(setDist, dist);
+        EXPECT_EQ(setPositive, positive);
+    }
+
+    float dist {};
+    bool positive {};
+    EXPECT_EQ(view.NearestFacet(Base::Vector3f(), std::set<MeshCore::FacetIndex>(), dist, positive),
+              MeshCore::FACET_INDEX_MAX);
+    EXPECT_EQ(dist, FLT_MAX);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshGridTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // wavy surface with enough facets to fill the grid concurrently
+        const int count = 120;
+        auto point = [](int i, int j) {
+            float x = float(i) * 0.1F;
+            float y = float(j) * 0.1F;
+            return Base::Vector3f(x, y, 0.5F * std::sin(x) * std::cos(y));
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < count; i++) {
+            for (int j = 0; j < count; j++) {
+                facets.emplace_back(point(i, j), point(i + 1, j), point(i, j + 1));
+                facets.emplace_back(point(i, j + 1), point(i + 1, j), point(i + 1, j + 1));
+            }
+        }
+        kernel = facets;
+    }
+
+    const MeshCore::MeshKernel& GetKernel() const
+    {
+        return kernel;
+    }
+
+private:
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshGridTest, TestFacetGridContainsAllFacets)
+{
+    MeshCore::MeshFacetGrid grid(GetKernel(), 20);
+    EXPECT_TRUE(grid.Verify());
+
+    std::vector<bool> found(GetKernel().CountFacets(), false);
+    MeshCore::MeshGridIterator it(grid);
+    for (it.Init(); it.More(); it.Next()) {
+        std::vector<MeshCore::ElementIndex> elements;
+        it.GetElements(elements);
+        EXPECT_TRUE(std::is_sorted(elements.begin(), elements.end()));
+        EXPECT_TRUE(std::adjacent_find(elements.begin(), elements.end()) == elements.end());
+        for (auto index : elements) {
+            found[index] = true;
+        }
+    }
+
+    EXPECT_TRUE(std::all_of(found.begin(), found.end(), [](bool value) {
+        return value;
+    }));
+}
+
+TEST_F(MeshGridTest, TestPointGridContainsEachPointOnce)
+{
+    MeshCore::MeshPointGrid grid(GetKernel(), 20);
+
+    std::vector<int> found(GetKernel().CountPoints(), 0);
+    MeshCore::MeshGridIterator it(grid);
+    for (it.Init(); it.More(); it.Next()) {
+        std::vector<MeshCore::ElementIndex> elements;
+        it.GetElements(elements);
+        for (auto index : elements) {
+            found[index]++;
+        }
+    }
+
+    EXPECT_TRUE(std::all_of(found.begin(), found.end(), [](int value) {
+        return value == 1;
+    }));
+}
+
+TEST_F(MeshGridTest, TestSearchNearestFromPoints)
+{
+    MeshCore::MeshFacetGrid grid(GetKernel(), 20);
+
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 2000; i++) {
+        points.emplace_back(float(i % 50) * 0.25F, float(i / 50) * 0.3F, 0.7F);
+    }
+
+    std::vector<MeshCore::ElementIndex> facets;
+    grid.SearchNearestFromPoints(points, facets);
+    ASSERT_EQ(facets.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(facets[i], grid.SearchNearestFromPoint(points[i]));
+    }
+
+    grid.SearchNearestFromPoints(points, facets, 0.5F);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(facets[i], grid.SearchNearestFromPoint(points[i], 0.5F));
+    }
+}
+
+TEST_F(MeshGridTest, TestSearchNearestOnRays)
+{
+    MeshCore::MeshFacetGrid grid(GetKernel(), 20);
+    MeshCore::MeshAlgorithm alg(GetKernel());
+
+    std::vector<Base::Vector3f> points;
+    std::vector<Base::Vector3f> dirs;
+    for (int i = 0; i < 2000; i++) {
+        points.emplace_back(float(i % 50) * 0.25F + 0.01F, float(i / 50) * 0.3F + 0.01F, 2.0F);
+        dirs.emplace_back(0.0F, 0.0F, -1.0F);
+    }
+    // a ray that misses the mesh
+    points.emplace_back(-5.0F, -5.0F, 2.0F);
+    dirs.emplace_back(0.0F, 0.0F, 1.0F);
+
+    std::vector<MeshCore::ElementIndex> facets;
+    std::vector<Base::Vector3f> results;
+    grid.SearchNearestOnRays(points, dirs, facets, results);
+    ASSERT_EQ(facets.size(), points.size());
+    ASSERT_EQ(results.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        Base::Vector3f res;
+        MeshCore::FacetIndex facet {};
+        if (alg.NearestFacetOnRay(points[i], dirs[i], grid, res, facet)) {
+            EXPECT_EQ(facets[i], facet);
+            EXPECT_EQ(results[i], res);
+        }
+        else {
+            EXPECT_EQ(facets[i], MeshCore::ELEMENT_INDEX_MAX);
+        }
+    }
+    EXPECT_EQ(facets.back(), MeshCore::ELEMENT_INDEX_MAX);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
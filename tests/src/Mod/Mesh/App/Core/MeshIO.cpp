@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <Mod/Mesh/App/Core/Builder.h>
+#include <Mod/Mesh/App/Core/IO/MappedFile.h>
+#include <Mod/Mesh/App/Core/IO/TextBuffer.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshIOTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // grid of triangles where inner points are shared by six facets
+        const int count = 60;
+        auto point = [](int i, int j) {
+            return Base::Vector3f(float(i), float(j), float((i * j) % 7));
+        };
+
+        for (int i = 0; i < count; i++) {
+            for (int j = 0; j < count; j++) {
+                facets.emplace_back(point(i, j), point(i + 1, j), point(i, j + 1));
+                facets.emplace_back(point(i, j + 1), point(i + 1, j), point(i + 1, j + 1));
+            }
+        }
+    }
+
+    std::string binarySTL() const
+    {
+        std::string data(80, ' ');
+        auto append = [&data](const void* value, std::size_t size) {
+            data.append(static_cast<const char*>(value), size);
+        };
+
+        uint32_t count = uint32_t(facets.size());
+        append(&count, sizeof(count));
+        for (const auto& facet : facets) {
+            Base::Vector3f normal = facet.GetNormal();
+            append(&normal.x, 3 * sizeof(float));
+            for (const auto& pnt : facet._aclPoints) {
+                append(&pnt.x, 3 * sizeof(float));
+            }
+            uint16_t attribute = 0;
+            append(&attribute, sizeof(attribute));
+        }
+        return data;
+    }
+
+    std::string binaryPLY(const MeshCore::MeshKernel& kernel) const
+    {
+        std::ostringstream str;
+        str << "ply\n"
+            << "format binary_little_endian 1.0\n"
+            << "element vertex " << kernel.CountPoints() << "\n"
+            << "property float x\n"
+            << "property float y\n"
+            << "property float z\n"
+            << "property uchar red\n"
+            << "property uchar green\n"
+            << "property uchar blue\n"
+            << "element face " << kernel.CountFacets() << "\n"
+            << "property list uchar int vertex_indices\n"
+            << "end_header\n";
+
+        for (const auto& pnt : kernel.GetPoints()) {
+            str.write(reinterpret_cast<const char*>(&pnt.x), 3 * sizeof(float));
+            unsigned char rgb[3] = {255, 0, 51};
+            str.write(reinterpret_cast<const char*>(rgb), sizeof(rgb));
+        }
+        for (const auto& facet : kernel.GetFacets()) {
+            unsigned char num = 3;
+            str.write(reinterpret_cast<const char*>(&num), sizeof(num));
+            for (auto index : facet._aulPoints) {
+                uint32_t value = uint32_t(index);
+                str.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+        }
+        return str.str();
+    }
+
+    static void ExpectKernelEq(const MeshCore::MeshKernel& kernel1,
+                               const MeshCore::MeshKernel& kernel2)
+    {
+        ASSERT_EQ(kernel1.CountPoints(), kernel2.CountPoints());
+        ASSERT_EQ(kernel1.CountFacets(), kernel2.CountFacets());
+        for (MeshCore::PointIndex i = 0; i < kernel1.CountPoints(); i++) {
+            EXPECT_EQ(kernel1.GetPoint(i), kernel2.GetPoint(i));
+        }
+        for (MeshCore::FacetIndex i = 0; i < kernel1.CountFacets(); i++) {
+            const auto& facet1 = kernel1.GetFacets()[i];
+            const auto& facet2 = kernel2.GetFacets()[i];
+            for (int j = 0; j < 3; j++) {
+                EXPECT_EQ(facet1._aulPoints[j], facet2._aulPoints[j]);
+                EXPECT_EQ(facet1._aulNeighbours[j], facet2._aulNeighbours[j]);
+            }
+        }
+    }
+
+    std::vector<MeshCore::MeshGeomFacet> facets;
+};
+
+TEST_F(MeshIOTest, TestSoupBuilderMergesPoints)
+{
+    // the normal is skipped like in a binary STL record
+    std::vector<float> records {0, 0, 1, 0, 0, 0,  1, 0, 0, 0, 1, 0,
+                                0, 0, 1, 1, 0, 0,  1, 1, 0, -0.0F, 1, 0};
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshSoupBuilder builder(kernel);
+    builder.Build(reinterpret_cast<const char*>(records.data() + 3), 2, 12 * sizeof(float));
+
+    ASSERT_EQ(kernel.CountPoints(), 4);
+    ASSERT_EQ(kernel.CountFacets(), 2);
+    EXPECT_EQ(kernel.GetPoint(0), Base::Vector3f(0, 0, 0));
+    EXPECT_EQ(kernel.GetPoint(1), Base::Vector3f(1, 0, 0));
+    EXPECT_EQ(kernel.GetPoint(2), Base::Vector3f(0, 1, 0));
+    EXPECT_EQ(kernel.GetPoint(3), Base::Vector3f(1, 1, 0));
+
+    const auto& facet = kernel.GetFacets()[1];
+    EXPECT_EQ(facet._aulPoints[0], 1);
+    EXPECT_EQ(facet._aulPoints[1], 3);
+    EXPECT_EQ(facet._aulPoints[2], 2);
+    EXPECT_EQ(facet._aulNeighbours[2], 0);
+    EXPECT_EQ(kernel.GetFacets()[0]._aulNeighbours[1], 1);
+}
+
+TEST_F(MeshIOTest, TestBinarySTLFromMemory)
+{
+    std::string data = binarySTL();
+
+    MeshCore::MeshKernel kernel1;
+    std::istringstream str(data);
+    EXPECT_TRUE(MeshCore::MeshInput(kernel1).LoadSTL(str));
+
+    MeshCore::MeshKernel kernel2;
+    MeshCore::MemoryStreamBuf buf(data.data(), data.size());
+    std::istream mem(&buf);
+    EXPECT_TRUE(MeshCore::MeshInput(kernel2).LoadSTL(mem));
+    EXPECT_EQ(buf.available(), 0);
+
+    EXPECT_EQ(kernel1.CountFacets(), facets.size());
+    EXPECT_EQ(kernel1.CountPoints(), 61 * 61);
+    ExpectKernelEq(kernel1, kernel2);
+}
+
+TEST_F(MeshIOTest, TestBinaryPLYFromMemory)
+{
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+    std::string data = binaryPLY(kernel);
+
+    MeshCore::MeshKernel kernel1;
+    MeshCore::Material mat1;
+    std::istringstream str(data);
+    EXPECT_TRUE(MeshCore::MeshInput(kernel1, &mat1).LoadPLY(str));
+
+    MeshCore::MeshKernel kernel2;
+    MeshCore::Material mat2;
+    MeshCore::MemoryStreamBuf buf(data.data(), data.size());
+    std::istream mem(&buf);
+    EXPECT_TRUE(MeshCore::MeshInput(kernel2, &mat2).LoadPLY(mem));
+    EXPECT_EQ(buf.available(), 0);
+
+    ExpectKernelEq(kernel, kernel1);
+    ExpectKernelEq(kernel1, kernel2);
+    EXPECT_EQ(mat2.binding, MeshCore::MeshIO::PER_VERTEX);
+    EXPECT_TRUE(mat1 == mat2);
+}
+
+TEST_F(MeshIOTest, TestTextBufferMatchesStream)
+{
+    std::vector<float> values {0.0F,     -0.0F,   1.0F,      -2.5F,     0.0078125F, 999.9995F,
+                               99999.95F, 1e-4F,  1.2345e-5F, 123456.7F, 3.0e12F,    -1e20F};
+    for (bool fixed : {false, true}) {
+        for (float value : values) {
+            MeshCore::TextBuffer buf;
+            buf.setFixed(fixed);
+            buf << value << ' ' << -3 << ' ' << std::size_t(42);
+
+            std::ostringstream str;
+            if (fixed) {
+                str.precision(6);
+                str.setf(std::ios::fixed | std::ios::showpoint);
+            }
+            str << value << ' ' << -3 << ' ' << std::size_t(42);
+            EXPECT_EQ(std::string(buf.data(), buf.size()), str.str());
+        }
+    }
+}
+
+TEST_F(MeshIOTest, TestAsciiWritersRoundTrip)
+{
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+
+    for (auto format : {MeshCore::MeshIO::ASTL, MeshCore::MeshIO::APLY, MeshCore::MeshIO::OBJ}) {
+        std::stringstream str;
+        EXPECT_TRUE(MeshCore::MeshOutput(kernel).SaveFormat(str, format));
+
+        MeshCore::MeshKernel result;
+        EXPECT_TRUE(MeshCore::MeshInput(result).LoadFormat(str, format));
+        EXPECT_EQ(result.CountPoints(), kernel.CountPoints());
+        EXPECT_EQ(result.CountFacets(), kernel.CountFacets());
+    }
+}
+
+// Run with --gtest_also_run_disabled_tests to print the throughput of the writers
+TEST_F(MeshIOTest, DISABLED_BenchmarkWriters)
+{
+    std::vector<MeshCore::MeshGeomFacet> soup;
+    for (int i = 0; i < 700; i++) {
+        for (int j = 0; j < 700; j++) {
+            Base::Vector3f p1(float(i) * 0.37F, float(j) * 0.41F, float((i * j) % 11) * 0.13F);
+            Base::Vector3f p2 = p1 + Base::Vector3f(0.37F, 0.0F, 0.05F);
+            Base::Vector3f p3 = p1 + Base::Vector3f(0.0F, 0.41F, -0.05F);
+            soup.emplace_back(p1, p2, p3);
+            soup.emplace_back(p3, p2, p2 + Base::Vector3f(0.0F, 0.41F, 0.0F));
+        }
+    }
+    MeshCore::MeshKernel kernel;
+    kernel = soup;
+
+    std::vector<std::pair<const char*, MeshCore::MeshIO::Format>> formats {
+        {"STL (binary)", MeshCore::MeshIO::BSTL},
+        {"STL (ASCII)", MeshCore::MeshIO::ASTL},
+        {"OBJ", MeshCore::MeshIO::OBJ},
+        {"PLY (binary)", MeshCore::MeshIO::PLY},
+        {"PLY (ASCII)", MeshCore::MeshIO::APLY},
+        {"3MF", MeshCore::MeshIO::ThreeMF}};
+
+    for (const auto& it : formats) {
+        std::ostringstream str;
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_TRUE(MeshCore::MeshOutput(kernel).SaveFormat(str, it.second));
+        std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+        double size = double(str.tellp()) / (1024.0 * 1024.0);
+        std::cout << it.first << ": " << size << " MB in " << time.count() << " s, "
+                  << size / time.count() << " MB/s" << std::endl;
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
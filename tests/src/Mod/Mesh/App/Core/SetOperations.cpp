@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/SetOperations.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SetOperationsTest: public ::testing::Test
+{
+protected:
+    static MeshCore::MeshKernel
+    CreateSphere(const Base::Vector3f& center, float radius, int stacks, int slices)
+    {
+        const float pi = 3.14159265358979F;
+        auto point = [&](int i, int j) {
+            if (i == 0) {
+                return center + Base::Vector3f(0.0F, 0.0F, radius);
+            }
+            if (i == stacks) {
+                return center + Base::Vector3f(0.0F, 0.0F, -radius);
+            }
+            float theta = pi * float(i) / float(stacks);
+            float phi = 2.0F * pi * float(j % slices) / float(slices);
+            return center
+                + Base::Vector3f(radius * std::sin(theta) * std::cos(phi),
+                                 radius * std::sin(theta) * std::sin(phi),
+                                 radius * std::cos(theta));
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < stacks; i++) {
+            for (int j = 0; j < slices; j++) {
+                if (i > 0) {
+                    facets.emplace_back(point(i, j), point(i + 1, j), point(i, j + 1));
+                }
+                if (i < stacks - 1) {
+                    facets.emplace_back(point(i, j + 1), point(i + 1, j), point(i + 1, j + 1));
+                }
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    static MeshCore::MeshKernel Run(const MeshCore::MeshKernel& mesh1,
+                                    const MeshCore::MeshKernel& mesh2,
+                                    MeshCore::SetOperations::OperationType type)
+    {
+        MeshCore::MeshKernel result;
+        MeshCore::SetOperations setOp(mesh1, mesh2, result, type);
+        setOp.Do();
+        return result;
+    }
+};
+
+TEST_F(SetOperationsTest, TestOverlappingSpheres)
+{
+    // two unit spheres whose centers have a distance of one
+    MeshCore::MeshKernel sphere1 = CreateSphere(Base::Vector3f(0.0F, 0.0F, 0.0F), 1.0F, 40, 80);
+    MeshCore::MeshKernel sphere2 = CreateSphere(Base::Vector3f(0.5F, 0.7F, 0.5F), 1.0F, 40, 80);
+    const float pi = 3.14159265358979F;
+    const float sphere = 4.0F * pi / 3.0F;
+    const float lens = 5.0F * pi / 12.0F;
+
+    MeshCore::MeshKernel unite = Run(sphere1, sphere2, MeshCore::SetOperations::Union);
+    EXPECT_NEAR(unite.GetVolume(), 2.0F * sphere - lens, 0.1F);
+
+    MeshCore::MeshKernel intersect = Run(sphere1, sphere2, MeshCore::SetOperations::Intersect);
+    EXPECT_NEAR(intersect.GetVolume(), lens, 0.1F);
+
+    MeshCore::MeshKernel subtract = Run(sphere1, sphere2, MeshCore::SetOperations::Difference);
+    EXPECT_NEAR(subtract.GetVolume(), sphere - lens, 0.1F);
+}
+
+TEST_F(SetOperationsTest, TestDisjointSpheres)
+{
+    MeshCore::MeshKernel sphere1 = CreateSphere(Base::Vector3f(0.0F, 0.0F, 0.0F), 1.0F, 10, 20);
+    MeshCore::MeshKernel sphere2 = CreateSphere(Base::Vector3f(3.0F, 0.0F, 0.0F), 1.0F, 10, 20);
+
+    MeshCore::MeshKernel unite = Run(sphere1, sphere2, MeshCore::SetOperations::Union);
+    EXPECT_EQ(unite.CountFacets(), sphere1.CountFacets() + sphere2.CountFacets());
+
+    MeshCore::MeshKernel intersect = Run(sphere1, sphere2, MeshCore::SetOperations::Intersect);
+    EXPECT_EQ(intersect.CountFacets(), 0);
+
+    MeshCore::MeshKernel subtract = Run(sphere1, sphere2, MeshCore::SetOperations::Difference);
+    EXPECT_EQ(subtract.CountFacets(), sphere1.CountFacets());
+}
+
+// Run with --gtest_also_run_disabled_tests to print the time of a boolean of 1M facets
+TEST_F(SetOperationsTest, DISABLED_BenchmarkUnion)
+{
+    MeshCore::MeshKernel sphere1 = CreateSphere(Base::Vector3f(0.0F, 0.0F, 0.0F), 1.0F, 500, 1000);
+    MeshCore::MeshKernel sphere2 = CreateSphere(Base::Vector3f(0.5F, 0.7F, 0.5F), 1.0F, 500, 1000);
+
+    auto start = std::chrono::steady_clock::now();
+    MeshCore::MeshKernel unite = Run(sphere1, sphere2, MeshCore::SetOperations::Union);
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    std::cout << sphere1.CountFacets() + sphere2.CountFacets() << " facets united in "
+              << time.count() << " s" << std::endl;
+    EXPECT_GT(unite.CountFacets(), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
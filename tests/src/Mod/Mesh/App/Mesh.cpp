@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <sstream>
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 
@@ -95,4 +96,35 @@ TEST(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+TEST(MeshTest, TestWriteCompactAndRead)
+{
+    MeshCore::MeshKernel kernel;
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {1, 0, 0};
+    Base::Vector3f p3 {0, 1, 0};
+    Base::Vector3f p4 {1, 1, 0};
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p3, p2, p4));
+
+    std::stringstream compact;
+    kernel.WriteCompact(compact);
+    std::stringstream full;
+    kernel.Write(full);
+    EXPECT_LT(compact.str().size(), full.str().size());
+
+    MeshCore::MeshKernel copy;
+    copy.Read(compact);
+    EXPECT_EQ(copy.CountPoints(), 4);
+    EXPECT_EQ(copy.CountFacets(), 2);
+    EXPECT_EQ(copy.GetPoint(3), p4);
+    for (std::size_t i = 0; i < 2; i++) {
+        const MeshCore::MeshFacet& face = copy.GetFacets()[i];
+        const MeshCore::MeshFacet& orig = kernel.GetFacets()[i];
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(face._aulPoints[j], orig._aulPoints[j]);
+            EXPECT_EQ(face._aulNeighbours[j], orig._aulNeighbours[j]);
+        }
+    }
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -209,3 +209,24 @@ TEST_F(FeaturePartFuseTest, testRefine)
 }
 
 // See FeaturePartCommon.cpp for a history test.  It would be exactly the same and redundant here.
+
+TEST_F(FeaturePartFuseTest, testMultiFuseHierarchical)
+{
+    // Arrange
+    auto multiFuse = dynamic_cast<Part::MultiFuse*>(_doc->addObject("Part::MultiFuse"));
+    multiFuse->Shapes.setValues({_boxes[0], _boxes[1], _boxes[2], _boxes[3]});
+    multiFuse->Hierarchical.setValue(true);
+
+    // Act
+    multiFuse->execute();
+    Part::TopoShape ts = multiFuse->Shape.getValue();
+    double volume = PartTestHelpers::getVolume(ts.getShape());
+    Base::BoundBox3d bb = ts.getBoundBox();
+
+    // Assert
+    EXPECT_DOUBLE_EQ(volume, 15.0);
+    EXPECT_DOUBLE_EQ(bb.MinY, 0.0);
+    EXPECT_DOUBLE_EQ(bb.MaxY, 5.0);
+    EXPECT_EQ(multiFuse->History.getSize(), 4);
+    EXPECT_GT(ts.getElementMapSize(), 0);
+}
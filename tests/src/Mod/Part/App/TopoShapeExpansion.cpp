@@ -8,6 +8,8 @@
 
 #include "PartTestHelpers.h"
 
+#include <algorithm>
+#include <numeric>
 #include <boost/core/ignore_unused.hpp>
 #include <BRepAdaptor_CompCurve.hxx>
 #include <BRepAdaptor_Surface.hxx>
@@ -1564,6 +1566,59 @@ TEST_F(TopoShapeExpansionTest, makeElementBooleanFuse)
                                  }));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementTreeFuse)
+{
+    // Arrange
+    std::vector<TopoShape> cubes;
+    for (int i = 0; i < 40; i++) {
+        TopoDS_Shape cube = BRepPrimAPI_MakeBox(gp_Pnt(0.5 * i, 0, 0), 1, 1, 1).Shape();
+        cubes.emplace_back(cube, i + 1L);
+    }
+    TopoShape result {0L};
+    int fusions = 0;
+    std::vector<int> sources;
+    // Act
+    result.makeElementTreeFuse(
+        cubes,
+        nullptr,
+        0,
+        16,
+        [&](BRepBuilderAPI_MakeShape& mk, const std::vector<int>& ids, const TopoShape& shape) {
+            boost::ignore_unused(mk);
+            EXPECT_FALSE(shape.isNull());
+            sources.insert(sources.end(), ids.begin(), ids.end());
+            fusions++;
+        });
+    // Assert four clusters of ten cubes merged pairwise
+    EXPECT_EQ(fusions, 7);
+    std::sort(sources.begin(), sources.end());
+    std::vector<int> expected(46);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(sources, expected);
+    EXPECT_NEAR(getVolume(result.getShape()), 20.5, 1e-6);
+    EXPECT_EQ(result.countSubShapes(TopAbs_SOLID), 1);
+    EXPECT_TRUE(result.getElementMapSize() > 0);
+}
+
+TEST_F(TopoShapeExpansionTest, makeElementTreeFuseSingleCluster)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    TopoShape expected {0L};
+    expected.makeElementFuse({topoShape1, topoShape2});
+    // Act
+    TopoShape result {0L};
+    result.makeElementTreeFuse({topoShape1, topoShape2});
+    // Assert a single cluster is the same as a plain fusion
+    EXPECT_FLOAT_EQ(getVolume(result.getShape()), 1.75);
+    EXPECT_EQ(result.getElementMapSize(), expected.getElementMapSize());
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementDraft)
 {  // Draft as in Draft Angle or sloped sides for removing shapes from a mold.
     // Arrange
@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+#include <App/Document.h>
+#include <Mod/Part/App/FeaturePartCommon.h>
+#include <Mod/Part/App/TopoShape.h>
+#include <Mod/Part/App/TopoShapeOpCache.h>
+#include <Mod/Part/App/TopoShapeOpCode.h>
+
+#include "PartTestHelpers.h"
+
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using namespace Part;
+using namespace PartTestHelpers;
+
+class TopoShapeOpCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        TopoShapeOpCache::instance().clear();
+    }
+
+    void TearDown() override
+    {
+        TopoShapeOpCache::instance().clear();
+    }
+};
+
+TEST_F(TopoShapeOpCacheTest, booleanIsReused)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+
+    // Act
+    TopoShape result1 {3L};
+    result1.makeElementBoolean(Part::OpCodes::Cut, {topoShape1, topoShape2});
+    TopoShape result2 {3L};
+    result2.makeElementBoolean(Part::OpCodes::Cut, {topoShape1, topoShape2});
+
+    // Assert
+    EXPECT_EQ(TopoShapeOpCache::instance().size(), 1);
+    EXPECT_TRUE(result1.getShape().IsEqual(result2.getShape()));
+    EXPECT_EQ(elementMap(result1), elementMap(result2));
+    EXPECT_FLOAT_EQ(getVolume(result2.getShape()), 0.75);
+}
+
+TEST_F(TopoShapeOpCacheTest, changedInputsAreNotReused)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    TopoShape moved {cube2.Moved(TopLoc_Location(tr)), 2L};
+
+    // Act
+    TopoShape result1 {3L};
+    result1.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, topoShape2});
+    TopoShape result2 {3L};
+    result2.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, moved});
+    TopoShape result3 {4L};
+    result3.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, topoShape2});
+    TopoShape result4 {3L};
+    result4.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, topoShape2}, nullptr, 0.1);
+
+    // Assert
+    EXPECT_EQ(TopoShapeOpCache::instance().size(), 4);
+    EXPECT_FALSE(result1.getShape().IsEqual(result2.getShape()));
+    EXPECT_FALSE(result1.getShape().IsEqual(result3.getShape()));
+    EXPECT_FALSE(result1.getShape().IsEqual(result4.getShape()));
+    EXPECT_FLOAT_EQ(getVolume(result1.getShape()), 2.0);
+    EXPECT_FLOAT_EQ(getVolume(result2.getShape()), 1.75);
+}
+
+TEST_F(TopoShapeOpCacheTest, prismAndRefineAreReused)
+{
+    // Arrange
+    auto face = BRepBuilderAPI_MakeFace(BRepBuilderAPI_MakePolygon(gp_Pnt(0.0, 0.0, 0.0),
+                                                                   gp_Pnt(1.0, 0.0, 0.0),
+                                                                   gp_Pnt(1.0, 1.0, 0.0),
+                                                                   gp_Pnt(0.0, 1.0, 0.0),
+                                                                   Standard_True)
+                                            .Wire())
+                    .Face();
+    TopoShape base {face, 1L};
+
+    // Act
+    TopoShape prism1 {2L};
+    prism1.makeElementPrism(base, gp_Vec(0.0, 0.0, 1.0));
+    TopoShape prism2 {2L};
+    prism2.makeElementPrism(base, gp_Vec(0.0, 0.0, 1.0));
+    TopoShape prism3 {2L};
+    prism3.makeElementPrism(base, gp_Vec(0.0, 0.0, 2.0));
+    TopoShape refine1 {3L};
+    refine1.makeElementRefine(prism1);
+    TopoShape refine2 {3L};
+    refine2.makeElementRefine(prism2);
+
+    // Assert
+    EXPECT_TRUE(prism1.getShape().IsEqual(prism2.getShape()));
+    EXPECT_FALSE(prism1.getShape().IsEqual(prism3.getShape()));
+    EXPECT_TRUE(refine1.getShape().IsEqual(refine2.getShape()));
+    EXPECT_EQ(elementMap(refine1), elementMap(refine2));
+    EXPECT_EQ(TopoShapeOpCache::instance().size(), 3);
+}
+
+TEST_F(TopoShapeOpCacheTest, untaggedResultsOutsideFeaturesAreNotCached)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+
+    // Act
+    TopoShape result1 {0L};
+    result1.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, topoShape2});
+    TopoShape result2 {0L};
+    result2.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, topoShape2});
+
+    // Assert
+    EXPECT_EQ(TopoShapeOpCache::instance().size(), 0);
+    EXPECT_FALSE(result1.getShape().IsEqual(result2.getShape()));
+    EXPECT_FLOAT_EQ(getVolume(result2.getShape()), 2.0);
+}
+
+TEST_F(TopoShapeOpCacheTest, untaggedResultsAreCachedPerFeature)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    auto fuse = [&](long owner) {
+        TopoShapeOpCache::OwnerScope scope(owner);
+        TopoShape result {0L};
+        result.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, topoShape2});
+        return result;
+    };
+
+    // Act
+    auto result1 = fuse(5L);
+    auto result2 = fuse(5L);
+    auto result3 = fuse(6L);
+
+    // Assert
+    EXPECT_EQ(TopoShapeOpCache::instance().size(), 2);
+    EXPECT_TRUE(result1.getShape().IsEqual(result2.getShape()));
+    EXPECT_FALSE(result1.getShape().IsEqual(result3.getShape()));
+    EXPECT_EQ(elementMap(result1), elementMap(result3));
+}
+
+TEST_F(TopoShapeOpCacheTest, recomputedFeatureIsReused)
+{
+    // Arrange
+    PartTestHelperClass helper;
+    helper.createTestDoc();
+    auto common = dynamic_cast<Part::MultiCommon*>(helper._doc->addObject("Part::MultiCommon"));
+    common->Shapes.setValues({helper._boxes[0], helper._boxes[1]});
+    helper._doc->recompute();
+    TopoDS_Shape first = common->Shape.getShape().getShape();
+    std::size_t cached = TopoShapeOpCache::instance().size();
+
+    // Act
+    common->touch();
+    helper._doc->recompute();
+
+    // Assert
+    EXPECT_GT(cached, 0);
+    EXPECT_EQ(TopoShapeOpCache::instance().size(), cached);
+    EXPECT_TRUE(common->Shape.getShape().getShape().IsSame(first));
+    EXPECT_DOUBLE_EQ(getVolume(common->Shape.getShape().getShape()), 3.0);
+}
+
+TEST_F(TopoShapeOpCacheTest, clearDropsResults)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    TopoShape result1 {3L};
+    result1.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, topoShape2});
+
+    // Act
+    TopoShapeOpCache::instance().clear();
+    TopoShape result2 {3L};
+    result2.makeElementBoolean(Part::OpCodes::Fuse, {topoShape1, topoShape2});
+
+    // Assert
+    EXPECT_FALSE(result1.getShape().IsEqual(result2.getShape()));
+    EXPECT_EQ(elementMap(result1), elementMap(result2));
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <App/Application.h>
+#include <Base/FileInfo.h>
+#include <Mod/Part/Gui/TessellationCache.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using namespace PartGui;
+
+class TessellationCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Part/TessellationCache");
+        hGrp->SetBool("Enabled", true);
+        hGrp->SetBool("DiskCache", false);
+        hGrp->SetInt("MemoryLimit", 1);
+    }
+
+    void TearDown() override
+    {
+        // drops the tessellations in memory, but keeps the files of other tests
+        hGrp->SetInt("MemoryLimit", 0);
+        for (const auto& key : keys) {
+            Base::FileInfo(App::Application::getUserCachePath() + "Tessellation/" + key + ".tess")
+                .deleteFile();
+        }
+        hGrp->RemoveBool("Enabled");
+        hGrp->RemoveBool("DiskCache");
+        hGrp->RemoveInt("MemoryLimit");
+    }
+
+    std::string makeKey(const char* name)
+    {
+        keys.emplace_back(std::string("TessellationCacheTest") + name);
+        return keys.back();
+    }
+
+    // a triangle and an edge with the given number of face nodes
+    static std::shared_ptr<TessellationData> makeData(int numPoints)
+    {
+        auto data = std::make_shared<TessellationData>();
+        for (int i = 0; i < numPoints; ++i) {
+            data->points.emplace_back(static_cast<float>(i), 1.0F, 2.0F);
+            data->normals.emplace_back(0.0F, 0.0F, 1.0F);
+        }
+        data->points.emplace_back(0.0F, 0.0F, 0.0F);
+        data->faceIndex = {0, 1, 2, -1};
+        data->partIndex = {1};
+        data->lineIndex = {0, 1, -1};
+        data->vertexStart = numPoints;
+        return data;
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    ParameterGrp::handle hGrp;
+    std::vector<std::string> keys;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TEST_F(TessellationCacheTest, leastRecentlyUsedIsDropped)
+{
+    // Arrange
+    auto& cache = TessellationCache::instance();
+    // about 360 kB each, two of them fit into the limit of 1 MB
+    std::string first = makeKey("First");
+    std::string second = makeKey("Second");
+    std::string third = makeKey("Third");
+    cache.insert(first, makeData(15000));
+    cache.insert(second, makeData(15000));
+
+    // Act
+    EXPECT_TRUE(cache.find(first));
+    cache.insert(third, makeData(15000));
+
+    // Assert
+    EXPECT_TRUE(cache.find(first));
+    EXPECT_FALSE(cache.find(second));
+    EXPECT_TRUE(cache.find(third));
+}
+
+TEST_F(TessellationCacheTest, diskRoundTrip)
+{
+    // Arrange
+    hGrp->SetInt("MemoryLimit", 0);
+    hGrp->SetBool("DiskCache", true);
+    auto& cache = TessellationCache::instance();
+    std::string key = makeKey("RoundTrip");
+    auto data = makeData(3);
+
+    // Act
+    cache.insert(key, data);
+    auto restored = cache.find(key);
+
+    // Assert
+    ASSERT_TRUE(restored);
+    EXPECT_NE(restored, data);
+    EXPECT_EQ(restored->points, data->points);
+    EXPECT_EQ(restored->normals, data->normals);
+    EXPECT_EQ(restored->faceIndex, data->faceIndex);
+    EXPECT_EQ(restored->partIndex, data->partIndex);
+    EXPECT_EQ(restored->lineIndex, data->lineIndex);
+    EXPECT_EQ(restored->vertexStart, data->vertexStart);
+}
+
+TEST_F(TessellationCacheTest, invalidIndicesAreNotRead)
+{
+    // Arrange
+    hGrp->SetInt("MemoryLimit", 0);
+    hGrp->SetBool("DiskCache", true);
+    auto& cache = TessellationCache::instance();
+    std::string triangle = makeKey("InvalidTriangle");
+    std::string edge = makeKey("InvalidEdge");
+    std::string parts = makeKey("InvalidParts");
+    auto badTriangle = makeData(3);
+    badTriangle->faceIndex = {0, 1, 3, -1};
+    auto badEdge = makeData(3);
+    badEdge->lineIndex = {0, 4, -1};
+    auto badParts = makeData(3);
+    badParts->partIndex = {2};
+
+    // Act
+    cache.insert(triangle, badTriangle);
+    cache.insert(edge, badEdge);
+    cache.insert(parts, badParts);
+
+    // Assert
+    EXPECT_FALSE(badTriangle->isValid());
+    EXPECT_FALSE(cache.find(triangle));
+    EXPECT_FALSE(cache.find(edge));
+    EXPECT_FALSE(cache.find(parts));
+    EXPECT_TRUE(makeData(3)->isValid());
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include "Mod/Part/App/TopoShapeOpCode.h"
+#include "Mod/PartDesign/App/FeatureTransformed.h"
+
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <GProp_GProps.hxx>
+#include <TopLoc_Location.hxx>
+#include <gp_Ax2.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using PartDesign::TopoShape;
+
+class FeatureTransformedTest: public ::testing::Test
+{
+protected:
+    // Gives access to the protected helpers of the pattern features
+    class Transformed: public PartDesign::Transformed
+    {
+    public:
+        using PartDesign::Transformed::makeBatchedBoolean;
+        using PartDesign::Transformed::removeDisjointTools;
+        using PartDesign::Transformed::splitDisjointBatches;
+    };
+
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    static TopoShape makeBox(double x, double y, double length, double width, double height)
+    {
+        return TopoShape {BRepPrimAPI_MakeBox(gp_Pnt(x, y, 0.0), length, width, height).Shape()};
+    }
+
+    static TopoShape makeCylinder(double x, double y)
+    {
+        return TopoShape {
+            BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(x, y, 0.0), gp_Dir(0.0, 0.0, 1.0)), 1.0, 1.0)
+                .Shape()};
+    }
+
+    static double getVolume(const TopoShape& shape)
+    {
+        GProp_GProps prop;
+        BRepGProp::VolumeProperties(shape.getShape(), prop);
+        return prop.Mass();
+    }
+};
+
+TEST_F(FeatureTransformedTest, disjointToolsAreRemoved)
+{
+    // Arrange
+    auto inside = makeCylinder(5.0, 5.0);
+    std::vector<TopoShape> shapes {makeBox(0.0, 0.0, 10.0, 10.0, 1.0),
+                                   makeCylinder(20.0, 5.0),
+                                   inside,
+                                   makeCylinder(5.0, 20.0)};
+
+    // Act
+    Transformed::removeDisjointTools(shapes);
+
+    // Assert
+    ASSERT_EQ(shapes.size(), 2);
+    EXPECT_TRUE(shapes[1].getShape().IsEqual(inside.getShape()));
+}
+
+TEST_F(FeatureTransformedTest, toolsBesideRotatedSupportAreRemoved)
+{
+    // Arrange
+    gp_Trsf rotation;
+    rotation.SetRotation(gp_Ax1(gp_Pnt(), gp_Dir(0.0, 0.0, 1.0)), M_PI / 4);
+    TopoShape support {
+        BRepPrimAPI_MakeBox(10.0, 10.0, 1.0).Shape().Moved(TopLoc_Location(rotation))};
+    // inside the axis aligned box of the support, but beside the support itself
+    auto beside = makeBox(5.0, 0.5, 1.0, 1.0, 1.0);
+    auto inside = makeBox(0.0, 5.0, 1.0, 1.0, 1.0);
+    std::vector<TopoShape> shapes {support, beside, inside};
+
+    // Act
+    Transformed::removeDisjointTools(shapes);
+
+    // Assert
+    ASSERT_EQ(shapes.size(), 2);
+    EXPECT_TRUE(shapes[1].getShape().IsEqual(inside.getShape()));
+}
+
+TEST_F(FeatureTransformedTest, overlappingToolsAreSplitIntoBatches)
+{
+    // Arrange
+    auto first = makeBox(0.0, 0.0, 2.0, 1.0, 1.0);
+    auto overlapping = makeBox(1.0, 0.0, 2.0, 1.0, 1.0);
+    auto disjoint = makeBox(5.0, 0.0, 1.0, 1.0, 1.0);
+    auto between = makeBox(2.5, 0.0, 1.5, 1.0, 1.0);
+    std::vector<TopoShape> shapes {makeBox(0.0, 0.0, 10.0, 10.0, 1.0),
+                                   first,
+                                   overlapping,
+                                   disjoint,
+                                   between};
+
+    // Act
+    auto batches = Transformed::splitDisjointBatches(shapes);
+
+    // Assert
+    ASSERT_EQ(batches.size(), 2);
+    ASSERT_EQ(batches[0].size(), 3);
+    ASSERT_EQ(batches[1].size(), 1);
+    EXPECT_TRUE(batches[0][0].getShape().IsEqual(first.getShape()));
+    EXPECT_TRUE(batches[0][1].getShape().IsEqual(disjoint.getShape()));
+    EXPECT_TRUE(batches[0][2].getShape().IsEqual(between.getShape()));
+    EXPECT_TRUE(batches[1][0].getShape().IsEqual(overlapping.getShape()));
+}
+
+TEST_F(FeatureTransformedTest, batchedBooleanMatchesSingleBoolean)
+{
+    // Arrange
+    std::vector<TopoShape> shapes {makeBox(0.0, 0.0, 10.0, 10.0, 1.0),
+                                   makeCylinder(3.0, 5.0),
+                                   makeCylinder(4.0, 5.0),
+                                   makeCylinder(7.0, 5.0)};
+    TopoShape single;
+    single.makeElementBoolean(Part::OpCodes::Cut, shapes);
+
+    // Act
+    TopoShape batched;
+    auto count = Transformed::makeBatchedBoolean(batched, Part::OpCodes::Cut, shapes);
+
+    // Assert
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(batched.countSubShapes(TopAbs_SOLID), 1);
+    EXPECT_NEAR(getVolume(batched), getVolume(single), 1e-6);
+    EXPECT_LT(getVolume(batched), 100.0 - 2 * M_PI);
+}
+
+TEST_F(FeatureTransformedTest, disjointToolsAreNotBatched)
+{
+    // Arrange
+    std::vector<TopoShape> shapes {makeBox(0.0, 0.0, 10.0, 10.0, 1.0),
+                                   makeCylinder(3.0, 5.0),
+                                   makeCylinder(7.0, 5.0)};
+    TopoShape result;
+
+    // Act
+    auto count = Transformed::makeBatchedBoolean(result, Part::OpCodes::Cut, shapes);
+
+    // Assert
+    EXPECT_EQ(count, 0);
+    EXPECT_TRUE(result.isNull());
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -1,13 +1,31 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/Writer.h>
+#include <Mod/Points/App/PointStore.h>
 #include <Mod/Points/App/Points.h>
 #include <Mod/Points/App/PointsAlgos.h>
+#include <Mod/Points/App/PointsOctree.h>
+#include <src/App/InitApplication.h>
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
 
 class PointsTest: public ::testing::Test
 {
 protected:
+    static void SetUpTestSuite()
+    {
+        // the readers check the out-of-core settings
+        tests::initApplication();
+    }
+
     void SetUp() override
     {
         std::vector<Base::Vector3f> points;
@@ -119,6 +137,25 @@ TEST_F(PointsTest, TestSwap)
     EXPECT_EQ(kernel.countValid(), 20);
 }
 
+TEST_F(PointsTest, TestWriteCompactAndRead)
+{
+    Base::StringWriter writer;
+    writer.setMode("BinaryMesh");
+    getKernel().SaveDocFile(writer);
+    // header of magic, version and count, followed by the coordinates
+    EXPECT_EQ(writer.getString().size(), 3 * sizeof(uint32_t) + 8 * 3 * sizeof(float));
+
+    std::stringstream str(writer.getString());
+    Base::Reader reader(str, "Points", 0);
+    Points::PointKernel copy;
+    copy.RestoreDocFile(reader);
+
+    ASSERT_EQ(copy.size(), getKernel().size());
+    for (int i = 0; i < static_cast<int>(copy.size()); i++) {
+        EXPECT_EQ(copy.getPoint(i), getKernel().getPoint(i));
+    }
+}
+
 TEST_F(PointsTest, TestASCII)
 {
     std::string name = getFileName() + ".asc";
@@ -238,4 +275,288 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+
+TEST_F(PointsTest, TestPLYValues)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.write(name);
+
+    Points::PlyReader reader;
+    reader.read(name);
+
+    const Points::PointKernel& points = reader.getPoints();
+    ASSERT_EQ(points.size(), getKernel().size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(points.getPoint(int(i)), getKernel().getPoint(int(i)));
+        EXPECT_FLOAT_EQ(reader.getIntensities()[i], getIntensity()[i]);
+    }
+}
+
+TEST_F(PointsTest, TestCompressedPCD)
+{
+    // the values of a compressed file are stored field by field
+    std::vector<float> fields;
+    for (const auto& pnt : getKernel().getBasicPoints()) {
+        fields.push_back(pnt.x);
+    }
+    for (const auto& pnt : getKernel().getBasicPoints()) {
+        fields.push_back(pnt.y);
+    }
+    for (const auto& pnt : getKernel().getBasicPoints()) {
+        fields.push_back(pnt.z);
+    }
+    for (float value : getIntensity()) {
+        fields.push_back(value);
+    }
+
+    // LZF literal runs of at most 32 bytes
+    std::vector<char> raw(fields.size() * sizeof(float));
+    std::memcpy(raw.data(), fields.data(), raw.size());
+    std::vector<char> compressed;
+    for (std::size_t i = 0; i < raw.size(); i += 32) {
+        std::size_t len = std::min<std::size_t>(32, raw.size() - i);
+        compressed.push_back(char(len - 1));
+        compressed.insert(compressed.end(), raw.begin() + i, raw.begin() + i + len);
+    }
+
+    std::string name = getFileName();
+    {
+        Base::ofstream out(Base::FileInfo(name), std::ios::out | std::ios::binary);
+        out << "VERSION .7\nFIELDS x y z intensity\nSIZE 4 4 4 4\nTYPE F F F F\n"
+            << "COUNT 1 1 1 1\nWIDTH 8\nHEIGHT 1\nPOINTS 8\nDATA binary_compressed\n";
+        Base::OutputStream str(out);
+        str << uint32_t(compressed.size()) << uint32_t(raw.size());
+        out.write(compressed.data(), std::streamsize(compressed.size()));
+    }
+
+    Points::PcdReader reader;
+    reader.read(name);
+
+    const Points::PointKernel& points = reader.getPoints();
+    ASSERT_EQ(points.size(), getKernel().size());
+    ASSERT_TRUE(reader.hasIntensities());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(points.getPoint(int(i)), getKernel().getPoint(int(i)));
+        EXPECT_FLOAT_EQ(reader.getIntensities()[i], getIntensity()[i]);
+    }
+}
+
+TEST_F(PointsTest, TestPointStore)
+{
+    Points::PointStore store;
+    std::vector<Base::Vector3f> points;
+    for (std::size_t i = 0; i < Points::PointStore::ChunkSize + 10; i++) {
+        points.emplace_back(float(i), float(i % 7), -float(i));
+    }
+    store.append(points.data(), 5);
+    store.append(points.data() + 5, points.size() - 5);
+
+    ASSERT_EQ(store.size(), points.size());
+    ASSERT_EQ(store.countChunks(), 2);
+    EXPECT_EQ(store.chunkLength(0), Points::PointStore::ChunkSize);
+    EXPECT_EQ(store.chunkLength(1), 10);
+    EXPECT_EQ(store[Points::PointStore::ChunkSize + 3].x, points[Points::PointStore::ChunkSize + 3].x);
+
+    // removed points don't come back
+    store.resize(3);
+    EXPECT_EQ(store.countChunks(), 1);
+    store.push_back(Base::Vector3f(1, 2, 3));
+    store.resize(6);
+    EXPECT_EQ(store[3].y, 2.0F);
+    EXPECT_EQ(store[5].x, 0.0F);
+
+    auto copy = store.clone();
+    store[0].x = 42.0F;
+    ASSERT_EQ(copy->size(), 6);
+    EXPECT_EQ((*copy)[0].x, 0.0F);
+    EXPECT_EQ((*copy)[3].z, 3.0F);
+}
+
+TEST_F(PointsTest, TestOutOfCore)
+{
+    Points::PointKernel kernel(getKernel());
+    kernel.setOutOfCore(true);
+    EXPECT_TRUE(kernel.isOutOfCore());
+    ASSERT_EQ(kernel.size(), 8);
+    EXPECT_EQ(kernel.getPoint(5), getKernel().getPoint(5));
+    EXPECT_EQ(kernel.countValid(), 8);
+
+    // copies share the storage until they are modified
+    Points::PointKernel copy(kernel);
+    copy.setPoint(0, Base::Vector3d(5, 5, 5));
+    copy.push_back(Base::Vector3d(2, 2, 2));
+    EXPECT_TRUE(copy.isOutOfCore());
+    EXPECT_EQ(copy.size(), 9);
+    EXPECT_EQ(kernel.size(), 8);
+    EXPECT_EQ(kernel.getPoint(0), Base::Vector3d(0, 0, 0));
+
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(1, 0, 0));
+    kernel.transformGeometry(mat);
+    EXPECT_EQ(kernel.getPoint(7), Base::Vector3d(2, 1, 1));
+    EXPECT_EQ(kernel.getBoundBox().MinX, 1.0);
+
+    kernel.erase(1, 3);
+    EXPECT_EQ(kernel.size(), 6);
+    EXPECT_EQ(kernel.getPoint(1), Base::Vector3d(1, 1, 1));
+
+    kernel.setOutOfCore(false);
+    EXPECT_FALSE(kernel.isOutOfCore());
+    EXPECT_EQ(kernel.getBasicPoints().size(), 6);
+}
+
+TEST_F(PointsTest, TestWriteOutOfCore)
+{
+    Points::PointKernel kernel(getKernel());
+    kernel.setOutOfCore(true);
+
+    // the const accessor doesn't move the points into memory
+    const Points::PointKernel& constKernel = kernel;
+    EXPECT_THROW(constKernel.getBasicPoints(), Base::RuntimeError);
+    EXPECT_TRUE(kernel.isOutOfCore());
+
+    std::string name = getFileName();
+    for (int i = 0; i < 2; i++) {
+        if (i == 0) {
+            Points::PlyWriter writer(kernel);
+            writer.setIntensities(getIntensity());
+            writer.write(name);
+        }
+        else {
+            Points::PcdWriter writer(kernel);
+            writer.setIntensities(getIntensity());
+            writer.write(name);
+        }
+        EXPECT_TRUE(kernel.isOutOfCore());
+
+        std::unique_ptr<Points::Reader> reader;
+        if (i == 0) {
+            reader = std::make_unique<Points::PlyReader>();
+        }
+        else {
+            reader = std::make_unique<Points::PcdReader>();
+        }
+        reader->read(name);
+        const Points::PointKernel& points = reader->getPoints();
+        ASSERT_EQ(points.size(), getKernel().size());
+        for (std::size_t j = 0; j < points.size(); j++) {
+            EXPECT_EQ(points.getPoint(int(j)), getKernel().getPoint(int(j)));
+            EXPECT_FLOAT_EQ(reader->getIntensities()[j], getIntensity()[j]);
+        }
+    }
+}
+
+TEST_F(PointsTest, TestDecimate)
+{
+    for (bool outOfCore : {false, true}) {
+        Points::PointKernel kernel(getKernel());
+        kernel.setOutOfCore(outOfCore);
+        kernel.decimate(3);
+        ASSERT_EQ(kernel.size(), 3);
+        EXPECT_EQ(kernel.getPoint(1), getKernel().getPoint(3));
+        EXPECT_EQ(kernel.getPoint(2), getKernel().getPoint(6));
+    }
+}
+
+TEST_F(PointsTest, TestOctreeNearestNeighbours)
+{
+    // a dense and a sparse cluster like near and far points of a scan
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 2000; i++) {
+        float value = float(i);
+        Base::Vector3f pnt(std::fmod(value * 0.8191725F, 1.0F),
+                           std::fmod(value * 0.6710436F, 1.0F),
+                           std::fmod(value * 0.5497005F, 1.0F));
+        points.push_back(pnt * 0.01F);
+        points.push_back(pnt * 100.0F);
+    }
+
+    Points::PointsOctree octree(points, 8);
+    EXPECT_EQ(octree.size(), points.size());
+    EXPECT_GT(octree.countNodes(), 1);
+
+    for (const auto& pnt : {Base::Vector3d(0.005, 0.005, 0.005),
+                            Base::Vector3d(50, 20, 70),
+                            Base::Vector3d(-10, 0, 200)}) {
+        std::vector<double> all;
+        for (const auto& it : points) {
+            all.push_back(Base::Distance(pnt, Base::Vector3d(it.x, it.y, it.z)));
+        }
+        std::sort(all.begin(), all.end());
+
+        std::vector<Points::PointsOctree::index_type> indices;
+        std::vector<double> distances;
+        octree.nearestNeighbours(pnt, 5, indices, distances);
+        ASSERT_EQ(indices.size(), 5);
+        for (std::size_t i = 0; i < 5; i++) {
+            EXPECT_DOUBLE_EQ(distances[i], all[i]);
+            const auto& found = points[indices[i]];
+            EXPECT_DOUBLE_EQ(Base::Distance(pnt, Base::Vector3d(found.x, found.y, found.z)),
+                             distances[i]);
+        }
+
+        double radius = (all[20] + all[21]) / 2.0;
+        octree.radiusSearch(pnt, radius, indices);
+        EXPECT_EQ(indices.size(), 21);
+    }
+}
+
+TEST_F(PointsTest, TestOctreeTransformed)
+{
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(10, 0, 0));
+    Points::PointKernel kernel(getKernel());
+    kernel.setTransform(mat);
+
+    Points::PointsOctree octree(kernel, 1);
+    std::vector<Points::PointsOctree::index_type> indices;
+    std::vector<double> distances;
+    octree.nearestNeighbours(Base::Vector3d(11, 1, 0.9), 1, indices, distances);
+    ASSERT_EQ(indices.size(), 1);
+    EXPECT_EQ(indices[0], 7);
+    EXPECT_NEAR(distances[0], 0.1, 1e-6);
+
+    octree.radiusSearch(Base::Vector3d(10, 0, 0), 1.0, indices);
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, std::vector<Points::PointsOctree::index_type>({0, 1, 2, 4}));
+}
+
+TEST_F(PointsTest, TestOctreeSampling)
+{
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            points.emplace_back(float(i) * 0.1F, float(j) * 0.1F, 0.0F);
+        }
+    }
+    Points::PointsOctree octree(points);
+
+    // one point per cube of 0.2 edge length
+    EXPECT_EQ(octree.voxelSample(0.199).size(), 100);
+    EXPECT_THROW(octree.voxelSample(0.0), Base::ValueError);
+
+    std::vector<Points::PointsOctree::index_type> sample = octree.poissonDiskSample(0.25);
+    EXPECT_LT(sample.size(), points.size());
+    for (std::size_t i = 0; i < sample.size(); i++) {
+        for (std::size_t j = i + 1; j < sample.size(); j++) {
+            EXPECT_GE(Base::Distance(points[sample[i]], points[sample[j]]), 0.25F);
+        }
+    }
+
+    // every point has a kept one nearby
+    std::vector<Base::Vector3f> kept;
+    for (auto index : sample) {
+        kept.push_back(points[index]);
+    }
+    Points::PointsOctree keptOctree(kept);
+    std::vector<Points::PointsOctree::index_type> indices;
+    std::vector<double> distances;
+    for (const auto& it : points) {
+        keptOctree.nearestNeighbours(Base::Vector3d(it.x, it.y, it.z), 1, indices, distances);
+        ASSERT_EQ(distances.size(), 1);
+        EXPECT_LT(distances[0], 0.25);
+    }
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 #include <src/App/InitApplication.h>
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/FileInfo.h>
+#include <Base/Interpreter.h>
 #include <Mod/Points/App/PointsFeature.h>
 
 class PointsFeatureTest: public ::testing::Test
@@ -33,4 +37,46 @@ TEST_F(PointsFeatureTest, getComplexElementTypes)
 
     EXPECT_EQ(types.size(), 0);
 }
+
+TEST_F(PointsFeatureTest, lazyRestoreRoundTripsThroughSave)
+{
+    // Arrange
+    Base::Interpreter().runString("import Points");
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    bool lazyRestore = hGrp->GetBool("LazyRestore", false);
+    std::string original = App::Application::getTempPath() + "unit_test_LazyRestore.FCStd";
+    std::string copy = App::Application::getTempPath() + "unit_test_LazyRestoreCopy.FCStd";
+    std::string name = App::GetApplication().getUniqueDocumentName("lazy");
+    App::Document* doc = App::GetApplication().newDocument(name.c_str(), "testUser");
+    auto feature = static_cast<Points::Feature*>(doc->addObject("Points::Feature", "Cloud"));
+    Points::PointKernel kernel;
+    kernel.push_back(Base::Vector3d(1, 2, 3));
+    kernel.push_back(Base::Vector3d(4, 5, 6));
+    kernel.push_back(Base::Vector3d(7, 8, 9));
+    feature->Points.setValue(kernel);
+    doc->saveAs(original.c_str());
+    App::GetApplication().closeDocument(name.c_str());
+
+    // Act
+    hGrp->SetBool("LazyRestore", true);
+    doc = App::GetApplication().openDocument(original.c_str());
+    name = doc->getName();
+    feature = static_cast<Points::Feature*>(doc->getObject("Cloud"));
+    bool deferred = feature->Points.isDeferred();
+    doc->saveAs(copy.c_str());
+    App::GetApplication().closeDocument(name.c_str());
+    hGrp->SetBool("LazyRestore", lazyRestore);
+    doc = App::GetApplication().openDocument(copy.c_str());
+    name = doc->getName();
+    feature = static_cast<Points::Feature*>(doc->getObject("Cloud"));
+
+    // Assert
+    EXPECT_TRUE(deferred);
+    ASSERT_EQ(feature->Points.getValue().size(), 3);
+    EXPECT_EQ(feature->Points.getValue().getPoint(2), Base::Vector3d(7, 8, 9));
+    App::GetApplication().closeDocument(name.c_str());
+    Base::FileInfo(original).deleteFile();
+    Base::FileInfo(copy).deleteFile();
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
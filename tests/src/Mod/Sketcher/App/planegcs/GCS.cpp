@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "Mod/Sketcher/App/planegcs/GCS.h"
 
 class SystemTest: public GCS::System
@@ -50,3 +52,173 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+// Two points at a distance of 1, with a redundant copy of the distance constraint
+void addRedundantDistance(GCS::System* system, std::vector<double>& values, GCS::VEC_pD& params)
+{
+    GCS::Point p1, p2;
+    p1.x = &values[0];
+    p1.y = &values[1];
+    p2.x = &values[2];
+    p2.y = &values[3];
+    params = {p1.x, p1.y, p2.x, p2.y};
+    double* length = &values[4];  // NOLINT
+    double* zero = &values[5];    // NOLINT
+
+    system->addConstraintP2PDistance(p1, p2, length, 1);
+    system->addConstraintP2PDistance(p1, p2, length, 2);
+    system->addConstraintEqual(p1.x, zero, 3);
+}
+
+TEST_F(GCSTest, reuseDiagnosisOfMovedSystem)  // NOLINT
+{
+    // Arrange
+    std::vector<double> values {0.0, 0.0, 1.0, 0.0, 1.0, 0.0};
+    GCS::VEC_pD params;
+    addRedundantDistance(System(), values, params);
+    System()->declareUnknowns(params);
+    System()->initSolution();
+    GCS::VEC_I redundant;
+    System()->getRedundant(redundant);
+    ASSERT_EQ(2, System()->dofsNumber());
+    ASSERT_EQ(1, redundant.size());
+
+    // Act
+    System()->clear();
+    values = {0.0, 2.0, 0.0, 3.0, 1.0, 0.0};  // NOLINT
+    addRedundantDistance(System(), values, params);
+    System()->declareUnknowns(params);
+    System()->reuseDiagnosis = true;
+    System()->initSolution();
+
+    // Assert
+    GCS::VEC_I reusedRedundant;
+    System()->getRedundant(reusedRedundant);
+    EXPECT_EQ(2, System()->dofsNumber());
+    EXPECT_EQ(redundant, reusedRedundant);
+}
+
+TEST_F(GCSTest, reuseDiagnosisNotForChangedTopology)  // NOLINT
+{
+    // Arrange
+    std::vector<double> values {0.0, 0.0, 1.0, 0.0, 1.0, 0.0};
+    GCS::VEC_pD params;
+    addRedundantDistance(System(), values, params);
+    System()->declareUnknowns(params);
+    System()->initSolution();
+    ASSERT_EQ(2, System()->dofsNumber());
+
+    // Act
+    System()->clear();
+    addRedundantDistance(System(), values, params);
+    System()->addConstraintEqual(params[1], &values[5], 4);
+    System()->declareUnknowns(params);
+    System()->reuseDiagnosis = true;
+    System()->initSolution();
+
+    // Assert
+    EXPECT_EQ(1, System()->dofsNumber());
+}
+
+// A chain of numSegments segments of unit length, starting at the origin and lying on the x
+// axis, built from the same kind of constraints as an imported polyline profile
+class GCSChainTest: public ::testing::TestWithParam<GCS::Algorithm>
+{
+protected:
+    void buildChain(GCS::System& system, int numSegments)
+    {
+        // the parameters must not move, the constraints point to them
+        values.assign(2 * (numSegments + 1) + 2, 0.0);
+        double* length = &values[values.size() - 2];
+        double* zero = &values[values.size() - 1];
+        *length = 1.0;
+
+        points.resize(numSegments + 1);
+        params.clear();
+        for (int i = 0; i <= numSegments; ++i) {
+            points[i].x = &values[2 * i];
+            points[i].y = &values[2 * i + 1];
+            *points[i].x = 1.1 * i + 0.1 * (i % 3);  // NOLINT
+            *points[i].y = 0.3 * (i % 2);            // NOLINT
+            params.push_back(points[i].x);
+            params.push_back(points[i].y);
+        }
+
+        int tag = 1;
+        system.addConstraintEqual(points[0].x, zero, tag++);
+        system.addConstraintEqual(points[0].y, zero, tag++);
+        for (int i = 0; i < numSegments; ++i) {
+            system.addConstraintP2PDistance(points[i], points[i + 1], length, tag++);
+            system.addConstraintEqual(points[i + 1].y, zero, tag++);
+        }
+    }
+
+    int solveChain(GCS::JacobianMatrix jacobianMatrix, int numSegments)
+    {
+        GCS::System system;
+        system.debugMode = GCS::NoDebug;
+        system.jacobianMatrix = jacobianMatrix;
+        buildChain(system, numSegments);
+        system.declareUnknowns(params);
+        system.initSolution(GetParam());
+        int ret = system.solve(true, GetParam());
+        system.applySolution();
+        return ret;
+    }
+
+    double endX() const
+    {
+        return *points.back().x;
+    }
+
+private:
+    std::vector<double> values;
+    std::vector<GCS::Point> points;
+    GCS::VEC_pD params;
+};
+
+TEST_P(GCSChainTest, sparseJacobianMatchesDense)  // NOLINT
+{
+    // Arrange
+    const int numSegments {50};
+
+    // Act
+    int retDense = solveChain(GCS::EigenDenseJacobian, numSegments);
+    double endDense = endX();
+    int retSparse = solveChain(GCS::EigenSparseJacobian, numSegments);
+    double endSparse = endX();
+
+    // Assert
+    EXPECT_EQ(GCS::Success, retDense);
+    EXPECT_EQ(GCS::Success, retSparse);
+    EXPECT_NEAR(numSegments, endDense, 1e-6);
+    EXPECT_NEAR(numSegments, endSparse, 1e-6);
+}
+
+// Run with --gtest_also_run_disabled_tests to write the timings of a big sketch to the test report
+TEST_P(GCSChainTest, DISABLED_sparseJacobianLargeSketch)  // NOLINT
+{
+    // Arrange
+    const int numSegments {300};
+
+    // Act
+    auto start = std::chrono::steady_clock::now();
+    int retDense = solveChain(GCS::EigenDenseJacobian, numSegments);
+    auto denseEnd = std::chrono::steady_clock::now();
+    int retSparse = solveChain(GCS::EigenSparseJacobian, numSegments);
+    auto sparseEnd = std::chrono::steady_clock::now();
+
+    // Assert
+    EXPECT_EQ(GCS::Success, retDense);
+    EXPECT_EQ(GCS::Success, retSparse);
+    EXPECT_NEAR(numSegments, endX(), 1e-6);
+    using ms = std::chrono::milliseconds;
+    RecordProperty("DenseMilliseconds",
+                   static_cast<int>(std::chrono::duration_cast<ms>(denseEnd - start).count()));
+    RecordProperty("SparseMilliseconds",
+                   static_cast<int>(std::chrono::duration_cast<ms>(sparseEnd - denseEnd).count()));
+}
+
+INSTANTIATE_TEST_SUITE_P(GCSChainTest,
+                         GCSChainTest,
+                         ::testing::Values(GCS::DogLeg, GCS::LevenbergMarquardt));